@@ -4,6 +4,7 @@
 #include <sstream>
 
 #include "case-matrix.hpp"
+#include "pattern-parser.hpp"
 #include "zmatrix.hpp"
 
 caseMatrix::caseMatrix(int caseNumber, std::string matrix) {
@@ -13,40 +14,16 @@ caseMatrix::caseMatrix(int caseNumber, std::string matrix) {
     loadFromString(matrix);
 }
 
-void caseMatrix::loadFromString(std::string m) {
-    if (m.size() == 0) throw std::runtime_error("Empty pattern string");
-    std::stringstream ms(m);
-    std::string r;
-    int row = 0;
-    while(std::getline(ms, r, ']'))
-    {
-        if(row == rows) throw std::runtime_error("Too many rows in pattern string");
-        std::stringstream rs(r);
-        std::string v;
-        int mv;
-        int col = 0;
-        while(std::getline(rs, v, ','))
-        {
-            if(col == cols) throw std::runtime_error("Too many columns in pattern string");
-            if(v[0] == '[') v.erase(0,1);
-            
-            if(v == "0") mv = 0;
-            else if (v == "1") mv = 1;
-            else {
-                std::ostringstream verr;
-                verr << "Invalid value in case string: " << v ;
-                throw std::runtime_error(verr.str());
-            }
-            c.z[row][col] = mv;
-            cT.z[col][row] = mv;
-            col++;
+void caseMatrix::loadFromString(std::string_view m) {
+    packedMatrix parsed = patternParser::parse(m, false, 1);
+    for (int row = 0; row < rows; row++) {
+        for (int col = 0; col < cols; col++) {
+            c.z[row][col] = parsed.get(row, col);
+            cT.z[col][row] = parsed.get(row, col);
         }
-        if (col != cols) throw std::runtime_error("Too few columns in pattern string");
-        row++;
     }
-    if (row != rows) throw std::runtime_error("Too few rows in pattern string");
-    c.updateMetadata();
-    cT.updateMetadata();
+    c.invalidateMetadata();
+    cT.invalidateMetadata();
 }
 
 void caseMatrix::printDebug() {
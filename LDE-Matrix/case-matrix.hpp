@@ -1,11 +1,15 @@
 #ifndef CASE_MATRIX_HPP
 #define CASE_MATRIX_HPP
 
+#include <string>
+#include <string_view>
+
 #include "zmatrix.hpp"
+
 class caseMatrix {
     public:
         caseMatrix(int caseNumber, std::string m);
-        void loadFromString(std::string m);
+        void loadFromString(std::string_view m);
         int id;
         zmatrix c; // This is the case matrix
         zmatrix cT;  // This is the transposed case matrix
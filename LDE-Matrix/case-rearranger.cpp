@@ -0,0 +1,104 @@
+#include "case-rearranger.hpp"
+
+#include <bit>
+#include <unordered_set>
+#include <utility>
+
+caseRearranger::caseRearranger(const packedMatrix &caseMatrix) : invariants(caseMatrix.caseInvariants()) {
+    std::array<uint64_t, COLS> caseCols{};
+    for (int r = 0; r < ROWS; r++) {
+        caseRows[r] = caseMatrix.rowM(r);
+        caseRowCounts[r] = std::popcount(caseRows[r]);
+        for (int c = 0; c < COLS; c++) caseCols[c] |= ((caseRows[r] >> c) & 1) << r;
+    }
+    for (int i = 0; i < COLS; i++) {
+        caseColCounts[i] = std::popcount(caseCols[i]);
+        for (int j = 0; j < COLS; j++) caseColOverlaps[i][j] = std::popcount(caseCols[i] & caseCols[j]);
+    }
+}
+
+void caseRearranger::search(const packedMatrix &pattern, const visitor &visit) const {
+    for (bool transposed : {false, true}) {
+        searchState state;
+        state.pattern = transposed ? pattern.transposed() : pattern;
+        // Without the case's counts no order of the rows and columns can match it
+        if (state.pattern.caseView().caseInvariants() != invariants) continue;
+        state.order.transposed = transposed;
+        state.visit = &visit;
+        for (int c = 0; c < COLS; c++) {
+            for (int r = 0; r < ROWS; r++) state.viewCols[c] |= ((state.pattern.rowN(r) >> c) & 1) << r;
+        }
+        if (!placeColumns(state, 0)) return;
+    }
+}
+
+// Returns false once the visitor has asked to stop
+bool caseRearranger::placeColumns(searchState &state, int curCol) const {
+    std::array<int, COLS> &cols = state.order.cols;
+    for (int i = curCol; i < COLS; i++) {
+        // Columns that are all 0s in the case are left where they are
+        if (caseColCounts[curCol] == 0) {
+            curCol++;
+            continue;
+        }
+        if (std::popcount(state.viewCols[cols[i]]) != caseColCounts[curCol]) continue;
+        std::swap(cols[curCol], cols[i]);
+        bool fits = true;
+        for (int c = 0; c < curCol && fits; c++) {
+            fits = std::popcount(state.viewCols[cols[c]] & state.viewCols[cols[curCol]]) == caseColOverlaps[c][curCol];
+        }
+        bool keepGoing = !fits || placeColumns(state, curCol + 1);
+        std::swap(cols[curCol], cols[i]);
+        if (!keepGoing) return false;
+    }
+    if (curCol < COLS) return true;
+    for (int c = 0; c < COLS; c++) {
+        if (std::popcount(state.viewCols[cols[c]]) != caseColCounts[c]) return true;
+    }
+    for (int r = 0; r < ROWS; r++) {
+        uint64_t row = 0;
+        for (int c = 0; c < COLS; c++) row |= ((state.viewCols[cols[c]] >> r) & 1) << c;
+        state.placedRows[r] = row;
+    }
+    return placeRows(state, 0);
+}
+
+bool caseRearranger::placeRows(searchState &state, int curRow) const {
+    std::array<int, ROWS> &rows = state.order.rows;
+    for (int i = curRow; i < ROWS; i++) {
+        // Same as the columns, rows that are all 0s in the case are left where they are
+        if (caseRowCounts[curRow] == 0) {
+            curRow++;
+            continue;
+        }
+        if (state.placedRows[rows[i]] != caseRows[curRow]) continue;
+        std::swap(rows[curRow], rows[i]);
+        bool keepGoing = placeRows(state, curRow + 1);
+        std::swap(rows[curRow], rows[i]);
+        if (!keepGoing) return false;
+    }
+    if (curRow < ROWS) return true;
+    for (int r = 0; r < ROWS; r++) {
+        if (state.placedRows[rows[r]] != caseRows[r]) return true;
+    }
+    return (*state.visit)(state.pattern.permuted(rows, state.order.cols), state.order);
+}
+
+std::vector<packedMatrix> caseRearranger::alignments(const packedMatrix &pattern, size_t limit) const {
+    std::vector<packedMatrix> found;
+    std::unordered_set<packedMatrix> seen;
+    search(pattern, [&](const packedMatrix &aligned, const caseAlignment &) {
+        if (seen.insert(aligned).second) found.push_back(aligned);
+        return limit == 0 || found.size() < limit;
+    });
+    return found;
+}
+
+size_t caseRearranger::count(const packedMatrix &pattern) const {
+    std::unordered_set<packedMatrix> seen;
+    search(pattern, [&](const packedMatrix &aligned, const caseAlignment &) {
+        seen.insert(aligned);
+        return true;
+    });
+    return seen.size();
+}
@@ -0,0 +1,56 @@
+#ifndef CASE_REARRANGER_HPP
+#define CASE_REARRANGER_HPP
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "case-registry.hpp"
+#include "packed-matrix.hpp"
+
+// Finds the row and column orders that line a pattern's case view up with one case
+//  It's the search patternMatrix::rearrangeMatrix has always done -> columns are swapped into place left to right to match
+//  the case column counts, then rows top to bottom, first for the pattern and then for its transpose
+//  The search only moves two permutation vectors and compares 6-bit case view slices so nothing is allocated per node
+//  A placed column or row never moves again, which gives two cuts that can't lose a match:
+//    a column has to share as many 1s with every placed column as the case columns do
+//    a row has to be its case row as soon as it's placed
+//  The matches come out in the same order as before
+class caseRearranger {
+    public:
+        // caseMatrix holds the case in the M plane like caseRegistry::packed
+        explicit caseRearranger(const packedMatrix &caseMatrix);
+
+        // Called with the rearranged pattern and how it was rearranged, returns false to stop the search
+        //  Different rearrangements can give the same pattern, each of them is passed on
+        using visitor = std::function<bool(const packedMatrix &, const caseAlignment &)>;
+        void search(const packedMatrix &pattern, const visitor &visit) const;
+
+        // Distinct rearranged patterns in the order they're first found, limit = 0 for all of them
+        std::vector<packedMatrix> alignments(const packedMatrix &pattern, size_t limit = 0) const;
+        // Number of distinct rearranged patterns
+        size_t count(const packedMatrix &pattern) const;
+
+    private:
+        static constexpr int ROWS = packedMatrix::ROWS;
+        static constexpr int COLS = packedMatrix::COLS;
+
+        std::array<uint64_t, ROWS> caseRows{};  // Bit c of row r is case entry [r][c]
+        std::array<int, ROWS> caseRowCounts{};
+        std::array<int, COLS> caseColCounts{};
+        std::array<std::array<int, COLS>, COLS> caseColOverlaps{};  // 1s that case columns i and j share
+        packedCaseInvariants invariants;
+
+        struct searchState {
+            packedMatrix pattern;  // The pattern or its transpose
+            std::array<uint64_t, COLS> viewCols{};  // Bit r of column c is case view entry [r][c]
+            std::array<uint64_t, ROWS> placedRows{};  // Case view rows with the columns in their current order
+            caseAlignment order;
+            const visitor *visit;
+        };
+        bool placeColumns(searchState &state, int curCol) const;
+        bool placeRows(searchState &state, int curRow) const;
+};
+
+#endif // CASE_REARRANGER_HPP
@@ -0,0 +1,55 @@
+#include "case-rearranger.hpp"
+#include "pattern-parser.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(CaseRearrangerTest, Alignments) {
+    const caseRegistry &cases = caseRegistry::instance();
+    // Case 4, the case and its transpose are the same shape so both ways are searched
+    packedMatrix pattern = patternParser::parse("[2,0,3,0,3,2][2,0,3,0,0,0][0,0,0,0,0,0][2,0,3,0,0,0][0,0,0,0,0,0][3,0,2,0,2,2]");
+    caseRearranger rearranger(cases.packed(4));
+    int visits = 0;
+    int transposed = 0;
+    rearranger.search(pattern, [&](const packedMatrix &aligned, const caseAlignment &alignment) {
+        visits++;
+        transposed += alignment.transposed;
+        EXPECT_EQ(alignment.apply(pattern), aligned);
+        EXPECT_EQ(aligned.caseView(), cases.packed(4));
+        return true;
+    });
+    std::vector<packedMatrix> all = rearranger.alignments(pattern);
+    EXPECT_EQ(all.size(), 16);
+    EXPECT_EQ(rearranger.count(pattern), 16);
+    // Some orders give the same pattern
+    EXPECT_GE(visits, all.size());
+    EXPECT_GT(transposed, 0);
+    EXPECT_LT(transposed, visits);
+    std::vector<packedMatrix> first = rearranger.alignments(pattern, 1);
+    ASSERT_EQ(first.size(), 1);
+    EXPECT_EQ(first[0], all[0]);
+
+    // Returning false stops the search
+    visits = 0;
+    rearranger.search(pattern, [&](const packedMatrix &, const caseAlignment &) { return ++visits < 3; });
+    EXPECT_EQ(visits, 3);
+}
+
+TEST(CaseRearrangerTest, NoAlignment) {
+    const caseRegistry &cases = caseRegistry::instance();
+    // A case 1 pattern can't line up with case 2
+    packedMatrix pattern = patternParser::parse("[2,3,0,0,0,0][3,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]");
+    EXPECT_EQ(caseRearranger(cases.packed(2)).count(pattern), 0);
+    EXPECT_EQ(caseRearranger(cases.packed(1)).count(pattern), 2);
+}
+
+TEST(CaseRearrangerTest, Case8) {
+    const caseRegistry &cases = caseRegistry::instance();
+    // Every row and column has 4 entries so without the cuts this would try 6! column orders and 6! row orders each way
+    packedMatrix pattern = patternParser::parse("[3,3,0,0,3,2][0,0,2,3,3,3][2,3,0,0,3,3][3,2,3,2,0,0][0,0,3,3,2,3][3,2,3,3,0,0]");
+    caseRearranger rearranger(cases.packed(8));
+    EXPECT_EQ(rearranger.count(pattern), 768);
+    for (const packedMatrix &aligned : rearranger.alignments(pattern)) {
+        EXPECT_EQ(aligned.caseView(), cases.packed(8));
+        EXPECT_EQ(aligned.orbitCanonical(), pattern.orbitCanonical());
+    }
+}
@@ -0,0 +1,80 @@
+#include "case-registry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <numeric>
+#include <stdexcept>
+
+static std::array<int, packedMatrix::ROWS> inverse(const std::array<int, packedMatrix::ROWS> &order) {
+    std::array<int, packedMatrix::ROWS> inv;
+    for (int i = 0; i < packedMatrix::ROWS; i++) inv[order[i]] = i;
+    return inv;
+}
+
+// Every ordering of the rows and then every ordering of the columns, plus the transpose of each
+//  Rows (columns) with the same contents are interchangeable so only distinct orderings are visited
+//  which keeps even case 8 to a few thousand matrices
+void caseRegistry::addOrbit(int caseIndex) {
+    const packedMatrix &c = packedCases[caseIndex];
+    std::vector<uint64_t> orbit;
+    auto insert = [&](uint64_t mask, const caseAlignment &alignment) {
+        auto [it, inserted] = orbitTable.try_emplace(mask, caseOrbitEntry{caseIndex, alignment});
+        if (inserted) orbit.push_back(mask);
+        else if (it->second.caseIndex != caseIndex) {
+            throw std::runtime_error(std::format("Case {} and case {} share a rearrangement", cases[it->second.caseIndex].id, cases[caseIndex].id));
+        }
+    };
+    std::array<int, packedMatrix::COLS> identity;
+    std::iota(identity.begin(), identity.end(), 0);
+    std::array<int, packedMatrix::ROWS> rowOrder = identity;
+    auto byRow = [&](int a, int b) { return c.rowM(a) < c.rowM(b); };
+    std::sort(rowOrder.begin(), rowOrder.end(), byRow);
+    do {
+        packedMatrix rowsPlaced = c.permuted(rowOrder, identity);
+        // The columns are the rows of the transpose
+        packedMatrix t = rowsPlaced.transposed();
+        std::array<int, packedMatrix::COLS> colOrder = identity;
+        auto byCol = [&](int a, int b) { return t.rowM(a) < t.rowM(b); };
+        std::sort(colOrder.begin(), colOrder.end(), byCol);
+        do {
+            packedMatrix image = rowsPlaced.permuted(identity, colOrder);
+            caseAlignment alignment;
+            alignment.rows = inverse(rowOrder);
+            alignment.cols = inverse(colOrder);
+            insert(image.mBits, alignment);
+            alignment.transposed = true;
+            insert(image.transposed().mBits, alignment);
+        } while (std::next_permutation(colOrder.begin(), colOrder.end(), byCol));
+    } while (std::next_permutation(rowOrder.begin(), rowOrder.end(), byRow));
+    std::sort(orbit.begin(), orbit.end());
+    orbits.push_back(orbit);
+}
+
+caseRegistry::caseRegistry() {
+    // Loading from a file is another way to do this but, with only 8 of them and only being used for the patterns, this is fine
+    // Case 0 is the root case and is all 0s
+    cases.push_back(caseMatrix(0, "[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
+    cases.push_back(caseMatrix(1, "[1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
+    cases.push_back(caseMatrix(2, "[1,1,0,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
+    cases.push_back(caseMatrix(3, "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,1,1,0,0][1,1,1,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
+    cases.push_back(caseMatrix(4, "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
+    cases.push_back(caseMatrix(5, "[1,1,0,0,0,0][1,1,0,0,0,0][0,0,1,1,0,0][0,0,1,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
+    cases.push_back(caseMatrix(6, "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,0,0,1,1][1,1,0,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"));
+    cases.push_back(caseMatrix(7, "[1,1,0,0,0,0][1,1,0,0,0,0][0,0,1,1,0,0][0,0,1,1,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"));
+    cases.push_back(caseMatrix(8, "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,0,0,1,1][1,1,0,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"));
+    for (int i = 0; i < int(cases.size()); i++) {
+        // Nothing is lazy after this point, the registry is shared between threads
+        cases[i].c.updateMetadata();
+        cases[i].cT.updateMetadata();
+        packedMatrix packed = cases[i].c.toPacked();
+        packedCases.push_back(packed);
+        caseInvariants.push_back(packed.caseInvariants());
+        addOrbit(i);
+    }
+}
+
+const caseRegistry& caseRegistry::instance() {
+    static const caseRegistry registry;
+    return registry;
+}
@@ -0,0 +1,83 @@
+#ifndef CASE_REGISTRY_HPP
+#define CASE_REGISTRY_HPP
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "case-matrix.hpp"
+#include "packed-matrix.hpp"
+
+// How a pattern lines up with its case
+//  Case entry [r][c] is pattern entry [rows[r]][cols[c]], taken from the transposed pattern when transposed is set
+struct caseAlignment {
+    bool transposed = false;
+    std::array<int, packedMatrix::ROWS> rows = {0, 1, 2, 3, 4, 5};
+    std::array<int, packedMatrix::COLS> cols = {0, 1, 2, 3, 4, 5};
+
+    // The pattern rearranged so its case view is the case matrix
+    packedMatrix apply(const packedMatrix &pattern) const {
+        return (transposed ? pattern.transposed() : pattern).permuted(rows, cols);
+    }
+};
+
+struct caseOrbitEntry {
+    int caseIndex;
+    caseAlignment alignment;
+};
+
+// The 9 case templates, built once for the whole process and never changed after that
+//  Every pattern used to parse its own copy of the cases; now they all read from this one
+//  All of the metadata is counted up front so the const accessors never write to the shared matrices
+class caseRegistry {
+    public:
+        static const caseRegistry& instance();
+
+        size_t size() const { return cases.size(); }
+        const caseMatrix& operator[](size_t caseIndex) const { return cases[caseIndex]; }
+        std::vector<caseMatrix>::const_iterator begin() const { return cases.begin(); }
+        std::vector<caseMatrix>::const_iterator end() const { return cases.end(); }
+
+        // The case as a packed matrix, 1s are in the M plane like packedMatrix::caseView
+        const packedMatrix& packed(int caseIndex) const { return packedCases[caseIndex]; }
+        const packedCaseInvariants& invariants(int caseIndex) const { return caseInvariants[caseIndex]; }
+        // Every distinct M plane that the case turns into when its rows and columns are rearranged or it's transposed
+        //  Sorted so it can be searched with std::binary_search
+        const std::vector<uint64_t>& orbit(int caseIndex) const { return orbits[caseIndex]; }
+        // Which case a case style mask (packedMatrix::caseView().mBits) is a rearrangement of and how to line it up
+        //  nullptr when it doesn't match any of them
+        //  Matching an orbit is the same as matching the counts zmatrix::operator== compares for the case matrices
+        const caseOrbitEntry* lookup(uint64_t caseMask) const {
+            auto it = orbitTable.find(caseMask);
+            return (it == orbitTable.end()) ? nullptr : &it->second;
+        }
+
+        caseRegistry(const caseRegistry &) = delete;
+        caseRegistry& operator=(const caseRegistry &) = delete;
+
+    private:
+        caseRegistry();
+        std::vector<caseMatrix> cases;
+        std::vector<packedMatrix> packedCases;
+        std::vector<packedCaseInvariants> caseInvariants;
+        std::vector<std::vector<uint64_t>> orbits;
+        std::unordered_map<uint64_t, caseOrbitEntry> orbitTable;
+        void addOrbit(int caseIndex);
+};
+
+// A copyable handle on the registry for classes that hold the cases as a member
+//  Indexing works the same as the std::vector<caseMatrix> it replaces
+class caseList {
+    public:
+        size_t size() const { return registry->size(); }
+        const caseMatrix& operator[](size_t caseIndex) const { return (*registry)[caseIndex]; }
+        std::vector<caseMatrix>::const_iterator begin() const { return registry->begin(); }
+        std::vector<caseMatrix>::const_iterator end() const { return registry->end(); }
+        const caseRegistry& all() const { return *registry; }
+
+    private:
+        const caseRegistry *registry = &caseRegistry::instance();
+};
+
+#endif // CASE_REGISTRY_HPP
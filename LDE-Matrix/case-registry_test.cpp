@@ -0,0 +1,63 @@
+#include "case-registry.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+
+TEST(CaseRegistryTest, SharedCases) {
+    const caseRegistry &registry = caseRegistry::instance();
+    EXPECT_EQ(&registry, &caseRegistry::instance());
+    ASSERT_EQ(registry.size(), 9);
+    for (int i = 0; i < 9; i++) {
+        EXPECT_EQ(registry[i].id, i);
+        EXPECT_EQ(registry.packed(i), registry[i].c.toPacked());
+        EXPECT_EQ(registry.packed(i).nBits, 0);
+        EXPECT_EQ(registry.invariants(i), registry.packed(i).caseInvariants());
+    }
+    // Copies of the handle all point at the same cases
+    caseList cases;
+    caseList copy = cases;
+    EXPECT_EQ(&copy[3], &registry[3]);
+    EXPECT_EQ(copy.size(), 9);
+    int count = 0;
+    for (const caseMatrix &c : copy) EXPECT_EQ(c.id, count++);
+}
+
+TEST(CaseRegistryTest, Orbits) {
+    const caseRegistry &registry = caseRegistry::instance();
+    // Case 1 -> pick the 2 rows and the 2 columns, case 7 -> also pick how the row pairs line up with the column pairs
+    //  Case 2 isn't symmetric so its transposes double the count
+    EXPECT_EQ(registry.orbit(0).size(), 1);
+    EXPECT_EQ(registry.orbit(1).size(), 15 * 15);
+    EXPECT_EQ(registry.orbit(2).size(), 2 * 15 * 15);
+    EXPECT_EQ(registry.orbit(7).size(), 15 * 15 * 6);
+    for (int i = 0; i < int(registry.size()); i++) {
+        const std::vector<uint64_t> &orbit = registry.orbit(i);
+        EXPECT_TRUE(std::is_sorted(orbit.begin(), orbit.end()));
+        EXPECT_TRUE(std::binary_search(orbit.begin(), orbit.end(), registry.packed(i).mBits));
+        EXPECT_TRUE(std::binary_search(orbit.begin(), orbit.end(), registry.packed(i).transposed().mBits));
+        packedMatrix shuffled = registry.packed(i).swappedRows(0, 5).swappedColumns(1, 3);
+        EXPECT_TRUE(std::binary_search(orbit.begin(), orbit.end(), shuffled.mBits));
+        for (uint64_t mask : orbit) {
+            packedCaseInvariants inv = packedMatrix(0, mask).caseInvariants();
+            EXPECT_TRUE(inv == registry.invariants(i) || inv.transposed() == registry.invariants(i)) << "Case " << i;
+        }
+    }
+}
+
+TEST(CaseRegistryTest, Lookup) {
+    const caseRegistry &registry = caseRegistry::instance();
+    for (int i = 0; i < int(registry.size()); i++) {
+        for (uint64_t mask : registry.orbit(i)) {
+            const caseOrbitEntry *entry = registry.lookup(mask);
+            ASSERT_NE(entry, nullptr);
+            EXPECT_EQ(entry->caseIndex, i);
+            // Lining the mask up has to give back the case matrix itself
+            EXPECT_EQ(entry->alignment.apply(packedMatrix(0, mask)), registry.packed(i)) << "Case " << i << " " << packedMatrix(0, mask);
+        }
+    }
+    // A single 1 isn't a case
+    EXPECT_EQ(registry.lookup(1), nullptr);
+    // Neither is case 1 with one of the 1s moved
+    EXPECT_EQ(registry.lookup(0b000011000101), nullptr);
+    EXPECT_NE(registry.lookup(0b000011000011), nullptr);
+}
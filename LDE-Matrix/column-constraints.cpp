@@ -0,0 +1,78 @@
+#include "column-constraints.hpp"
+
+#include <limits>
+#include <string>
+#include <stdexcept>
+
+// mij = Nij + 2*Mij
+static int mValue(int value) {
+    if (value < 0 || value > 3) throw std::runtime_error("Invalid value in column constraints: " + std::to_string(value));
+    return value / 2 + 2 * (value % 2);
+}
+
+static uint8_t columnStep(uint8_t s, int m) {
+    return uint8_t(((s + m) & 3) | ((s & 4) ^ ((m == 3) ? 4 : 0)));
+}
+
+static uint8_t pairStep(int m1, int m2) {
+    return uint8_t(((m1 * m2) & 1) | ((m1 != 0 && m2 != 0 && m1 != m2) ? 2 : 0));
+}
+
+columnConstraints::columnConstraints(const std::vector<std::vector<std::vector<int>>> &possibleValues) {
+    if (possibleValues.size() != SIZE) throw std::runtime_error("Column constraints need 6 rows of possible values");
+    columnReach.resize(SIZE + 1);
+    pairReach.resize(SIZE + 1);
+    for (int c = 0; c < SIZE; c++) {
+        columnReach[SIZE][c] = 1;
+        for (int c2 = 0; c2 < SIZE; c2++) pairReach[SIZE][c][c2] = 1;
+    }
+    for (int r = SIZE - 1; r >= 0; r--) {
+        if (possibleValues[r].size() != SIZE) throw std::runtime_error("Column constraints need 6 columns of possible values");
+        for (int c = 0; c < SIZE; c++) {
+            uint8_t reach = 0;
+            for (int value : possibleValues[r][c]) {
+                int m = mValue(value);
+                for (int s = 0; s < 8; s++) {
+                    if ((columnReach[r+1][c] >> s) & 1) reach |= 1 << columnStep(s, m);
+                }
+            }
+            columnReach[r][c] = reach;
+        }
+        for (int c1 = 0; c1 < SIZE; c1++) {
+            for (int c2 = c1 + 1; c2 < SIZE; c2++) {
+                uint8_t reach = 0;
+                for (int v1 : possibleValues[r][c1]) {
+                    for (int v2 : possibleValues[r][c2]) {
+                        uint8_t step = pairStep(mValue(v1), mValue(v2));
+                        for (int s = 0; s < 4; s++) {
+                            if ((pairReach[r+1][c1][c2] >> s) & 1) reach |= 1 << (s ^ step);
+                        }
+                    }
+                }
+                pairReach[r][c1][c2] = reach;
+            }
+        }
+    }
+    leaves.assign(SIZE * SIZE + 1, 1);
+    for (int p = SIZE * SIZE - 1; p >= 0; p--) {
+        uint64_t count = possibleValues[p / SIZE][p % SIZE].size();
+        uint64_t below = leaves[p + 1];
+        leaves[p] = (count != 0 && below > std::numeric_limits<uint64_t>::max() / count) ? std::numeric_limits<uint64_t>::max() : below * count;
+    }
+}
+
+void columnConstraints::add(state &s, int col, int value, const std::vector<int> &row) {
+    int m = mValue(value);
+    s.columns[col] = columnStep(s.columns[col], m);
+    for (int c = 0; c < col; c++) s.pairs[c][col] ^= pairStep(mValue(row[c]), m);
+}
+
+bool columnConstraints::canFinish(const state &s, int row, int col) const {
+    // What the rows below have to add to bring the column back to 0
+    uint8_t needed = uint8_t(((4 - (s.columns[col] & 3)) & 3) | (s.columns[col] & 4));
+    if (((columnReach[row+1][col] >> needed) & 1) == 0) return false;
+    for (int c = 0; c < col; c++) {
+        if (((pairReach[row+1][c][col] >> s.pairs[c][col]) & 1) == 0) return false;
+    }
+    return true;
+}
@@ -0,0 +1,46 @@
+#ifndef COLUMN_CONSTRAINTS_HPP
+#define COLUMN_CONSTRAINTS_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Column rules for a pattern that is filled in one entry at a time, row by row
+//  The entries that are set leave a partial state for every column and column pair
+//  and the possible values of the entries that are left say which states they can still reach
+// The rules are the column half of patternMatrix::isNormalized / isOrthogonal with mij = Nij + 2*Mij:
+//  column c        -> Σ mij (mod 4) and the count of 3s (mod 2) both end up 0
+//  columns c1 < c2 -> the dot product (mod 2) and the count of (1,2), (1,3), (2,3) pairs (mod 2) both end up 0
+// Every column and pair is checked on its own so this can miss a dead branch but never cuts a live one
+//  Once a column is complete its checks are exact
+class columnConstraints {
+    public:
+        static constexpr int SIZE = 6;
+
+        struct state {
+            std::array<uint8_t, SIZE> columns{};  // Σ mij (mod 4) in bits 0-1, the 3s parity in bit 2
+            std::array<std::array<uint8_t, SIZE>, SIZE> pairs{};  // [c1][c2] with c1 < c2 -> dot product parity in bit 0, mixed pair parity in bit 1
+        };
+
+        columnConstraints() = default;
+        explicit columnConstraints(const std::vector<std::vector<std::vector<int>>> &possibleValues);
+
+        // Adds [row][col] = value, row holds the values already set for the columns before col
+        //  Pairs are updated by the later column of the pair so both entries are known
+        static void add(state &s, int col, int value, const std::vector<int> &row);
+        // false once the entries below [row][col] can't fix column col or its pairs with the columns before it
+        bool canFinish(const state &s, int row, int col) const;
+        // Number of complete patterns below an entry, saturates at UINT64_MAX
+        uint64_t leavesAfter(int row, int col) const { return leaves[row * SIZE + col + 1]; }
+
+    private:
+        // columnReach[r][c] -> bit s is set when rows r-5 of column c can add up to column state s
+        //  pairReach[r][c1][c2] is the same for pair states
+        //  Row 6 is the empty set of rows which only reaches state 0
+        std::vector<std::array<uint8_t, SIZE>> columnReach;
+        std::vector<std::array<std::array<uint8_t, SIZE>, SIZE>> pairReach;
+        // leaves[p] -> product of the number of possible values for positions p-35
+        std::vector<uint64_t> leaves;
+};
+
+#endif // COLUMN_CONSTRAINTS_HPP
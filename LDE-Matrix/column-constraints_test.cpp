@@ -0,0 +1,105 @@
+#include "column-constraints.hpp"
+#include "packed-matrix.hpp"
+
+#include <gtest/gtest.h>
+
+using valueGrid = std::vector<std::vector<int>>;
+
+static std::vector<std::vector<std::vector<int>>> fixedValues(const valueGrid &pattern) {
+    std::vector<std::vector<std::vector<int>>> possibleValues(6, std::vector<std::vector<int>>(6));
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) possibleValues[r][c] = {pattern[r][c]};
+    }
+    return possibleValues;
+}
+
+// First entry, in row order, where the constraints give up on the pattern or -1 when they never do
+static int firstCut(const columnConstraints &rules, const valueGrid &pattern) {
+    columnConstraints::state s;
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) {
+            columnConstraints::add(s, c, pattern[r][c], pattern[r]);
+            if (!rules.canFinish(s, r, c)) return r * 6 + c;
+        }
+    }
+    return -1;
+}
+
+static bool columnsPass(const valueGrid &pattern) {
+    packedMatrix pm;
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) pm.set(r, c, pattern[r][c]);
+    }
+    return pm.colNormalizationFailures() == 0 && pm.colOrthogonalityFailures() == 0;
+}
+
+valueGrid ORTHONORMAL = {
+    {0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 1, 1},
+    {0, 0, 0, 1, 2, 2},
+    {0, 0, 0, 1, 2, 2}
+};
+
+TEST(ColumnConstraintsTest, FixedValues) {
+    EXPECT_EQ(firstCut(columnConstraints(fixedValues(ORTHONORMAL)), ORTHONORMAL), -1);
+
+    // With nothing left to choose the broken column is known from its very first entry
+    valueGrid broken = ORTHONORMAL;
+    broken[3][4] = 3;
+    EXPECT_EQ(firstCut(columnConstraints(fixedValues(broken)), broken), 4);
+
+    columnConstraints rules(fixedValues(ORTHONORMAL));
+    EXPECT_EQ(rules.leavesAfter(0, 0), 1);
+    EXPECT_EQ(rules.leavesAfter(5, 5), 1);
+}
+
+// Rows 4 and 5 get 2 possible values in every entry, every one of the 4096 ways to fill them is checked
+//  Patterns that pass the column rules are never cut and the ones that fail are cut by the end of the last row
+TEST(ColumnConstraintsTest, NeverCutsALivePattern) {
+    uint64_t seed = 0x2545F4914F6CDD1DULL;
+    auto next = [&seed]() {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        return seed;
+    };
+    int live = 0;
+    for (int round = 0; round < 20; round++) {
+        // Odd rounds start from a pattern whose columns pass so some of the 4096 are alive
+        valueGrid base(6, std::vector<int>(6));
+        std::vector<std::vector<std::vector<int>>> possibleValues(6, std::vector<std::vector<int>>(6));
+        for (int r = 0; r < 6; r++) {
+            for (int c = 0; c < 6; c++) {
+                base[r][c] = (round % 2 == 1) ? ORTHONORMAL[r][c] : next() % 4;
+                possibleValues[r][c] = {base[r][c]};
+                if (r >= 4) possibleValues[r][c].push_back((base[r][c] + 1 + next() % 3) % 4);
+            }
+        }
+        columnConstraints rules(possibleValues);
+        EXPECT_EQ(rules.leavesAfter(3, 5), 4096);
+        EXPECT_EQ(rules.leavesAfter(4, 0), 2048);
+        for (int choice = 0; choice < 4096; choice++) {
+            valueGrid pattern = base;
+            for (int bit = 0; bit < 12; bit++) pattern[4 + bit / 6][bit % 6] = possibleValues[4 + bit / 6][bit % 6][(choice >> bit) & 1];
+            bool passes = columnsPass(pattern);
+            int cut = firstCut(rules, pattern);
+            if (passes) {
+                live++;
+                EXPECT_EQ(cut, -1) << "Round " << round << " choice " << choice;
+            } else {
+                EXPECT_NE(cut, -1) << "Round " << round << " choice " << choice;
+            }
+        }
+    }
+    EXPECT_GT(live, 0);
+}
+
+TEST(ColumnConstraintsTest, Errors) {
+    std::vector<std::vector<std::vector<int>>> tooFew(5, std::vector<std::vector<int>>(6, {0}));
+    EXPECT_THROW(columnConstraints{tooFew}, std::runtime_error);
+    std::vector<std::vector<std::vector<int>>> badValue(6, std::vector<std::vector<int>>(6, {0}));
+    badValue[2][3] = {4};
+    EXPECT_THROW(columnConstraints{badValue}, std::runtime_error);
+}
@@ -0,0 +1,130 @@
+// Packs the pattern files into the constexpr arrays behind embedded-patterns.hpp
+//  Run by the embedded-patterns-generated genrule when the project is built:
+//    embed-patterns patterns928.txt patterns928-aligned.txt patterns785.txt patterns2704.txt > embedded-patterns-generated.hpp
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "LDE-Matrix/packed-matrix.hpp"
+#include "LDE-Matrix/pattern-parser.hpp"
+
+namespace {
+    struct filePattern {
+        int id = 0;
+        int caseMatch = -1;  // Only in patterns928-aligned.txt, the number between the id and the pattern
+        packedMatrix pattern;
+    };
+
+    // Patterns without an id are numbered by their place among the patterns in the file, from 1, the same as patternBatch::load
+    std::vector<filePattern> readPatterns(const std::string &fileName, bool withCase) {
+        std::ifstream file(fileName);
+        if (!file.is_open()) throw std::runtime_error("Error opening file: " + fileName);
+        std::vector<filePattern> patterns;
+        std::string line;
+        while (std::getline(file, line)) {
+            filePattern next;
+            next.id = int(patterns.size()) + 1;
+            if (!patternParser::parseLine(line, next.id, next.pattern)) continue;
+            if (withCase) {
+                std::istringstream prefix(line.substr(0, line.find('[')));
+                int id;
+                if (!(prefix >> id >> next.caseMatch)) throw std::runtime_error("Missing case in " + fileName + ": " + line);
+            }
+            if (next.id != int(patterns.size()) + 1) throw std::runtime_error("Patterns out of order in " + fileName + ": " + line);
+            patterns.push_back(next);
+        }
+        return patterns;
+    }
+
+    std::string packed(const packedMatrix &pattern) {
+        std::ostringstream os;
+        os << "packedMatrix(0x" << std::hex << pattern.nBits << "ULL, 0x" << pattern.mBits << "ULL)";
+        return os.str();
+    }
+
+    void writeFile(std::ostream &os, const std::string &name, const std::vector<filePattern> &patterns) {
+        os << "inline constexpr std::array<embeddedPattern, " << patterns.size() << "> " << name << " = {{\n";
+        for (const filePattern &p : patterns) {
+            os << "    {" << p.id << ", " << packed(p.pattern) << ", " << p.pattern.sum() << ", " << packed(p.pattern.orbitCanonical()) << "},\n";
+        }
+        os << "}};\n\n";
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 5) {
+        std::cerr << "Usage: " << argv[0] << " patterns928.txt patterns928-aligned.txt patterns785.txt patterns2704.txt" << std::endl;
+        return 1;
+    }
+    try {
+        std::vector<filePattern> patterns928 = readPatterns(argv[1], false);
+        std::vector<filePattern> aligned = readPatterns(argv[2], true);
+        std::vector<filePattern> patterns785 = readPatterns(argv[3], false);
+        std::vector<filePattern> patterns2704 = readPatterns(argv[4], false);
+        if (patterns928.size() != 928 || aligned.size() != 928 || patterns785.size() != 785 || patterns2704.size() != 2704) {
+            throw std::runtime_error("Wrong number of patterns in the pattern files");
+        }
+        // Rearranging a pattern to line up with its case can't change its sum or its canonical form
+        for (int i = 0; i < 928; i++) {
+            if (aligned[i].pattern.orbitCanonical() != patterns928[i].pattern.orbitCanonical()) {
+                throw std::runtime_error("Aligned pattern " + std::to_string(i + 1) + " isn't a rearrangement of the 928 pattern");
+            }
+        }
+
+        std::ostream &os = std::cout;
+        os << "// Generated by //LDE-Matrix:embed-patterns from the files in patterns/, don't edit\n";
+        os << "//  Only included by embedded-patterns.hpp\n";
+        os << "#ifndef LDE_MATRIX_EMBEDDED_PATTERNS_GENERATED_HPP\n";
+        os << "#define LDE_MATRIX_EMBEDDED_PATTERNS_GENERATED_HPP\n\n";
+        os << "inline constexpr std::array<embedded928Pattern, 928> EMBEDDED_928 = {{\n";
+        for (int i = 0; i < 928; i++) {
+            const packedMatrix &p = patterns928[i].pattern;
+            os << "    {" << (i + 1) << ", " << packed(p) << ", " << p.sum() << ", " << packed(p.orbitCanonical()) << ", "
+               << packed(aligned[i].pattern) << ", " << aligned[i].caseMatch << "},\n";
+        }
+        os << "}};\n\n";
+        // The order CASE_SUM_MAP_PATTERNS_928 used to be read in
+        std::vector<int> byCaseSum(928);
+        for (int i = 0; i < 928; i++) byCaseSum[i] = i + 1;
+        std::sort(byCaseSum.begin(), byCaseSum.end(), [&](int a, int b) {
+            return std::make_tuple(aligned[a - 1].caseMatch, aligned[a - 1].pattern.sum(), a) < std::make_tuple(aligned[b - 1].caseMatch, aligned[b - 1].pattern.sum(), b);
+        });
+        os << "inline constexpr std::array<int, 928> EMBEDDED_928_BY_CASE_SUM = {\n";
+        for (int i = 0; i < 928; i += 16) {
+            os << "   ";
+            for (int j = i; j < std::min(i + 16, 928); j++) os << " " << byCaseSum[j] << ",";
+            os << "\n";
+        }
+        os << "};\n\n";
+        // Every 928 pattern has its own canonical form, find928 binary searches these
+        std::vector<int> byCanonical(928);
+        for (int i = 0; i < 928; i++) byCanonical[i] = i + 1;
+        std::sort(byCanonical.begin(), byCanonical.end(), [&](int a, int b) {
+            return patterns928[a - 1].pattern.orbitCanonical() < patterns928[b - 1].pattern.orbitCanonical();
+        });
+        for (int i = 1; i < 928; i++) {
+            if (!(patterns928[byCanonical[i - 1] - 1].pattern.orbitCanonical() < patterns928[byCanonical[i] - 1].pattern.orbitCanonical())) {
+                throw std::runtime_error("Patterns " + std::to_string(byCanonical[i - 1]) + " and " + std::to_string(byCanonical[i]) + " are duplicates");
+            }
+        }
+        os << "inline constexpr std::array<int, 928> EMBEDDED_928_BY_CANONICAL = {\n";
+        for (int i = 0; i < 928; i += 16) {
+            os << "   ";
+            for (int j = i; j < std::min(i + 16, 928); j++) os << " " << byCanonical[j] << ",";
+            os << "\n";
+        }
+        os << "};\n\n";
+        writeFile(os, "EMBEDDED_785", patterns785);
+        writeFile(os, "EMBEDDED_2704", patterns2704);
+        os << "#endif // LDE_MATRIX_EMBEDDED_PATTERNS_GENERATED_HPP\n";
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
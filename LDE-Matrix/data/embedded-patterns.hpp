@@ -0,0 +1,47 @@
+#ifndef LDE_MATRIX_EMBEDDED_PATTERNS_HPP
+#define LDE_MATRIX_EMBEDDED_PATTERNS_HPP
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include "LDE-Matrix/packed-matrix.hpp"
+
+// A pattern from patterns785.txt or patterns2704.txt, packed when the project is built
+struct embeddedPattern {
+    int id;  // Line in the file, from 1
+    packedMatrix pattern;
+    int sum;
+    packedMatrix canonical;  // packedMatrix::orbitCanonical, the key dedupers compare
+};
+
+// A pattern from patterns928.txt along with its line in patterns928-aligned.txt
+struct embedded928Pattern {
+    int id;
+    packedMatrix pattern;
+    int sum;
+    packedMatrix canonical;
+    packedMatrix aligned;  // Rearranged so its case view lines up with caseMatch
+    int caseMatch;  // -1 when no rearrangement matches a case
+};
+
+// EMBEDDED_928, EMBEDDED_785 and EMBEDDED_2704 are in file order
+//  EMBEDDED_928_BY_CASE_SUM is the 928 ids ordered by case, then sum, then id
+//  EMBEDDED_928_BY_CANONICAL is the 928 ids ordered by canonical
+#include "LDE-Matrix/data/embedded-patterns-generated.hpp"
+
+// Numbered from 1 like the files, anything else throws std::out_of_range
+constexpr const embedded928Pattern& pattern928(int id) {
+    if (id < 1 || id > int(EMBEDDED_928.size())) throw std::out_of_range("No 928 pattern with that id");
+    return EMBEDDED_928[id - 1];
+}
+
+// The 928 pattern with this orbitCanonical, 0 when there isn't one
+constexpr int find928(const packedMatrix &canonical) {
+    auto it = std::lower_bound(EMBEDDED_928_BY_CANONICAL.begin(), EMBEDDED_928_BY_CANONICAL.end(), canonical,
+        [](int id, const packedMatrix &key) { return EMBEDDED_928[id - 1].canonical < key; });
+    if (it == EMBEDDED_928_BY_CANONICAL.end() || EMBEDDED_928[*it - 1].canonical != canonical) return 0;
+    return *it;
+}
+
+#endif // LDE_MATRIX_EMBEDDED_PATTERNS_HPP
@@ -1,2024 +0,0 @@
-#include <map>
-#include <string>
-
-#include "patterns928.hpp"
-
-
-std::map <int, std::string> PATTERNS_928 = {
-    {1, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0]"},
-    {2, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0]"},
-    {3, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0]"},
-    {4, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1]"},
-    {5, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {6, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {7, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0]"},
-    {8, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1]"},
-    {9, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1]"},
-    {10, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {11, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {12, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {13, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1]"},
-    {14, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {15, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {16, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {17, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1]"},
-    {18, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 0,0 1,0 1,0 0,0 1,0 1]"},
-    {19, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0]"},
-    {20, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1]"},
-    {21, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0]"},
-    {22, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 0,1 1,1 1]"},
-    {23, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {24, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1]"},
-    {25, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1]"},
-    {26, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 1,0 0]"},
-    {27, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 0,0 1,0 0,0 0,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0]"},
-    {28, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 0,0 1,0 0,0 0,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1]"},
-    {29, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0]"},
-    {30, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 1,1 1]"},
-    {31, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {32, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {33, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 1,1 0]"},
-    {34, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1]"},
-    {35, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 0,1 0]"},
-    {36, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {37, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,1 0,1 0,0 1,0 0,0 0][0 0,1 0,1 0,0 1,0 1,0 1]"},
-    {38, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0]"},
-    {39, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1][0 1,0 1,0 0,0 1,1 1,1 1]"},
-    {40, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {41, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {42, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {43, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 0,1 0,1 0][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 1,1 0]"},
-    {44, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {45, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 0,1 1,1 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 1,0 0]"},
-    {46, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 0,1 0,1 0,0 1,0 0,0 0][0 0,1 0,1 0,0 1,0 1,0 1]"},
-    {47, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {48, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {49, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {50, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {51, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0]"},
-    {52, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1]"},
-    {53, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 0,0 0,1 1,1 1,1 1,1 1]"},
-    {54, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {55, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {56, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {57, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {58, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {59, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 1,1 0]"},
-    {60, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1]"},
-    {61, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 1,0 0,0 0,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1]"},
-    {62, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 1,0 0,0 0,1 1,1 1][0 0,0 1,0 1,0 1,1 0,1 0]"},
-    {63, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {64, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {65, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {66, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {67, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {68, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {69, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {70, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 0,1 0]"},
-    {71, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {72, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {73, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 1,0 0,0 1,0 0]"},
-    {74, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {75, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {76, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {77, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {78, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 1,1 0][0 0,0 0,1 1,1 1,1 0,1 0]"},
-    {79, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,1 0,1 0,0 1][0 1,0 1,0 1,1 1,1 1,0 0]"},
-    {80, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,1 1,1 1,0 1][0 1,0 1,0 1,1 0,1 0,0 0]"},
-    {81, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {82, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {83, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {84, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {85, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {86, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {87, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {88, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][1 0,1 1,0 0,1 0,1 1,0 0][1 0,1 1,0 1,1 1,1 0,0 1]"},
-    {89, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][1 0,1 1,0 0,1 1,1 0,0 0][1 0,1 1,0 1,1 0,1 1,0 1]"},
-    {90, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {91, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {92, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {93, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0]"},
-    {94, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1]"},
-    {95, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0]"},
-    {96, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1][0 1,0 0,0 1,0 1,1 1,1 1]"},
-    {97, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {98, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1]"},
-    {99, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {100, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {101, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,0 1,0 1,1 0,1 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {102, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {103, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {104, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {105, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {106, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {107, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {108, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {109, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {110, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {111, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {112, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0]"},
-    {113, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1]"},
-    {114, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {115, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {116, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {117, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {118, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {119, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {120, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 0,0 1,0 0,0 0,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {121, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 0,0 1,0 0,0 0,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {122, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 1,0 0][0 0,1 0,1 0,0 1,0 1,0 1][0 0,1 0,1 0,0 1,0 1,0 1]"},
-    {123, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 1,0 0][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {124, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 1,0 0][0 1,1 0,1 0,0 1,0 1,0 0][0 1,1 0,1 0,0 1,0 1,0 0]"},
-    {125, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 0,0 1,0 1,0 0,0 0,0 0]"},
-    {126, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {127, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {128, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {129, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {130, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {131, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0]"},
-    {132, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0]"},
-    {133, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {134, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {135, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {136, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 0,1 0,0 0,0 0]"},
-    {137, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1]"},
-    {138, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,1 1,1 1,0 0,0 0][0 0,0 1,1 1,1 1,0 0,0 0]"},
-    {139, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,1 1,1 1,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1]"},
-    {140, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {141, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {142, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1]"},
-    {143, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 1,1 1,1 1,0 0,0 0][0 0,0 1,1 1,1 1,0 0,0 0]"},
-    {144, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 1,1 1,1 1,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1]"},
-    {145, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {146, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {147, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1]"},
-    {148, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {149, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {150, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1]"},
-    {151, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {152, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 0,0 1,0 0][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {153, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,0 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {154, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,0 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {155, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,0 0,0 1,0 1,0 0,0 1][1 0,1 1,0 1,0 1,1 1,1 0][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {156, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {157, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {158, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {159, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {160, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {161, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {162, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {163, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {164, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 0,0 0][0 0,0 1,0 1,0 0,0 1,0 1]"},
-    {165, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 1,0 1][0 0,0 1,0 1,0 0,0 0,0 0]"},
-    {166, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {167, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {168, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {169, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1]"},
-    {170, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {171, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {172, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {173, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {174, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,0 0,0 1,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {175, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 0,1 0]"},
-    {176, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {177, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 0,1 0]"},
-    {178, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,1 1,1 1,0 1,1 1,1 1][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {179, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 0,1 0,1 0,0 1,0 0,0 0][0 0,1 0,1 0,0 1,0 0,0 0]"},
-    {180, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 0,1 0,1 0,0 1,0 1,0 1][0 0,1 0,1 0,0 1,0 1,0 1]"},
-    {181, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 0,1 1,1 1,0 1,0 1,0 1][0 0,1 1,1 1,0 1,0 1,0 1]"},
-    {182, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,0 0,0 1,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {183, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0]"},
-    {184, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {185, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 0,0 1,0 1]"},
-    {186, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 1,0 1,0 0,0 1,0 1][0 0,1 0,1 0,0 1,0 0,0 0][0 0,1 0,1 0,0 1,0 0,0 0]"},
-    {187, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 1,0 1,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0]"},
-    {188, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {189, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {190, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {191, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {192, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {193, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {194, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {195, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {196, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {197, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {198, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1]"},
-    {199, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {200, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 1,0 1][0 0,0 1,0 1,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0]"},
-    {201, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 1,0 1][0 0,0 1,0 1,0 0,0 1,0 1][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0]"},
-    {202, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1]"},
-    {203, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1]"},
-    {204, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {205, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {206, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1]"},
-    {207, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1]"},
-    {208, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {209, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {210, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {211, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {212, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {213, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {214, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {215, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {216, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {217, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 1,1 0,1 0,1 1,0 1,0 1][1 1,1 0,1 0,1 1,0 1,0 1]"},
-    {218, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {219, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {220, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {221, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {222, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {223, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {224, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {225, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {226, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {227, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {228, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][1 1,1 1,1 0,1 0,0 0,0 0][1 1,1 1,1 0,1 0,0 0,0 0]"},
-    {229, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {230, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {231, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][1 0,1 1,1 0,0 0,1 1,0 0][1 0,1 1,1 0,0 0,1 1,0 0]"},
-    {232, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][1 0,1 1,1 0,0 1,1 1,0 1][1 0,1 1,1 0,0 1,1 1,0 1]"},
-    {233, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][1 0,1 1,1 1,0 0,1 0,0 0][1 0,1 1,1 1,0 0,1 0,0 0]"},
-    {234, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][1 0,1 1,1 1,0 1,1 0,0 1][1 0,1 1,1 1,0 1,1 0,0 1]"},
-    {235, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,1 1,1 1,1 1,1 1][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {236, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 0,0 0][1 0,0 1,0 1,1 1,1 0,1 1][1 0,0 1,0 1,1 1,1 0,1 1]"},
-    {237, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 0,0 0][1 1,0 1,0 1,1 0,1 0,1 1][1 1,0 1,0 1,1 0,1 0,1 1]"},
-    {238, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 1,0 1][1 0,0 1,0 1,1 0,0 0,0 1][1 0,0 1,0 1,1 0,0 0,0 1]"},
-    {239, "[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,0 0,0 1,0 1,0 1][1 0,0 1,0 1,1 0,0 0,0 1][1 0,0 1,0 1,1 0,0 0,0 1]"},
-    {240, "[0 0,0 0,0 0,0 0,0 0,1 0][0 0,0 0,0 0,0 0,1 0,0 0][0 0,0 0,0 0,1 0,0 0,0 0][0 0,0 0,1 0,0 0,0 0,0 0][0 0,1 0,0 0,0 0,0 0,0 0][1 0,0 0,0 0,0 0,0 0,0 0]"},
-    {241, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {242, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {243, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {244, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {245, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {246, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {247, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {248, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {249, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 0,0 1,0 0,0 1,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {250, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 0,0 1,0 0,0 1,0 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {251, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 0,0 1,0 0,0 1,0 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {252, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 0,0 1,0 0,0 1,0 0][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {253, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0]"},
-    {254, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {255, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,1 0,1 0,0 1,0 0,0 1][0 1,1 0,1 0,0 1,0 0,0 1]"},
-    {256, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,1 0,1 0,0 1,0 1,0 0][0 1,1 0,1 0,0 1,0 1,0 0]"},
-    {257, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {258, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {259, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {260, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0]"},
-    {261, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1][0 1,0 1,0 0,0 1,1 1,1 1]"},
-    {262, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {263, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,1 1,1 1,0 0,0 0,0 0][0 1,1 1,1 1,0 0,0 1,0 1]"},
-    {264, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {265, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {266, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {267, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0]"},
-    {268, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {269, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {270, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {271, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {272, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {273, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {274, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {275, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {276, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {277, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {278, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 1,1 0,1 1,0 0,0 0][1 0,1 1,1 0,1 1,0 0,0 0]"},
-    {279, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {280, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {281, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {282, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {283, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,0 0,0 1]"},
-    {284, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 1,0 0][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0]"},
-    {285, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 1,0 0][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 1,1 1]"},
-    {286, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 1,0 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {287, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 1,0 0][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {288, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 1,1 1,0 1,0 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {289, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 1,1 1,0 1,0 0][0 1,0 1,1 0,1 0,0 1,0 0][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {290, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 1,1 1,0 1,0 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1]"},
-    {291, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 1,1 1,0 1,0 0][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {292, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 1,0 0,1 0,1 0,0 0,0 0][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {293, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {294, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 1,0 0,1 1,1 1,0 0,0 0][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {295, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 1,0 0,1 1,1 1,0 1,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {296, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {297, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 1,1 1,0 0,0 0][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {298, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {299, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 1,1 1,0 0,0 0][0 1,0 0,1 1,1 1,0 0,0 0][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {300, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 1,1 1,0 0,0 0][0 1,0 0,1 1,1 1,0 1,0 1][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {301, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {302, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1][1 0,1 0,0 0,0 0,0 1,0 0][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {303, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 1,0 1,1 1,1 1,0 0,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {304, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 1,0 1,1 1,1 1,0 0,0 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {305, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {306, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {307, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {308, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {309, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {310, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {311, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {312, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {313, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {314, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {315, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {316, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {317, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {318, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {319, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {320, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1]"},
-    {321, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {322, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {323, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {324, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {325, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {326, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {327, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {328, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][1 1,1 1,1 0,1 0,0 0,0 0][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {329, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 1,1 1,0 0,0 0]"},
-    {330, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {331, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {332, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {333, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {334, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {335, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {336, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {337, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {338, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {339, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {340, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {341, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {342, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][1 1,1 1,1 0,1 0,0 0,0 0][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {343, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 1,1 1,0 0,0 0]"},
-    {344, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {345, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {346, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 0,1 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {347, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 0,1 1][0 1,0 1,1 0,1 0,0 1,0 0][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {348, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 0,1 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {349, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1]"},
-    {350, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {351, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 1,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {352, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 1,1 0][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 1,1 0,1 0,1 1]"},
-    {353, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0][1 0,1 1,0 0,0 0,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {354, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0][1 0,1 1,0 0,0 0,1 1,1 0][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {355, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1][1 0,1 1,1 0,1 1,0 0,0 0][1 0,1 1,1 1,1 0,0 1,0 1]"},
-    {356, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 1,1 0,0 0,0 0]"},
-    {357, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 0,0 1][1 0,1 0,0 0,0 0,0 1,0 0][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {358, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {359, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {360, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {361, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,0 0,0 1,0 1,0 1,0 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {362, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,0 0,0 1,0 1,0 1,0 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {363, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,0 0,0 1,0 1,0 1,0 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {364, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,0 0,0 1,0 1,0 1,0 0][1 0,1 1,0 1,0 1,1 1,1 0][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {365, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0]"},
-    {366, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1][0 1,0 0,0 1,0 1,1 1,1 1]"},
-    {367, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {368, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1]"},
-    {369, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {370, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,0 0,0 1][1 1,1 1,0 1,0 1,0 1,0 0]"},
-    {371, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {372, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,0 1,0 1,1 0,1 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {373, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 0,1 0,0 0,0 0][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1]"},
-    {374, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 0,1 0,0 0,0 0][0 1,0 0,1 1,1 1,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1]"},
-    {375, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 0,0 0][0 1,0 0,1 0,1 0,0 1,0 1]"},
-    {376, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 1,1 1,0 0,0 0][0 1,0 0,1 1,1 1,0 1,0 1]"},
-    {377, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {378, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {379, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 1,1 1,0 0,0 0][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1]"},
-    {380, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 0,1 0,1 0,0 0,0 0][0 1,0 0,1 1,1 1,0 1,0 1]"},
-    {381, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 1,1 1,0 0,0 0]"},
-    {382, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {383, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {384, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {385, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 1,0 0,1 0,1 0,0 0,0 0][1 0,1 0,0 0,0 1,0 1,0 1][1 0,1 0,0 1,0 0,0 1,0 1]"},
-    {386, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 0,0 0][0 1,0 0,1 1,1 1,0 0,0 0][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 1,1 0,0 1,0 1]"},
-    {387, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1]"},
-    {388, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1]"},
-    {389, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {390, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {391, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {392, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {393, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1]"},
-    {394, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {395, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1][1 0,1 0,0 0,0 1,0 1,0 1][1 0,1 0,0 1,0 0,0 1,0 1]"},
-    {396, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 0,0 0][1 0,1 1,1 1,1 0,0 0,0 0]"},
-    {397, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 1,1 0,0 1,0 1]"},
-    {398, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 1,1 1,0 0,0 0][0 1,0 0,1 0,1 0,0 0,0 0][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 1,1 0,0 1,0 1]"},
-    {399, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 1,1 1,0 0,0 0][0 1,0 0,1 1,1 1,0 0,0 0][1 0,1 0,0 0,0 1,0 1,0 1][1 0,1 0,0 1,0 0,0 1,0 1]"},
-    {400, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1][1 0,1 1,1 0,1 1,0 0,0 0][1 0,1 1,1 1,1 0,0 0,0 0]"},
-    {401, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 1,1 0,0 1,0 1]"},
-    {402, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 0,1 1,1 1,0 1,0 1][1 0,1 0,0 0,0 1,0 1,0 1][1 0,1 0,0 1,0 0,0 1,0 1]"},
-    {403, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {404, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {405, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {406, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {407, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {408, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {409, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {410, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {411, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {412, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {413, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {414, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {415, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {416, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {417, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {418, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {419, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {420, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {421, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {422, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {423, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1]"},
-    {424, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {425, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {426, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {427, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {428, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {429, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 1,1 0,0 1,0 1]"},
-    {430, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {431, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {432, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {433, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {434, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 0,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 1,1 0,1 1,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {435, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 0,0 0,0 1,0 1,0 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {436, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 0,0 1,0 0,0 0,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,0 1,0 0][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {437, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 0,0 0,0 1][1 0,1 0,0 1,0 1,0 1,0 0][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {438, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 1,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,0 1,0 1,1 0,1 0,1 0][1 0,0 1,0 1,1 0,1 0,1 0]"},
-    {439, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 1,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,0 1,0 1,1 0,1 1,1 1][1 0,0 1,0 1,1 0,1 1,1 1]"},
-    {440, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 1,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,0 1,0 1,1 1,1 1,1 0][1 0,0 1,0 1,1 1,1 1,1 0]"},
-    {441, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,1 0,1 0,0 1,0 1,0 1][0 0,1 0,1 0,0 1,0 1,0 1][0 1,0 0,0 0,0 0,0 0,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {442, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,1 0,1 0,0 1,0 1,0 1][0 0,1 0,1 0,0 1,0 1,0 1][0 1,0 0,0 0,0 0,0 1,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {443, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,0 0,0 1][0 0,1 0,1 0,0 1,0 1,0 1][0 0,1 0,1 0,0 1,0 1,0 1][0 1,0 0,0 0,0 1,0 1,0 1][0 1,0 1,0 1,0 0,0 0,0 1]"},
-    {444, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,0 0,0 1,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {445, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0]"},
-    {446, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {447, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 0,0 1,0 1]"},
-    {448, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 0,1 0]"},
-    {449, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {450, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 0,1 0]"},
-    {451, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 1,0 1,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0]"},
-    {452, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {453, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {454, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {455, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {456, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {457, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {458, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 0,0 0][0 1,0 0,0 0,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {459, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 0,0 0][0 1,0 0,0 0,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {460, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 0,0 0][0 1,0 0,0 0,0 1,0 1,0 1][1 0,1 1,1 1,1 0,0 1,0 1][1 0,1 1,1 1,1 0,0 1,0 1]"},
-    {461, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 1,0 1][0 0,0 1,0 1,0 0,0 1,0 1][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0]"},
-    {462, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1]"},
-    {463, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {464, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {465, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1]"},
-    {466, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {467, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {468, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {469, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {470, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {471, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {472, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {473, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {474, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {475, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {476, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 0,0 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 1,1 0,1 0,1 1,0 1,0 1][1 1,1 0,1 0,1 1,0 1,0 1]"},
-    {477, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {478, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {479, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {480, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,0 0,0 1]"},
-    {481, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {482, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {483, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {484, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {485, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,1 0,1 1,0 0,0 0][1 0,1 1,1 0,1 1,0 0,0 0]"},
-    {486, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {487, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {488, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {489, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {490, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,0 0,0 1][0 1,0 0,0 1,0 1,0 1,0 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {491, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,0 0,0 1][0 1,0 0,0 1,0 1,0 1,0 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {492, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,0 0,0 1][0 1,0 0,0 1,0 1,0 1,0 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {493, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,0 0,0 1][0 1,0 0,0 1,0 1,0 1,0 0][1 0,1 1,0 1,0 1,1 1,1 0][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {494, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 0,0 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0]"},
-    {495, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 1,0 1][0 1,0 0,0 0,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {496, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 1,0 1][0 1,0 0,0 0,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {497, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 1,0 1][0 1,0 0,0 0,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {498, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 1,0 1][0 1,0 0,0 0,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {499, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {500, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {501, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {502, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {503, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {504, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {505, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {506, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {507, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {508, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {509, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {510, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {511, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1]"},
-    {512, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {513, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {514, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {515, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {516, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {517, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {518, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0]"},
-    {519, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1]"},
-    {520, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {521, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {522, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {523, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,0 1,0 1,1 1,1 1]"},
-    {524, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {525, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {526, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {527, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {528, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 1,1 1,1 0,1 0,0 0,0 0][1 1,1 1,1 0,1 0,0 0,0 0]"},
-    {529, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {530, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {531, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1]"},
-    {532, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {533, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {534, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {535, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,0 1,0 1,1 1,1 1]"},
-    {536, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 1,1 0,1 1,0 0,0 0][1 0,1 1,1 0,1 1,0 0,0 0]"},
-    {537, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {538, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 1,1 1,1 0,0 0,0 0][1 0,1 1,1 1,1 0,0 0,0 0]"},
-    {539, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 1,1 1,1 0,0 1,0 1][1 0,1 1,1 1,1 0,0 1,0 1]"},
-    {540, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,0 0,0 0,1 0,1 1][1 0,1 1,0 0,0 0,1 0,1 1]"},
-    {541, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,0 0,0 0,1 1,1 0][1 0,1 1,0 0,0 0,1 1,1 0]"},
-    {542, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {543, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 1,1 0][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {544, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0]"},
-    {545, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1]"},
-    {546, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 1,1 1,1 1,1 1][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {547, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,1 1,1 1,1 1,1 1][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0]"},
-    {548, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 1,0 0][0 1,0 0,0 0,0 1,0 1,0 1][1 0,0 1,0 1,1 0,1 0,1 0][1 0,0 1,0 1,1 0,1 0,1 0]"},
-    {549, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 1,0 0][0 1,0 0,0 0,0 1,0 1,0 1][1 0,0 1,0 1,1 0,1 1,1 1][1 0,0 1,0 1,1 0,1 1,1 1]"},
-    {550, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 0,0 1,0 1,0 1,0 1,0 0][0 1,0 0,0 0,0 1,0 1,0 1][1 0,0 1,0 1,1 1,1 0,1 1][1 0,0 1,0 1,1 1,1 0,1 1]"},
-    {551, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,0 0,0 0,0 0,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {552, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,0 0,0 0,0 1,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {553, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,0 1,0 1,0 0,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {554, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 0,0 1,0 1,0 1,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {555, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,0 0,0 1][0 1,0 0,0 1,0 1,0 0,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,0 1,0 0][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {556, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 0,0 0][1 0,0 1,0 1,1 0,0 0,0 1][1 0,0 1,0 1,1 0,0 0,0 1]"},
-    {557, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 1,0 1][1 0,0 1,0 1,1 1,1 0,1 1][1 0,0 1,0 1,1 1,1 0,1 1]"},
-    {558, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 1,0 1][1 1,0 1,0 1,1 0,1 0,1 1][1 1,0 1,0 1,1 0,1 0,1 1]"},
-    {559, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,0 0,0 1,0 0,0 0][1 0,0 1,0 1,1 0,0 0,0 1][1 0,0 1,0 1,1 0,0 0,0 1]"},
-    {560, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 1,1 0,1 1,0 0,0 0][1 0,1 1,1 0,1 1,0 0,0 0]"},
-    {561, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {562, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 1,1 0,1 0,1 1,0 0,0 0][1 1,1 0,1 0,1 1,0 0,0 0]"},
-    {563, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][1 1,1 0,1 0,1 1,0 1,0 1][1 1,1 0,1 0,1 1,0 1,0 1]"},
-    {564, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 1,0 1,0 1][1 0,1 0,0 0,0 1,0 1,0 1]"},
-    {565, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 1,0 0,0 0][1 0,1 0,0 0,0 1,0 0,0 0]"},
-    {566, "[0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 0,0 1,1 1,1 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 1,0 1,0 1][1 0,1 0,0 0,0 1,0 1,0 1]"},
-    {567, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {568, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {569, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {570, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {571, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {572, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {573, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {574, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {575, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {576, "[0 0,0 0,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {577, "[0 0,0 0,0 0,0 0,1 0,1 0][0 0,0 0,0 0,0 0,1 0,1 0][0 0,0 0,0 0,0 1,0 0,0 0][0 0,0 0,0 1,0 0,0 0,0 0][0 0,0 1,0 0,0 0,0 0,0 0][0 1,0 0,0 0,0 0,0 0,0 0]"},
-    {578, "[0 0,0 0,0 0,0 0,1 0,1 0][0 0,0 0,0 0,0 0,1 0,1 0][0 0,0 0,1 0,1 0,0 0,0 0][0 0,0 0,1 0,1 0,0 0,0 0][0 0,0 1,0 0,0 0,0 0,0 0][0 1,0 0,0 0,0 0,0 0,0 0]"},
-    {579, "[0 0,0 0,0 0,0 0,1 0,1 0][0 0,0 0,0 0,0 0,1 0,1 0][0 0,0 0,1 0,1 0,0 0,0 0][0 0,0 0,1 0,1 0,0 0,0 0][1 0,1 0,0 0,0 0,0 0,0 0][1 0,1 0,0 0,0 0,0 0,0 0]"},
-    {580, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {581, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {582, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {583, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {584, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 0,0 0][0 1,0 0,0 0,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {585, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 0,0 0][0 1,0 0,0 0,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {586, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 0,0 0][0 1,0 0,0 1,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {587, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 0,0 1,0 1,0 1][0 1,0 0,0 1,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {588, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,0 0,0 1,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {589, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {590, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {591, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {592, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,0 1,0 1,1 1,1 1]"},
-    {593, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 0,0 0,0 0][1 0,1 0,0 1,0 0,0 0,0 0]"},
-    {594, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 0,0 1,0 1][1 0,1 0,0 1,0 0,0 1,0 1]"},
-    {595, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 1,1 1,0 1,0 0,0 1,0 1][1 1,1 1,0 1,0 0,0 1,0 1]"},
-    {596, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 0,0 0,0 0][0 1,0 0,0 1,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {597, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 0,0 0,0 0][1 0,1 0,0 1,0 0,0 0,0 0]"},
-    {598, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 0,0 1,0 1][1 0,1 0,0 1,0 0,0 1,0 1]"},
-    {599, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 1,1 1,0 1,0 0,0 1,0 1][1 1,1 1,0 1,0 0,0 1,0 1]"},
-    {600, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {601, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {602, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {603, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {604, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {605, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,1 1,1 0,1 0,1 1][0 0,0 0,1 1,1 0,1 0,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {606, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {607, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][1 0,0 1,0 1,1 1,1 0,1 1][1 0,0 1,0 1,1 1,1 0,1 1]"},
-    {608, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][1 1,0 1,0 1,1 0,1 0,1 1][1 1,0 1,0 1,1 0,1 0,1 1]"},
-    {609, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,0 1,0 1,1 0,0 0,0 1][1 0,0 1,0 1,1 0,0 0,0 1]"},
-    {610, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 0,0 1,0 1,1 0,0 0,0 1][1 0,0 1,0 1,1 0,0 0,0 1]"},
-    {611, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,0 1,0 1,1 1,1 0,1 1][1 0,0 1,0 1,1 1,1 0,1 1]"},
-    {612, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 1,0 1,0 1,1 0,1 0,1 1][1 1,0 1,0 1,1 0,1 0,1 1]"},
-    {613, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,1 0,1 0,0 1,0 0,0 0][0 0,1 0,1 0,0 1,0 0,0 0][0 1,0 0,0 0,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {614, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,1 0,1 0,0 1,0 1,0 1][0 0,1 0,1 0,0 1,0 1,0 1][0 1,0 0,0 0,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {615, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 0,1 1,1 1,0 1,0 1,0 1][0 0,1 1,1 1,0 1,0 1,0 1][0 1,0 0,0 0,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {616, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {617, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {618, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {619, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {620, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {621, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {622, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {623, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1]"},
-    {624, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {625, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {626, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 1,0 1,0 0][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {627, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {628, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 1,0 1,0 0][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {629, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 0,1 0]"},
-    {630, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {631, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 1,1 1,0 1,1 1,1 1][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {632, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 0,1 0]"},
-    {633, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {634, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 0,1 0]"},
-    {635, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 1,1 1,0 1,1 1,1 1][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {636, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 0,0 1,0 1]"},
-    {637, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 0,0 1,0 1]"},
-    {638, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 0,1 0]"},
-    {639, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 1,1 1,1 1][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {640, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {641, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {642, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {643, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 1,0 0,0 1]"},
-    {644, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 1,1 1,0 0,0 0,0 0][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {645, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 1,1 1,0 0,0 0,0 0][0 1,1 1,1 1,0 1,1 0,1 0]"},
-    {646, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {647, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1][0 1,1 0,1 0,0 0,0 1,0 1][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 1,1 1,0 0,0 1,0 1][0 1,1 1,1 1,0 1,1 0,1 0]"},
-    {648, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 1,0 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {649, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {650, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {651, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {652, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {653, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {654, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 1,1 1,0 0,0 1][0 1,0 1,1 1,1 1,0 1,0 0]"},
-    {655, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 1,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {656, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {657, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {658, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {659, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {660, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {661, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {662, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 1,1 0,1 0][1 1,1 1,0 1,0 0,0 0,0 0][1 1,1 1,0 1,0 0,0 1,0 1]"},
-    {663, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {664, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {665, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {666, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {667, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {668, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {669, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {670, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {671, "[0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 1,1 1]"},
-    {672, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 0,0 0,0 0][1 0,1 0,0 1,0 0,0 0,0 0]"},
-    {673, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][1 0,1 0,0 1,0 0,0 0,0 0][1 0,1 0,0 1,0 0,0 0,0 0]"},
-    {674, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 0,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {675, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 0,1 0,1 0,0 1,0 0,0 0][0 0,1 0,1 0,0 1,0 0,0 0][0 1,0 0,0 0,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {676, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 0,1 0]"},
-    {677, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {678, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 0,0 1,1 1,1 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 0,1 0]"},
-    {679, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 0,1 0,1 0][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 1,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {680, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {681, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {682, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 0,0 1,0 0,1 1,1 1][0 0,0 0,1 0,1 0,0 0,0 1][0 0,0 0,1 0,1 0,0 1,0 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {683, "[0 0,0 0,0 0,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,1 0,1 0,0 0,0 0,0 0][0 1,1 0,1 0,0 0,0 1,0 1]"},
-    {684, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,0 0,0 1][1 0,1 0,0 0,0 0,0 0,0 1]"},
-    {685, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {686, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {687, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,0 0,0 1][0 1,0 0,0 0,0 0,0 1,0 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {688, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,0 0,0 1][0 1,0 0,0 0,0 0,0 1,0 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {689, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,0 0,0 1][0 1,0 0,0 0,0 0,0 1,0 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {690, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,0 0,0 1][0 1,0 0,0 0,0 0,0 1,0 0][1 0,1 1,0 1,0 1,1 1,1 0][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {691, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,1 0,1 0][0 1,0 0,0 0,0 0,1 0,1 0][1 0,1 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {692, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,1 0,1 0][0 1,0 0,0 0,0 0,1 0,1 0][1 1,1 1,0 1,0 1,0 0,0 1][1 1,1 1,0 1,0 1,0 1,0 0]"},
-    {693, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,1 0,1 0][0 1,0 0,0 0,0 0,1 1,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {694, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 0,1 1,1 1][0 1,0 0,0 0,0 0,1 0,1 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {695, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {696, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][1 0,1 0,0 0,0 0,0 0,0 1][1 0,1 0,0 0,0 0,0 1,0 0]"},
-    {697, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][1 1,1 1,0 0,0 0,0 0,0 1][1 1,1 1,0 0,0 0,0 1,0 0]"},
-    {698, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {699, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {700, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {701, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {702, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {703, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {704, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {705, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 1,1 0,1 0][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {706, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {707, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 1,1 1,1 1][0 1,0 1,0 1,0 0,1 1,1 1][0 1,0 1,1 0,1 0,0 0,0 1][0 1,0 1,1 0,1 0,0 1,0 0]"},
-    {708, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {709, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {710, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {711, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {712, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {713, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {714, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {715, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 0,1 0,0 0,0 0][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {716, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,1 0,1 0,0 0,0 0]"},
-    {717, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 1,1 1,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,1 1,1 1,0 0,0 0]"},
-    {718, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {719, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,1 0,1 0,0 0,0 0]"},
-    {720, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 1,1 1,0 0,0 0][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {721, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 1,0 1,0 1][1 0,1 1,1 0,0 1,0 1,1 1][1 1,1 0,1 0,0 1,0 1,1 1][1 1,1 1,0 1,0 1,0 1,0 0]"},
-    {722, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 0,0 1,0 1,0 1][1 0,1 1,1 1,0 1,0 1,1 0][1 1,1 0,1 1,0 1,0 1,1 0][1 1,1 1,0 1,0 1,0 1,0 0]"},
-    {723, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {724, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {725, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {726, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {727, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,0 1,0 1,1 1,1 1]"},
-    {728, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {729, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 1,1 1]"},
-    {730, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 1,0 1,0 1,1 0,1 1][1 1,1 0,0 1,0 1,1 0,1 1][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {731, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 1,0 1,0 1,1 0,1 1][1 1,1 0,0 1,0 1,1 1,1 0][1 1,1 1,0 1,0 1,1 1,1 1]"},
-    {732, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {733, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {734, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {735, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 1,1 0,0 1,0 1,1 1,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {736, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 1,0 0,0 0,1 0,1 1][1 0,1 1,1 0,1 1,0 0,0 0][1 1,1 0,0 1,0 1,1 0,1 1][1 1,1 0,1 0,1 1,0 1,0 1]"},
-    {737, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 1,0 0,0 0,1 0,1 1][1 0,1 1,1 0,1 1,0 1,0 1][1 1,1 0,0 1,0 1,1 0,1 1][1 1,1 0,1 0,1 1,0 0,0 0]"},
-    {738, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {739, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {740, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 1,1 0,0 1,0 1,1 0,1 1][1 1,1 0,0 1,0 1,1 0,1 1]"},
-    {741, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 1,1 0,0 1,0 1,1 1,1 0][1 1,1 0,0 1,0 1,1 1,1 0]"},
-    {742, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 0,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0][1 1,1 0,0 1,0 1,1 0,1 1][1 1,1 0,0 1,0 1,1 1,1 0]"},
-    {743, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {744, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 1,0 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {745, "[0 0,0 0,0 1,0 1,0 1,0 1][0 0,0 1,0 0,0 1,0 1,0 1][0 1,0 0,0 0,0 1,0 1,0 1][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 0,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {746, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {747, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {748, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1][1 0,1 1,1 0,1 1,0 1,0 1]"},
-    {749, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {750, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {751, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {752, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 0,1 1]"},
-    {753, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {754, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {755, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {756, "[0 0,0 0,0 1,0 1,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {757, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {758, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {759, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {760, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {761, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1]"},
-    {762, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {763, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {764, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {765, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,0 0,0 0,1 0,1 0][0 0,0 1,0 0,0 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {766, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,0 0,0 0,1 1,1 1][0 0,0 1,0 0,0 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {767, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {768, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {769, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {770, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {771, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {772, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {773, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {774, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {775, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {776, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {777, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {778, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {779, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {780, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {781, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {782, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {783, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {784, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {785, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {786, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 1,1 1,1 1,1 1,0 0,0 0][1 1,1 1,1 1,1 1,0 0,0 0]"},
-    {787, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {788, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {789, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {790, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {791, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {792, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {793, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 1,1 1,1 0,1 0,0 0,0 0][1 1,1 1,1 0,1 0,0 0,0 0]"},
-    {794, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {795, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 1,1 1,1 1,1 1,0 0,0 0][1 1,1 1,1 1,1 1,0 0,0 0]"},
-    {796, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {797, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {798, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 0,1 0][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {799, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 1,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {800, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 1,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {801, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 1,1 0][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1]"},
-    {802, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {803, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {804, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1]"},
-    {805, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {806, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {807, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {808, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {809, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {810, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {811, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {812, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {813, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {814, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {815, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {816, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {817, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {818, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {819, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0]"},
-    {820, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 0,1 0,0 0,0 0][1 1,1 1,0 0,0 0,1 1,1 1][1 1,1 1,1 1,1 1,0 0,0 0]"},
-    {821, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 0,0 0,1 1,1 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {822, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 1,1 1,0 1,0 1][1 1,1 1,0 0,0 0,1 1,1 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {823, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 1,1 1,0 0,0 0,1 0,1 0][1 1,1 1,1 1,1 1,0 0,0 0]"},
-    {824, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 0,0 0,1 0,1 0][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {825, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 1,1 1,0 0,0 0,1 0,1 0][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {826, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {827, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {828, "[0 0,0 0,1 0,1 0,1 0,1 0][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {829, "[0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1]"},
-    {830, "[0 0,0 0,1 0,1 0,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {831, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1]"},
-    {832, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {833, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {834, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1]"},
-    {835, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 1,0 0,0 0,1 0,1 0][0 0,0 1,0 0,0 0,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {836, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {837, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {838, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {839, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {840, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {841, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {842, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {843, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 0,1 0,1 1]"},
-    {844, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {845, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 1,0 0,0 1,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {846, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {847, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {848, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {849, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {850, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {851, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,1 0,1 0,0 1,0 1][1 1,1 1,1 0,1 0,0 1,0 1]"},
-    {852, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {853, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {854, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,0 1,0 1,1 1,1 1]"},
-    {855, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {856, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,0 1,0 1,1 1,1 1]"},
-    {857, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,1 1,1 1,0 0,0 0][1 0,1 0,1 1,1 1,0 0,0 0][1 1,1 1,0 0,0 0,1 0,1 0][1 1,1 1,0 0,0 0,1 0,1 0]"},
-    {858, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 1,1 1,0 0,0 0,1 0,1 0][1 1,1 1,0 0,0 0,1 0,1 0]"},
-    {859, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {860, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 1,0 0,1 0,0 0,1 1][1 0,1 1,0 0,1 0,0 0,1 1][1 1,1 0,1 1,0 1,1 0,0 1][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {861, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 1,0 0,1 1,0 0,1 0][1 0,1 1,0 0,1 1,0 0,1 0][1 0,1 1,1 1,0 0,1 0,0 0][1 0,1 1,1 1,0 0,1 0,0 0]"},
-    {862, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 1,0 0,1 1,0 0,1 0][1 0,1 1,0 0,1 1,0 0,1 0][1 1,1 0,1 1,0 0,1 0,0 0][1 1,1 0,1 1,0 0,1 0,0 0]"},
-    {863, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 1,0 0,1 1,0 0,1 0][1 0,1 1,0 0,1 1,0 0,1 0][1 1,1 0,1 1,0 1,1 0,0 1][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {864, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 1,0 1,1 0,0 1,1 1][1 0,1 1,0 1,1 0,0 1,1 1][1 1,1 0,1 0,0 1,1 1,0 1][1 1,1 0,1 0,0 1,1 1,0 1]"},
-    {865, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 1,0 1,1 1,0 1,1 0][1 0,1 1,0 1,1 1,0 1,1 0][1 1,1 0,1 0,0 1,1 1,0 1][1 1,1 0,1 0,0 1,1 1,0 1]"},
-    {866, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 0,1 1,1 1][1 0,1 1,0 1,1 1,0 1,1 0][1 0,1 1,0 1,1 1,0 1,1 0][1 1,1 0,1 1,0 1,1 0,0 1][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {867, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 1,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 0,0 0,0 0,0 0]"},
-    {868, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 1,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1]"},
-    {869, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 0,0 0,1 1,1 0,1 1,1 0][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 0,0 1,0 1,0 0][0 1,0 1,0 0,0 1,0 1,0 0]"},
-    {870, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 0,1 0,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {871, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {872, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,0 1,0 1,0 0][0 1,0 1,0 0,0 1,0 1,0 0][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {873, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,1 0,1 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,0 1,1 1,1 1,0 0]"},
-    {874, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 0,1 1,1 1,0 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,0 1,1 0,1 0,0 0]"},
-    {875, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {876, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1]"},
-    {877, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 0,1 1,1 0,1 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,0 1,0 0,0 0,0 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {878, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {879, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,0 0,0 1,0 0,0 1][0 1,0 1,1 0,1 1,1 1,1 0][0 1,0 1,1 1,1 0,1 0,1 1]"},
-    {880, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][1 0,1 1,0 0,1 0,0 0,1 1][1 0,1 1,1 0,0 0,1 1,0 0][1 1,1 0,0 0,1 1,0 0,1 0][1 1,1 0,1 1,0 0,1 0,0 0]"},
-    {881, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][1 0,1 1,0 0,1 0,0 0,1 1][1 0,1 1,1 0,0 1,1 1,0 1][1 1,1 0,0 0,1 1,0 0,1 0][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {882, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][1 0,1 1,0 0,1 1,0 0,1 0][1 0,1 1,1 0,0 0,1 1,0 0][1 1,1 0,0 0,1 0,0 0,1 1][1 1,1 0,1 1,0 0,1 0,0 0]"},
-    {883, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][1 0,1 1,0 0,1 1,0 0,1 0][1 0,1 1,1 0,0 1,1 1,0 1][1 1,1 0,0 0,1 0,0 0,1 1][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {884, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][1 0,1 1,0 1,1 0,0 1,1 1][1 0,1 1,1 0,0 1,1 1,0 1][1 1,1 0,0 1,1 1,0 1,1 0][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {885, "[0 0,0 0,1 0,1 0,1 1,1 1][0 0,0 0,1 1,1 1,1 0,1 0][1 0,1 1,0 1,1 1,0 1,1 0][1 0,1 1,1 0,0 1,1 1,0 1][1 1,1 0,0 1,1 0,0 1,1 1][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {886, "[0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0]"},
-    {887, "[0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][1 0,1 1,0 0,1 0,1 1,0 0][1 0,1 1,0 1,1 1,1 0,0 1]"},
-    {888, "[0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 1,1 0,1 1][1 0,1 1,0 0,1 1,1 0,0 0][1 0,1 1,0 1,1 0,1 1,0 1]"},
-    {889, "[0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {890, "[0 0,0 0,1 0,1 0,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 1,1 1,0 0,0 0]"},
-    {891, "[0 0,0 0,1 1,1 1,1 1,1 1][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,0 0,0 0,1 0,1 0][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {892, "[0 0,0 0,1 1,1 1,1 1,1 1][0 0,0 0,1 1,1 1,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,0 0,0 0,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 0,1 0,0 0,0 0]"},
-    {893, "[0 0,0 0,1 1,1 1,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,1 0,1 0,0 0,0 0][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {894, "[0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {895, "[0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {896, "[0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,1 0,1 0,0 1,1 0,1 0][0 1,1 0,1 0,0 1,1 0,1 0]"},
-    {897, "[0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,1 0,1 0,0 1,1 1,1 1][0 1,1 0,1 0,0 1,1 1,1 1]"},
-    {898, "[0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 0,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,1 1,1 1,0 1,1 0,1 0][0 1,1 1,1 1,0 1,1 0,1 0]"},
-    {899, "[0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {900, "[0 0,0 1,0 1,0 1,1 0,1 0][0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {901, "[0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {902, "[0 0,0 1,0 1,0 1,1 0,1 0][0 1,0 0,0 1,0 1,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {903, "[0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 0,0 0][0 1,0 1,0 1,0 1,0 1,0 1]"},
-    {904, "[0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,1 0,1 0,0 1,0 1][0 0,0 1,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {905, "[0 0,0 1,0 1,0 1,1 1,1 1][0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 0,1 0,1 0,0 1,0 1][0 1,0 1,0 0,0 0,0 1,0 1][0 1,0 1,0 1,0 1,0 0,0 0]"},
-    {906, "[0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,0 1,0 1,1 0,1 0][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 1,0 1,0 1,1 0,1 1][1 0,1 1,0 1,0 1,1 1,1 0]"},
-    {907, "[0 0,0 1,0 1,0 1,1 1,1 1][0 1,0 0,0 1,0 1,1 1,1 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][1 0,1 0,0 1,0 1,0 0,0 1][1 0,1 0,0 1,0 1,0 1,0 0]"},
-    {908, "[0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0]"},
-    {909, "[0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1]"},
-    {910, "[0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {911, "[0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 0,1 1,1 1,1 0]"},
-    {912, "[0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1]"},
-    {913, "[0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {914, "[0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,0 1,0 1,0 1,0 1][0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 1,1 0,1 1][0 1,0 1,1 1,1 0,1 1,1 0][0 1,0 1,1 1,1 1,1 0,1 0]"},
-    {915, "[0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {916, "[0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {917, "[0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {918, "[0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 0,1 0,1 0,1 0][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 1,1 1,1 1,1 1,0 1,0 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {919, "[0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 1,0 1,1 1,1 1][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {920, "[0 1,0 1,1 0,1 0,1 0,1 0][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,1 1,1 1,0 1,0 1]"},
-    {921, "[0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,0 1,0 1,1 0,1 0][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1]"},
-    {922, "[0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-    {923, "[0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 0,1 1,1 1,0 1,0 1][1 0,1 0,1 1,1 1,0 1,0 1][1 1,1 1,0 1,0 1,1 0,1 0][1 1,1 1,0 1,0 1,1 0,1 0]"},
-    {924, "[0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 1,0 1,1 1,0 1,1 0][1 0,1 1,0 1,1 1,0 1,1 0][1 0,1 1,1 1,0 1,1 0,0 1][1 0,1 1,1 1,0 1,1 0,0 1]"},
-    {925, "[0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 0,1 0,1 1,1 1][1 0,1 1,0 1,1 1,0 1,1 0][1 0,1 1,0 1,1 1,0 1,1 0][1 1,1 0,1 1,0 1,1 0,0 1][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {926, "[0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][1 0,1 1,0 1,1 0,0 1,1 1][1 0,1 1,1 0,0 1,1 1,0 1][1 1,1 0,0 1,1 1,0 1,1 0][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {927, "[0 1,0 1,1 0,1 0,1 1,1 1][0 1,0 1,1 1,1 1,1 0,1 0][1 0,1 1,0 1,1 1,0 1,1 0][1 0,1 1,1 0,0 1,1 1,0 1][1 1,1 0,0 1,1 0,0 1,1 1][1 1,1 0,1 1,0 1,1 0,0 1]"},
-    {928, "[0 1,0 1,1 1,1 1,1 1,1 1][0 1,0 1,1 1,1 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,0 1,0 1,1 1,1 1][1 0,1 0,1 0,1 0,0 1,0 1][1 0,1 0,1 0,1 0,0 1,0 1]"},
-};
-
-
-// Patterns 928 in buckets based on their case match and then their sum
-//  Used for deduplication
-std::map <int, std::map <int, std::map <int, std::string>>> CASE_SUM_MAP_PATTERNS_928 = {
-    {-1, {
-        {12, {
-            {240, "[0,0,0,0,0,2][0,0,0,0,2,0][0,0,0,2,0,0][0,0,2,0,0,0][0,2,0,0,0,0][2,0,0,0,0,0]"},
-        }},
-    }},
-    {1, {
-        {12, {
-            {1, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {577, "[2,2,0,0,0,0][2,2,0,0,0,0][0,0,0,1,0,0][0,0,1,0,0,0][0,0,0,0,0,1][0,0,0,0,1,0]"},
-        }},
-        {16, {
-            {2, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {17, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,1,1,0,0][1,1,1,1,0,0]"},
-            {18, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,1,0,0,1][1,1,1,0,0,1]"},
-            {125, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][1,1,0,0,0,0][0,0,1,0,0,1][0,0,1,0,0,1]"},
-        }},
-        {18, {
-            {164, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,1,1,0,0][0,0,0,1,0,1][1,1,1,0,0,1]"},
-            {165, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,1,1,0,0][1,1,0,1,0,1][0,0,1,0,0,1]"},
-            {174, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,1,0,0,1][0,0,1,0,1,0][1,1,0,0,1,1]"},
-            {444, "[2,2,0,1,0,0][2,2,0,1,0,0][1,1,0,0,0,0][0,0,1,0,0,1][0,0,1,0,1,0][0,0,0,0,1,1]"},
-        }},
-        {20, {
-            {13, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {14, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,1,1][1,1,0,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {23, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,1,1,1,1][1,1,1,1,1,1]"},
-            {112, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][1,1,0,0,0,0]"},
-            {113, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1]"},
-            {114, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,1,1][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1]"},
-            {126, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][1,1,0,0,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {166, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,1,1,0,0][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {167, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,1,1,0,0][1,1,0,0,1,1][0,0,1,1,1,1]"},
-            {170, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][1,1,1,1,0,0][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {253, "[2,2,1,0,0,0][2,2,1,0,0,0][0,0,0,1,0,1][1,1,0,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {580, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,0,0][0,0,1,1,0,0][0,0,0,0,1,1][1,1,0,0,1,1]"},
-            {582, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,0,0][1,1,1,1,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {586, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,0,0][0,0,0,1,0,1][0,0,1,0,1,0][1,1,0,0,1,1]"},
-            {587, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,0,0][1,1,0,1,0,1][0,0,1,0,1,0][0,0,0,0,1,1]"},
-        }},
-        {22, {
-            {122, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,1,0,1][1,1,0,1,1,0][0,0,0,0,0,0][0,0,0,0,1,1]"},
-            {123, "[2,2,1,0,1,1][2,2,1,0,1,1][0,0,0,1,0,1][1,1,0,1,1,0][0,0,0,0,0,0][0,0,0,0,1,1]"},
-            {124, "[2,2,1,1,1,0][2,2,1,1,1,0][0,0,0,1,0,1][1,1,0,1,1,0][0,0,0,0,0,0][0,0,0,0,1,1]"},
-            {182, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][1,1,1,0,0,1][1,1,1,0,1,0][1,1,0,0,1,1]"},
-            {435, "[2,2,1,0,1,1][2,2,1,0,1,1][0,0,0,1,1,0][1,1,0,0,0,0][0,0,0,0,1,1][0,0,0,1,0,1]"},
-            {584, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,0,0][0,0,0,1,0,1][0,0,0,1,1,0][1,1,1,1,1,1]"},
-            {585, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,0,0][0,0,0,1,0,1][1,1,0,1,1,0][0,0,1,1,1,1]"},
-            {588, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,0,0][0,0,1,0,0,1][1,1,1,0,1,0][0,0,1,1,1,1]"},
-            {596, "[2,2,0,1,0,0][2,2,0,1,0,0][1,1,1,1,0,0][0,0,1,0,0,1][0,0,1,0,1,0][0,0,1,1,1,1]"},
-        }},
-        {24, {
-            {97, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0][0,0,1,1,1,1][1,1,1,1,1,1]"},
-            {127, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][1,1,0,0,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {131, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0][0,0,0,0,0,0][1,1,0,0,0,0]"},
-            {132, "[2,2,0,1,1,1][2,2,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0][0,0,0,0,0,0][1,1,0,0,0,0]"},
-            {156, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][1,1,0,0,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {158, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,0,0][0,0,0,0,1,1][0,0,1,1,0,0][1,1,1,1,1,1]"},
-            {159, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,0,0][0,0,0,0,1,1][0,0,1,1,1,1][1,1,1,1,0,0]"},
-            {171, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][1,1,1,1,0,0][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {204, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][1,1,1,1,0,0][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {244, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,1,1][1,1,0,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {254, "[2,2,1,0,1,1][2,2,1,0,1,1][0,0,0,1,0,1][1,1,0,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {255, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,1,0,1][1,1,0,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {256, "[2,2,1,1,1,0][2,2,1,1,1,0][0,0,0,1,0,1][1,1,0,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {267, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,1,1,0,0][1,1,1,1,0,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {389, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1][0,0,1,1,0,0][1,1,1,1,0,0]"},
-            {442, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,0,1,0,1][0,0,1,0,1,0][1,1,1,1,0,0]"},
-            {463, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][0,0,1,1,0,0][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {504, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,0,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {552, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,1,0,1][0,0,1,0,1,0][0,0,1,1,0,0]"},
-            {581, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,0,0][0,0,1,1,0,0][0,0,1,1,1,1][1,1,1,1,1,1]"},
-            {583, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,0,0][1,1,1,1,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {606, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,0,0,1][1,1,1,0,0,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-        }},
-        {26, {
-            {200, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,1,0,1][1,1,1,0,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {201, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,0,1,0,1][1,1,1,0,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {436, "[2,2,1,1,1,0][2,2,1,1,1,0][0,0,1,0,0,1][1,1,1,1,1,1][0,0,0,0,1,1][0,0,0,1,0,1]"},
-            {437, "[2,2,1,1,1,0][2,2,1,1,1,0][0,0,1,1,1,1][1,1,1,0,0,1][0,0,0,0,1,1][0,0,0,1,0,1]"},
-            {441, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,0,1,0,1][0,0,1,0,0,1][1,1,1,1,1,1]"},
-            {443, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,0,1,0,1][0,0,1,1,1,1][1,1,1,0,0,1]"},
-            {461, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,0,1,0,1][1,1,1,0,0,1][1,1,0,0,0,0][0,0,1,1,0,0]"},
-            {494, "[2,2,1,1,1,0][2,2,1,1,1,0][0,0,0,1,0,1][1,1,1,0,0,1][1,1,0,0,0,0][1,1,1,1,0,0]"},
-            {551, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,1,0,1][0,0,1,0,0,1][0,0,1,1,1,1]"},
-        }},
-        {28, {
-            {157, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][1,1,0,0,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {205, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][1,1,1,1,0,0][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {283, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,1,1,1,1][1,1,1,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {367, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0][0,0,1,1,1,1][1,1,1,1,1,1]"},
-            {390, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1][0,0,1,1,1,1][1,1,1,1,1,1]"},
-            {464, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][0,0,1,1,0,0][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {480, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,1,1,1,1][1,1,0,0,1,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {499, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,0,1,0,1][1,1,0,1,0,1][0,0,0,0,1,1][1,1,0,0,1,1]"},
-            {500, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][1,1,1,1,0,0][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {505, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {506, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {554, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,1,0,1][1,1,1,0,1,0][1,1,1,1,0,0]"},
-            {684, "[2,2,0,0,0,1][2,2,0,0,0,1][0,0,1,1,1,1][1,1,1,1,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {695, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0][0,0,0,0,1,1][1,1,0,0,1,1]"},
-            {744, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,1,0,0][1,1,0,1,0,1][0,0,1,0,1,0][1,1,0,0,1,1]"},
-        }},
-        {30, {
-            {553, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,1,0,1][1,1,1,0,0,1][1,1,1,1,1,1]"},
-            {555, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,1,0,0,1][1,1,1,1,1,1][0,0,0,0,1,1][1,1,0,1,0,1]"},
-            {743, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,1,0,0][1,1,0,1,0,1][0,0,0,1,1,0][1,1,1,1,1,1]"},
-            {745, "[2,2,1,0,1,1][2,2,1,0,1,1][1,1,0,1,1,0][1,1,1,1,0,0][1,1,0,1,0,1][0,0,1,1,1,1]"},
-        }},
-        {32, {
-            {507, "[2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][1,1,0,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {511, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1][0,0,0,0,1,1][1,1,0,0,1,1]"},
-            {620, "[2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {703, "[2,2,0,1,1,1][2,2,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0][0,0,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-        {36, {
-            {900, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-    }},
-    {2, {
-        {20, {
-            {3, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {7, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,0,0][2,2,1,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-        }},
-        {22, {
-            {27, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,0,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-        }},
-        {24, {
-            {4, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,0,1,0,0][3,3,0,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {5, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {8, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,0,0][3,3,1,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {9, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,0,0][3,3,1,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {10, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,0,0][2,2,1,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {19, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {21, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,1,1][2,2,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {29, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,1,1,1][2,2,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {54, "[2,2,0,0,0,1][2,2,0,0,0,1][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {55, "[2,2,0,0,0,1][2,2,0,0,0,1][2,2,0,0,1,0][2,2,0,0,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {140, "[2,2,0,0,0,1][2,2,0,0,0,1][2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {193, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {455, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,0,0][2,2,1,0,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-        }},
-        {26, {
-            {28, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,0,0,1][3,3,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {38, "[2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,1,0][2,2,0,1,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {120, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,0,0,1][2,2,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {142, "[2,2,0,0,0,1][2,2,0,0,1,0][2,2,0,1,0,0][2,2,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {292, "[2,2,0,0,0,1][2,2,0,1,0,0][2,2,1,0,0,0][2,2,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-        }},
-        {28, {
-            {6, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,0,1,0,0][3,3,0,1,0,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {11, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,0,0][3,3,1,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {12, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,0,0][3,3,1,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {15, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {20, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,1,0,1][3,3,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {22, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,1,1][3,3,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {24, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,1,0,1][3,3,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {25, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,1,1][3,3,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {30, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,1,1,1][3,3,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {34, "[2,2,0,1,0,0][3,3,1,0,0,0][2,2,0,1,1,1][3,3,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {35, "[2,2,0,1,0,0][3,3,1,0,0,0][3,3,0,1,1,1][2,2,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {48, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,0,0][2,2,1,0,0,0][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {71, "[2,2,0,0,0,1][2,2,0,0,0,1][3,3,0,0,0,1][3,3,0,0,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {72, "[2,2,0,0,0,1][2,2,0,0,0,1][3,3,0,0,1,0][3,3,0,0,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {73, "[2,2,0,0,0,1][2,2,0,0,1,0][3,3,0,0,0,1][3,3,0,0,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {93, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {95, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,1,0][2,2,1,1,1,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {115, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {118, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {128, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,0,0][2,2,1,0,0,0][1,1,0,1,0,1][1,1,0,1,0,1]"},
-            {141, "[2,2,0,0,0,1][2,2,0,0,0,1][2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {145, "[2,2,0,0,0,1][2,2,0,0,0,1][3,3,0,1,0,0][3,3,0,1,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {148, "[2,2,0,0,0,1][3,3,0,0,0,1][2,2,0,1,0,0][3,3,0,1,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {194, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {196, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,0,1,0,0][3,3,0,1,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {241, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,1,1][2,2,1,0,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {245, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {249, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,1,1,1][2,2,1,0,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {268, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,0,0][2,2,1,0,0,0][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {274, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,0,0][2,2,1,0,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {286, "[2,2,0,0,0,1][2,2,0,0,1,0][2,2,1,1,0,1][2,2,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {293, "[2,2,0,0,0,1][2,2,0,1,0,0][2,2,1,0,1,1][2,2,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {305, "[2,2,0,0,0,1][2,2,0,0,0,1][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {306, "[2,2,0,0,0,1][2,2,0,0,0,1][2,2,1,1,1,0][2,2,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {373, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,1,1][2,2,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {375, "[2,2,0,1,0,0][2,2,0,1,1,1][2,2,1,0,0,0][2,2,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {456, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,0,0][3,3,1,0,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {457, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,0,0][3,3,1,0,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {487, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-        }},
-        {30, {
-            {39, "[2,2,0,1,0,0][2,2,1,1,0,1][3,3,1,1,1,0][3,3,0,1,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {121, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,0,0,1][3,3,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {147, "[2,2,0,0,0,1][2,2,0,0,1,0][3,3,0,1,0,0][3,3,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {150, "[2,2,0,0,0,1][3,3,0,0,1,0][2,2,0,1,0,0][3,3,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {153, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,0,0,1][2,2,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {260, "[2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,1,0][2,2,0,1,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {294, "[2,2,0,0,0,1][2,2,0,1,0,0][3,3,1,0,0,0][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {296, "[2,2,0,0,0,1][2,2,0,1,1,1][2,2,1,0,1,1][2,2,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {299, "[2,2,0,0,0,1][3,3,0,1,0,0][3,3,1,0,0,0][2,2,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {377, "[2,2,0,1,0,0][2,2,0,1,1,1][2,2,1,1,0,1][2,2,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {458, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,0,0,1][2,2,1,1,0,1][1,1,0,1,1,0][1,1,0,1,1,0]"},
-            {495, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,0,0,1][2,2,1,1,0,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-        }},
-        {32, {
-            {16, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,0,1,0,0][3,3,0,1,0,0][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {49, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,0,0][3,3,1,0,0,0][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {50, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,0,0][3,3,1,0,0,0][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {94, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,0,1][3,3,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {96, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,1,0][3,3,1,1,1,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {98, "[2,2,1,1,0,1][3,3,1,1,0,1][2,2,1,1,1,0][3,3,1,1,1,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {116, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,1,0,1][3,3,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {117, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,1,0,1][3,3,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {119, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,0,1,0,0][3,3,0,1,0,0][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {129, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,0,0][3,3,1,0,0,0][1,1,0,1,0,1][1,1,0,1,0,1]"},
-            {130, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,0,0][3,3,1,0,0,0][1,1,0,1,0,1][1,1,0,1,0,1]"},
-            {133, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {146, "[2,2,0,0,0,1][2,2,0,0,0,1][3,3,0,1,1,1][3,3,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {149, "[2,2,0,0,0,1][3,3,0,0,0,1][2,2,0,1,1,1][3,3,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {188, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {190, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {195, "[2,2,0,1,1,1][2,2,0,1,1,1][2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {197, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,0,1,1,1][3,3,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {198, "[2,2,0,1,0,0][2,2,0,1,1,1][3,3,0,1,0,0][3,3,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {242, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,1,1][3,3,1,0,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {243, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,1,1][3,3,1,0,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {246, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {247, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,0,1,0,0][3,3,0,1,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {250, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,1,1,1][3,3,1,0,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {251, "[2,2,0,1,0,0][3,3,1,0,0,0][2,2,0,1,1,1][3,3,1,0,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {252, "[2,2,0,1,0,0][3,3,1,0,0,0][3,3,0,1,1,1][2,2,1,0,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {269, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,0,0][3,3,1,0,0,0][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {270, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,0,0][3,3,1,0,0,0][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {271, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,0,1,1,1][2,2,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {275, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,0,0][2,2,1,0,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {276, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,0,0][3,3,1,0,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {278, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,0,0][3,3,1,0,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {280, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,1,1][2,2,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {287, "[2,2,0,0,0,1][2,2,0,0,1,0][3,3,1,1,0,1][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {288, "[2,2,0,0,0,1][3,3,0,0,1,0][2,2,1,1,0,1][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {289, "[2,2,0,0,0,1][3,3,0,0,1,0][2,2,1,1,1,0][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {295, "[2,2,0,0,0,1][2,2,0,1,0,0][3,3,1,0,1,1][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {297, "[2,2,0,0,0,1][2,2,0,1,1,1][3,3,1,0,0,0][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {300, "[2,2,0,0,0,1][3,3,0,1,0,0][3,3,1,0,1,1][2,2,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {330, "[2,2,0,0,0,1][2,2,0,0,0,1][3,3,1,1,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {331, "[2,2,0,0,0,1][2,2,0,0,0,1][3,3,1,1,1,0][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {344, "[2,2,0,0,0,1][3,3,0,0,0,1][2,2,1,1,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {345, "[2,2,0,0,0,1][3,3,0,0,0,1][2,2,1,1,1,0][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {361, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,1,1,1][2,2,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {365, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,1,0][2,2,1,1,1,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {374, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,1,1][3,3,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {376, "[2,2,0,1,0,0][2,2,0,1,1,1][3,3,1,0,0,0][3,3,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {379, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,1,1][3,3,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {380, "[2,2,0,1,0,0][3,3,0,1,1,1][2,2,1,0,0,0][3,3,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {381, "[2,2,0,1,0,0][3,3,0,1,1,1][2,2,1,0,1,1][3,3,1,0,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {387, "[2,2,0,1,1,1][2,2,0,1,1,1][2,2,1,0,1,1][2,2,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {391, "[2,2,0,1,1,1][2,2,0,1,1,1][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {403, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,1,0][2,2,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {452, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,1,1,0][2,2,1,1,1,0][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {477, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,1,1][2,2,1,0,1,1][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {481, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,0,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {488, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,1,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {489, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,1,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {490, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,1,1,1][2,2,1,0,1,1][1,1,0,1,0,1][1,1,0,1,0,1]"},
-            {616, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,1,1][2,2,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {649, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,1,1,1][2,2,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {685, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {687, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,1,1,1][2,2,1,0,1,1][1,1,0,0,1,1][1,1,0,0,1,1]"},
-        }},
-        {34, {
-            {154, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,0,0,1][3,3,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {155, "[2,2,0,1,0,0][3,3,1,0,0,0][3,3,0,0,0,1][2,2,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {261, "[2,2,0,1,0,0][2,2,1,1,0,1][3,3,1,1,1,0][3,3,0,1,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {298, "[2,2,0,0,0,1][2,2,0,1,1,1][3,3,1,0,1,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {301, "[2,2,0,0,0,1][3,3,0,1,1,1][3,3,1,0,1,1][2,2,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {378, "[2,2,0,1,0,0][2,2,0,1,1,1][3,3,1,1,0,1][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {382, "[2,2,0,1,0,0][3,3,0,1,1,1][2,2,1,1,0,1][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {438, "[2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,1,0][2,2,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {459, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,0,0,1][3,3,1,1,0,1][1,1,0,1,1,0][1,1,0,1,1,0]"},
-            {460, "[2,2,0,1,0,0][3,3,1,0,0,0][3,3,0,0,0,1][2,2,1,1,0,1][1,1,0,1,1,0][1,1,0,1,1,0]"},
-            {496, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,0,0,1][2,2,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {497, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,0,0,1][3,3,1,1,0,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {548, "[2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,1,0][2,2,0,1,1,1][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {663, "[2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,1,0][2,2,0,1,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-        }},
-        {36, {
-            {134, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,1,0,1][3,3,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {135, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,1,0,1][3,3,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {189, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,0,1][3,3,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {191, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,1,0,1][3,3,1,1,0,1][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {192, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,1,0,1][3,3,1,1,0,1][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {199, "[2,2,0,1,1,1][2,2,0,1,1,1][3,3,0,1,1,1][3,3,0,1,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {208, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {248, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,0,1,0,0][3,3,0,1,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {272, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,0,1,1,1][3,3,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {273, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,0,1,1,1][3,3,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {277, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,0,0][3,3,1,0,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {279, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,0,0][3,3,1,0,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {281, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,1,1][3,3,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {282, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,1,1][3,3,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {362, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,1,1,1][3,3,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {363, "[2,2,0,1,0,0][3,3,1,0,0,0][2,2,0,1,1,1][3,3,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {364, "[2,2,0,1,0,0][3,3,1,0,0,0][3,3,0,1,1,1][2,2,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {366, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,1,0][3,3,1,1,1,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {368, "[2,2,1,1,0,1][3,3,1,1,0,1][2,2,1,1,1,0][3,3,1,1,1,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {388, "[2,2,0,1,1,1][2,2,0,1,1,1][3,3,1,0,1,1][3,3,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {392, "[2,2,0,1,1,1][2,2,0,1,1,1][3,3,1,1,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {393, "[2,2,0,1,1,1][3,3,0,1,1,1][2,2,1,0,1,1][3,3,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {394, "[2,2,0,1,1,1][3,3,0,1,1,1][2,2,1,1,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {404, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,1,0][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {405, "[2,2,1,1,0,1][2,2,1,1,1,0][3,3,1,1,0,1][3,3,1,1,1,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {453, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,1,1,0][3,3,1,1,1,0][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {454, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,1,1,0][3,3,1,1,1,0][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {466, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,1,0][2,2,1,1,1,0][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {478, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,1,1][3,3,1,0,1,1][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {479, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,1,1][3,3,1,0,1,1][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {482, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {483, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,1,0,1][3,3,1,1,0,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {485, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,1,0,1][3,3,1,1,0,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {491, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,1,1,1][3,3,1,0,1,1][1,1,0,1,0,1][1,1,0,1,0,1]"},
-            {492, "[2,2,0,1,0,0][3,3,1,0,0,0][2,2,0,1,1,1][3,3,1,0,1,1][1,1,0,1,0,1][1,1,0,1,0,1]"},
-            {493, "[2,2,0,1,0,0][3,3,1,0,0,0][3,3,0,1,1,1][2,2,1,0,1,1][1,1,0,1,0,1][1,1,0,1,0,1]"},
-            {508, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,0,1,1,1][2,2,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {617, "[2,2,0,1,0,0][2,2,0,1,0,0][2,2,1,0,1,1][2,2,1,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {618, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,1,1][3,3,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {640, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,1,1][3,3,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {650, "[2,2,0,1,0,0][2,2,1,0,0,0][2,2,0,1,1,1][2,2,1,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {651, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,1,1,1][3,3,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {656, "[2,2,0,1,0,0][3,3,1,0,0,0][2,2,0,1,1,1][3,3,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {658, "[2,2,0,1,0,0][3,3,1,0,0,0][3,3,0,1,1,1][2,2,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {686, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {688, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,1,1,1][3,3,1,0,1,1][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {689, "[2,2,0,1,0,0][3,3,1,0,0,0][2,2,0,1,1,1][3,3,1,0,1,1][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {690, "[2,2,0,1,0,0][3,3,1,0,0,0][3,3,0,1,1,1][2,2,1,0,1,1][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {698, "[2,2,0,1,1,1][2,2,0,1,1,1][2,2,0,1,1,1][2,2,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {700, "[2,2,0,1,1,1][2,2,0,1,1,1][2,2,1,0,1,1][2,2,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {772, "[2,2,0,1,1,1][2,2,0,1,1,1][2,2,0,1,1,1][2,2,0,1,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {778, "[2,2,0,1,1,1][2,2,0,1,1,1][2,2,1,0,1,1][2,2,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-        }},
-        {38, {
-            {439, "[2,2,0,1,0,0][2,2,1,1,0,1][3,3,1,1,1,0][3,3,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {440, "[2,2,0,1,0,0][3,3,1,1,0,1][3,3,1,1,1,0][2,2,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {498, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,0,0,1][3,3,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {549, "[2,2,0,1,0,0][2,2,1,1,0,1][3,3,1,1,1,0][3,3,0,1,1,1][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {550, "[2,2,0,1,0,0][3,3,1,1,0,1][2,2,1,1,1,0][3,3,0,1,1,1][1,1,1,0,0,1][1,1,1,0,0,1]"},
-            {664, "[2,2,0,1,0,0][2,2,1,1,0,1][2,2,1,1,1,0][2,2,0,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {665, "[2,2,0,1,0,0][2,2,1,1,0,1][3,3,1,1,1,0][3,3,0,1,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-        }},
-        {40, {
-            {209, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,0,1][3,3,1,1,0,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {467, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,1,0][3,3,1,1,1,0][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {468, "[2,2,1,1,0,1][3,3,1,1,0,1][2,2,1,1,1,0][3,3,1,1,1,0][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {484, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,1,0,1][3,3,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {486, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,1,0,1][3,3,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {509, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,0,1,1,1][3,3,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {510, "[2,2,1,1,0,1][3,3,1,1,0,1][2,2,0,1,1,1][3,3,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {567, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {619, "[2,2,0,1,0,0][2,2,0,1,0,0][3,3,1,0,1,1][3,3,1,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {641, "[2,2,0,1,0,0][3,3,0,1,0,0][2,2,1,0,1,1][3,3,1,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {652, "[2,2,0,1,0,0][2,2,1,0,0,0][3,3,0,1,1,1][3,3,1,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {657, "[2,2,0,1,0,0][3,3,1,0,0,0][2,2,0,1,1,1][3,3,1,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {659, "[2,2,0,1,0,0][3,3,1,0,0,0][3,3,0,1,1,1][2,2,1,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {699, "[2,2,0,1,1,1][2,2,0,1,1,1][3,3,0,1,1,1][3,3,0,1,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {701, "[2,2,0,1,1,1][2,2,0,1,1,1][3,3,1,0,1,1][3,3,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {702, "[2,2,0,1,1,1][3,3,0,1,1,1][2,2,1,0,1,1][3,3,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {746, "[2,2,1,1,0,1][2,2,1,1,0,1][2,2,1,1,1,0][2,2,1,1,1,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {839, "[2,2,0,1,1,1][2,2,0,1,1,1][3,3,0,1,1,1][3,3,0,1,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {842, "[2,2,0,1,1,1][2,2,0,1,1,1][3,3,1,0,1,1][3,3,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {845, "[2,2,0,1,1,1][2,2,1,0,1,1][3,3,0,1,1,1][3,3,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-        }},
-        {42, {
-            {666, "[2,2,0,1,0,0][2,2,1,1,0,1][3,3,1,1,1,0][3,3,0,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-        {44, {
-            {568, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,0,1][3,3,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {747, "[2,2,1,1,0,1][2,2,1,1,0,1][3,3,1,1,1,0][3,3,1,1,1,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {748, "[2,2,1,1,0,1][3,3,1,1,0,1][2,2,1,1,1,0][3,3,1,1,1,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-    }},
-    {3, {
-        {32, {
-            {51, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-        }},
-        {36, {
-            {52, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,3,3,0,0][2,2,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {56, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,1,1][2,2,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {757, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-        }},
-        {38, {
-            {59, "[2,2,2,2,0,0][2,2,3,3,0,0][2,3,2,3,0,0][2,3,3,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-        }},
-        {40, {
-            {53, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,3,3,0,0][3,3,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {57, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,3,3,1,1][2,2,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {60, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,0,0][3,3,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {63, "[2,2,2,2,0,0][2,2,3,3,0,0][2,2,2,2,1,1][2,2,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {70, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,2,2,0,0][3,3,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {74, "[2,2,3,3,0,0][2,2,3,3,0,0][2,2,2,2,1,1][2,2,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {78, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,3,2,0,0][3,3,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {103, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {307, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,1,1][2,2,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {758, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {759, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,3,3,0,0][2,2,3,3,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-        }},
-        {42, {
-            {64, "[2,2,2,2,0,0][2,2,3,3,0,0][2,3,2,3,1,1][2,3,3,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {81, "[2,2,3,3,0,0][2,3,2,3,0,0][2,2,2,2,1,1][2,3,3,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {799, "[2,2,2,2,0,0][2,2,3,3,0,0][2,3,2,3,0,0][2,3,3,2,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-        }},
-        {44, {
-            {58, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,3,3,1,1][3,3,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {65, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {66, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,2,2,1,1][3,3,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {67, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,3,3,1,1][3,3,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {75, "[2,2,3,3,0,0][2,2,3,3,0,0][2,2,3,3,1,1][2,2,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {76, "[2,2,3,3,0,0][2,2,3,3,0,0][2,3,2,3,1,1][2,3,2,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {77, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {82, "[2,2,3,3,0,0][2,3,2,3,0,0][2,2,3,3,1,1][2,3,2,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {83, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,3,2,1,1][3,3,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {84, "[2,2,3,3,0,0][3,3,2,2,0,0][2,2,2,2,1,1][3,3,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {85, "[2,2,3,3,0,0][3,3,2,2,0,0][2,2,3,3,1,1][3,3,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {86, "[2,2,3,3,0,0][3,3,2,2,0,0][2,3,2,3,1,1][3,2,3,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {104, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,3,3,1,1][2,2,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {308, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,3,3,1,1][2,2,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {309, "[2,2,2,2,0,0][2,2,2,2,0,0][2,3,2,3,1,1][2,3,2,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {310, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,2,2,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {314, "[2,2,2,2,0,0][2,3,2,3,0,0][2,2,2,2,1,1][2,3,2,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {318, "[2,2,2,2,0,0][3,3,2,2,0,0][2,2,2,2,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {408, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {426, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {760, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,3,3,0,0][2,2,3,3,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {761, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,3,3,0,0][2,2,3,3,0,0][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {762, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,3,3,0,0][2,2,3,3,0,0][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {763, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,3,3,0,0][3,3,3,3,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {773, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,1,1][2,2,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {802, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,0,0][3,3,3,3,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {832, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,2,2,0,0][3,3,2,2,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {867, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,3,2,0,0][3,3,2,2,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-        }},
-        {46, {
-            {106, "[2,2,2,2,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,3,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {312, "[2,2,2,2,0,0][2,2,3,3,0,0][2,3,2,3,1,1][2,3,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {315, "[2,2,2,2,0,0][2,3,2,3,0,0][2,2,3,3,1,1][2,3,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {316, "[2,2,2,2,0,0][2,3,2,3,0,0][3,2,2,3,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {320, "[2,2,2,2,0,0][3,3,2,2,0,0][2,3,2,3,1,1][3,2,2,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {348, "[2,3,2,3,0,0][3,2,2,3,0,0][2,2,2,2,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {800, "[2,2,2,2,0,0][2,2,3,3,0,0][2,3,2,3,0,0][2,3,3,2,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {801, "[2,2,2,2,0,0][2,2,3,3,0,0][2,3,2,3,0,0][2,3,3,2,0,0][1,0,0,1,1,1][1,0,0,1,1,1]"},
-        }},
-        {48, {
-            {105, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,3,3,1,1][3,3,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {107, "[2,2,2,2,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {108, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,3,3,1,1][2,2,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {109, "[2,2,3,3,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,2,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {110, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {111, "[2,2,3,3,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,3,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {311, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,3,3,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {313, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {317, "[2,2,2,2,0,0][2,3,2,3,0,0][3,2,3,2,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {319, "[2,2,2,2,0,0][3,3,2,2,0,0][2,2,3,3,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {321, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,2,2,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {322, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,3,3,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {323, "[2,2,2,2,0,0][3,3,3,3,0,0][2,3,2,3,1,1][3,2,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {332, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {335, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,3,2,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {336, "[2,2,3,3,0,0][3,3,2,2,0,0][2,2,2,2,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {337, "[2,2,3,3,0,0][3,3,2,2,0,0][2,2,3,3,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {338, "[2,2,3,3,0,0][3,3,2,2,0,0][2,3,2,3,1,1][3,2,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {349, "[2,3,2,3,0,0][3,2,2,3,0,0][2,3,2,3,1,1][3,2,2,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {350, "[2,3,2,3,0,0][3,2,2,3,0,0][2,3,3,2,1,1][3,2,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {351, "[2,3,2,3,0,0][3,2,3,2,0,0][2,3,2,3,1,1][3,2,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {352, "[2,3,2,3,0,0][3,2,3,2,0,0][2,3,3,2,1,1][3,2,2,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {409, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,3,3,1,1][2,2,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {410, "[2,2,2,2,1,1][2,2,2,2,1,1][2,3,2,3,1,1][2,3,2,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {411, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,2,2,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {427, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,3,3,1,1][2,2,3,3,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {708, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {723, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {764, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,3,3,0,0][3,3,3,3,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {771, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,3,3,1,1][3,3,3,3,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {774, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,3,3,1,1][2,2,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {775, "[2,2,2,2,0,0][2,2,2,2,0,0][2,3,2,3,1,1][2,3,2,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {776, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,2,2,1,1][3,3,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {803, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,0,0][3,3,3,3,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {804, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,0,0][3,3,3,3,0,0][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {805, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,3,3,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {808, "[2,2,2,2,0,0][2,2,3,3,0,0][2,2,2,2,1,1][2,2,3,3,1,1][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {812, "[2,2,2,2,0,0][2,2,3,3,0,0][2,2,2,2,1,1][2,2,3,3,1,1][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {815, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,2,2,1,1][3,3,3,3,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {816, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,3,3,1,1][3,3,2,2,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {831, "[2,2,3,3,0,0][2,2,3,3,0,0][2,3,2,3,0,0][2,3,2,3,0,0][1,0,0,1,1,1][1,0,0,1,1,1]"},
-            {833, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,2,2,0,0][3,3,2,2,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {834, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,2,2,0,0][3,3,2,2,0,0][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {868, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,3,2,0,0][3,3,2,2,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {869, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,3,2,0,0][3,3,2,2,0,0][0,1,1,0,1,1][0,1,1,0,1,1]"},
-        }},
-        {50, {
-            {334, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,2,3,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {413, "[2,2,2,2,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {415, "[2,2,2,2,1,1][2,3,2,3,1,1][3,2,2,3,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {429, "[2,2,2,2,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,3,2,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {806, "[2,2,2,2,0,0][2,2,3,3,0,0][2,3,2,3,1,1][2,3,3,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {809, "[2,2,2,2,0,0][2,2,3,3,0,0][2,3,2,3,1,1][2,3,3,2,1,1][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {810, "[2,2,2,2,0,0][2,2,3,3,0,0][3,2,2,3,1,1][3,2,3,2,1,1][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {813, "[2,2,2,2,0,0][2,2,3,3,0,0][2,3,2,3,1,1][2,3,3,2,1,1][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {875, "[2,2,3,3,0,0][2,3,2,3,0,0][2,2,2,2,1,1][2,3,3,2,1,1][1,0,0,1,1,1][1,0,0,1,1,1]"},
-        }},
-        {52, {
-            {333, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,3,3,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {412, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,3,3,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {414, "[2,2,2,2,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {416, "[2,2,2,2,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,3,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {417, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,3,3,1,1][2,2,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {418, "[2,2,3,3,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,2,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {419, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {420, "[2,2,3,3,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,3,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {421, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,2,3,1,1][2,3,2,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {422, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,3,2,1,1][2,3,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {423, "[2,3,2,3,1,1][2,3,2,3,1,1][3,2,2,3,1,1][3,2,2,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {424, "[2,3,2,3,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,2,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {425, "[2,3,2,3,1,1][2,3,3,2,1,1][3,2,2,3,1,1][3,2,3,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {428, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,3,3,1,1][3,3,3,3,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {430, "[2,2,2,2,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,3,3,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {431, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,3,3,1,1][2,2,3,3,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {432, "[2,2,3,3,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,2,3,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {433, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,2,2,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {434, "[2,2,3,3,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,3,2,2,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {709, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,3,3,1,1][2,2,3,3,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {724, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,3,3,1,1][2,2,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {725, "[2,2,2,2,1,1][2,2,2,2,1,1][2,3,2,3,1,1][2,3,2,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {726, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,2,2,1,1][3,3,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {777, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,3,3,1,1][3,3,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {807, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {811, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,3,3,1,1][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {814, "[2,2,2,2,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,3,3,1,1][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {817, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,2,2,1,1][3,3,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {818, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,3,3,1,1][3,3,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {819, "[2,2,2,2,0,0][3,3,3,3,0,0][2,3,2,3,1,1][3,2,3,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {840, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {843, "[2,2,3,3,0,0][2,2,3,3,0,0][3,2,2,3,1,1][3,2,2,3,1,1][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {844, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,2,2,1,1][3,3,2,2,1,1][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {871, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,3,2,1,1][3,3,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {872, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,3,2,1,1][3,3,2,2,1,1][0,1,1,0,1,1][0,1,1,0,1,1]"},
-            {876, "[2,2,3,3,0,0][2,3,2,3,0,0][2,2,3,3,1,1][2,3,2,3,1,1][1,0,0,1,1,1][1,0,0,1,1,1]"},
-            {877, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,3,2,1,1][3,3,2,2,1,1][1,0,0,1,1,1][1,0,0,1,1,1]"},
-            {878, "[2,2,3,3,0,0][3,3,2,2,0,0][2,2,3,3,1,1][3,3,2,2,1,1][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {879, "[2,2,3,3,0,0][3,3,2,2,0,0][2,3,3,2,1,1][3,2,2,3,1,1][0,1,0,1,1,1][0,1,0,1,1,1]"},
-            {908, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][2,2,2,2,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-        {54, {
-            {711, "[2,2,2,2,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,3,2,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {728, "[2,2,2,2,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,3,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {730, "[2,2,2,2,1,1][2,3,2,3,1,1][3,2,2,3,1,1][3,3,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {870, "[2,2,3,3,0,0][2,3,2,3,0,0][3,2,2,3,1,1][3,3,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-        }},
-        {56, {
-            {710, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,3,3,1,1][3,3,3,3,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {712, "[2,2,2,2,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,3,3,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {713, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,2,2,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {714, "[2,2,3,3,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,3,2,2,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {727, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,3,3,1,1][3,3,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {729, "[2,2,2,2,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {731, "[2,2,2,2,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,3,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {732, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,3,3,1,1][2,2,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {733, "[2,2,3,3,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,2,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {734, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {735, "[2,2,3,3,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,3,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {738, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,2,3,1,1][2,3,2,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {739, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,3,2,1,1][2,3,3,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {740, "[2,3,2,3,1,1][2,3,2,3,1,1][3,2,2,3,1,1][3,2,2,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {741, "[2,3,2,3,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,2,3,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {742, "[2,3,2,3,1,1][2,3,3,2,1,1][3,2,2,3,1,1][3,2,3,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {841, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,3,3,1,1][3,3,3,3,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {909, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,3,3,1,1][2,2,3,3,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-        {58, {
-            {911, "[2,2,2,2,1,1][2,2,3,3,1,1][2,3,2,3,1,1][2,3,3,2,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-        {60, {
-            {910, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,3,3,1,1][3,3,3,3,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {912, "[2,2,2,2,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,3,3,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {913, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,2,2,1,1][3,3,2,2,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {914, "[2,2,3,3,1,1][2,3,2,3,1,1][3,2,3,2,1,1][3,3,2,2,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-    }},
-    {4, {
-        {28, {
-            {136, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-        }},
-        {32, {
-            {33, "[2,3,2,3,0,0][3,2,2,3,0,0][2,2,0,1,0,0][3,3,1,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {43, "[2,3,2,3,0,0][3,2,2,3,0,0][3,3,0,1,0,0][2,2,1,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {61, "[2,2,2,2,0,0][3,3,2,2,0,0][2,2,0,0,0,1][3,3,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {62, "[2,2,2,2,0,0][3,3,2,2,0,0][3,3,0,0,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {137, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {138, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,0,0,0,1][3,3,0,0,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {175, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {765, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-        }},
-        {36, {
-            {36, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,0,0][3,3,1,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {41, "[2,2,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][3,3,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {44, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,0,0][2,2,1,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {79, "[2,3,2,3,0,0][3,2,2,3,0,0][2,2,0,1,1,1][3,3,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {80, "[2,3,2,3,0,0][3,2,2,3,0,0][3,3,0,1,1,1][2,2,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {139, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,1,1,0,1][3,3,1,1,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {143, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,0,0,0,1][3,3,0,0,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {151, "[2,3,2,3,0,0][2,3,2,3,0,0][2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {152, "[2,3,2,3,0,0][2,3,2,3,0,0][2,2,1,0,1,1][2,2,1,0,1,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {160, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {168, "[2,3,2,3,1,1][2,3,2,3,1,1][2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {169, "[2,3,3,2,1,1][2,3,3,2,1,1][2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {176, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {177, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {448, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,0,1][2,2,0,0,0,1][1,1,0,0,0,0][1,1,1,1,0,0]"},
-            {589, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {604, "[2,3,2,3,0,0][2,3,2,3,0,0][2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {605, "[2,3,3,2,0,0][2,3,3,2,0,0][2,2,0,1,0,0][2,2,0,1,0,0][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {655, "[2,3,2,3,0,0][3,2,2,3,0,0][2,2,0,1,0,0][3,3,1,0,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {679, "[2,3,2,3,0,0][3,2,2,3,0,0][3,3,0,1,0,0][2,2,1,0,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {766, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,0,0,0,1][3,3,0,0,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {767, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {835, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-        }},
-        {40, {
-            {42, "[2,2,3,3,1,1][3,3,3,3,1,1][2,2,0,0,0,1][3,3,1,1,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {100, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,1,1][3,3,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {101, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,1,1][2,2,1,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {144, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,1,1,0,1][3,3,1,1,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {161, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {162, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {178, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {236, "[2,3,3,2,1,1][2,3,3,2,1,1][2,2,1,0,1,1][2,2,1,0,1,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {237, "[2,3,2,3,1,1][2,3,2,3,1,1][2,2,1,0,1,1][2,2,1,0,1,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {259, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,0,0][3,3,1,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {264, "[2,2,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][3,3,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {266, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,0,0][2,2,1,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {290, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,0,0][3,3,1,0,0,0][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {291, "[2,3,3,2,1,1][3,2,3,2,1,1][2,2,0,1,0,0][3,3,1,0,0,0][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {303, "[2,2,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {346, "[2,3,2,3,0,0][3,2,2,3,0,0][2,2,0,1,1,1][3,3,1,0,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {347, "[2,3,2,3,0,0][3,2,2,3,0,0][2,2,1,0,1,1][3,3,0,1,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {383, "[2,2,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][3,3,1,1,0,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {386, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,0,0][3,3,1,0,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {396, "[2,3,2,3,0,0][3,2,2,3,0,0][2,2,0,1,1,1][3,3,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {398, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,0,0][2,2,1,0,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {400, "[2,3,2,3,0,0][3,2,2,3,0,0][3,3,0,1,1,1][2,2,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {449, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][2,2,0,0,0,1][1,1,0,0,0,0][1,1,1,1,0,0]"},
-            {450, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,0,1][2,2,0,0,0,1][1,1,0,0,0,0][1,1,1,1,0,0]"},
-            {501, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][1,1,1,1,0,0]"},
-            {560, "[2,3,2,3,0,0][2,3,2,3,0,0][2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {562, "[2,3,3,2,0,0][2,3,3,2,0,0][2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {590, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {591, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {600, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,0,1][2,2,0,0,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {607, "[2,3,3,2,1,1][2,3,3,2,1,1][2,2,1,0,0,0][2,2,1,0,0,0][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {608, "[2,3,2,3,1,1][2,3,2,3,1,1][2,2,1,0,0,0][2,2,1,0,0,0][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {768, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {769, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,1,1,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {836, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-        }},
-        {44, {
-            {163, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,1,1,0,1][2,2,1,1,0,1][0,0,0,0,0,0][0,0,1,1,0,0]"},
-            {265, "[2,2,3,3,1,1][3,3,3,3,1,1][2,2,0,0,0,1][3,3,1,1,0,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {304, "[2,2,3,3,1,1][3,3,3,3,1,1][2,2,0,0,0,1][3,3,1,1,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {371, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,1,1][3,3,1,0,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {372, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,1,1][2,2,1,0,1,1][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {384, "[2,2,3,3,1,1][3,3,3,3,1,1][2,2,0,0,0,1][3,3,1,1,0,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {397, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,1,1][3,3,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {401, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,1,1][2,2,1,0,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {406, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,1,1][3,3,1,0,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {407, "[2,3,3,2,1,1][3,2,3,2,1,1][2,2,0,1,1,1][3,3,1,0,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {502, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][1,1,1,1,0,0]"},
-            {503, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,0,0][1,1,1,1,0,0]"},
-            {557, "[2,3,3,2,1,1][2,3,3,2,1,1][2,2,1,0,1,1][2,2,1,0,1,1][1,1,0,0,0,0][1,1,1,1,0,0]"},
-            {558, "[2,3,2,3,1,1][2,3,2,3,1,1][2,2,1,0,1,1][2,2,1,0,1,1][1,1,0,0,0,0][1,1,1,1,0,0]"},
-            {561, "[2,3,2,3,1,1][2,3,2,3,1,1][2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {563, "[2,3,3,2,1,1][2,3,3,2,1,1][2,2,0,1,1,1][2,2,0,1,1,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {592, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,0,0,0,1][2,2,0,0,0,1][0,0,0,0,1,1][0,0,1,1,1,1]"},
-            {601, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][2,2,0,0,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {602, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,0,1][2,2,0,0,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {611, "[2,3,3,2,1,1][2,3,3,2,1,1][2,2,1,0,0,0][2,2,1,0,0,0][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {612, "[2,3,2,3,1,1][2,3,2,3,1,1][2,2,1,0,0,0][2,2,1,0,0,0][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {660, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,0,0][3,3,1,0,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {668, "[2,2,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][3,3,1,1,0,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {680, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,0,0][2,2,1,0,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {693, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,0,0][3,3,1,0,0,0][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {694, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,0,0][2,2,1,0,0,0][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {770, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,1,1,0,1][3,3,1,1,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {837, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {873, "[2,3,2,3,0,0][3,2,2,3,0,0][2,2,0,1,1,1][3,3,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {874, "[2,3,2,3,0,0][3,2,2,3,0,0][3,3,0,1,1,1][2,2,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {896, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-        }},
-        {48, {
-            {661, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,0,0][3,3,1,0,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {669, "[2,2,3,3,1,1][3,3,3,3,1,1][2,2,0,0,0,1][3,3,1,1,0,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {670, "[2,2,2,2,1,1][3,3,2,2,1,1][2,2,0,0,0,1][3,3,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {681, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,0,0][2,2,1,0,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {705, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,1,1][3,3,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {706, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,1,1][2,2,1,0,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {721, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,1,1][3,3,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {722, "[2,3,3,2,1,1][3,2,3,2,1,1][2,2,0,1,1,1][3,3,1,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {838, "[3,3,2,2,0,0][3,3,2,2,0,0][3,3,1,1,0,1][3,3,1,1,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {897, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-            {898, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,0,1][2,2,1,1,0,1][1,1,0,0,1,1][1,1,1,1,1,1]"},
-        }},
-        {52, {
-            {671, "[2,2,3,3,1,1][3,3,3,3,1,1][2,2,0,0,0,1][3,3,1,1,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {902, "[2,3,2,3,1,1][3,2,2,3,1,1][2,2,0,1,1,1][3,3,1,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {906, "[2,3,2,3,1,1][3,2,2,3,1,1][3,3,0,1,1,1][2,2,1,0,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-    }},
-    {5, {
-        {18, {
-            {578, "[2,2,0,0,0,0][2,2,0,0,0,0][0,0,2,2,0,0][0,0,2,2,0,0][0,0,0,0,0,1][0,0,0,0,1,0]"},
-        }},
-        {20, {
-            {26, "[2,2,0,1,0,0][2,2,1,0,0,0][0,1,2,2,0,0][1,0,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-        }},
-        {24, {
-            {31, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,0,0][1,0,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {37, "[2,2,0,0,0,1][2,2,1,1,0,1][0,0,2,2,0,1][1,1,2,2,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {40, "[2,2,0,0,1,0][2,2,1,1,1,0][0,0,2,2,0,1][1,1,2,2,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {45, "[2,2,0,1,0,0][2,2,1,0,0,0][0,1,3,3,0,0][1,0,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {179, "[2,2,0,0,0,1][2,2,0,0,0,1][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {183, "[2,2,0,0,1,0][2,2,0,0,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {445, "[2,2,0,0,1,0][2,2,0,0,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,1,1,0,0][1,1,0,0,0,0]"},
-            {648, "[2,2,0,1,0,0][2,2,1,0,0,0][0,1,2,2,0,0][1,0,2,2,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-        }},
-        {28, {
-            {32, "[3,3,0,1,1,1][3,3,1,0,1,1][0,1,2,2,0,0][1,0,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {46, "[2,2,0,0,0,1][2,2,1,1,0,1][0,0,3,3,0,1][1,1,3,3,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {47, "[2,2,0,0,1,0][2,2,1,1,1,0][0,0,3,3,0,1][1,1,3,3,0,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {99, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,1,1][1,0,2,2,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {172, "[2,2,0,1,1,1][2,2,0,1,1,1][0,1,2,2,0,0][0,1,2,2,0,0][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {180, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {184, "[2,2,1,1,1,0][2,2,1,1,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {186, "[2,2,0,0,0,1][2,2,0,0,0,1][0,0,3,3,0,1][0,0,3,3,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {187, "[2,2,0,0,1,0][2,2,0,0,1,0][0,0,3,3,0,1][0,0,3,3,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {257, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,0,0][1,0,2,2,0,0][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {262, "[2,2,0,0,1,0][2,2,1,1,1,0][0,0,2,2,0,1][1,1,2,2,0,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {284, "[2,2,0,1,0,0][2,2,1,0,0,0][0,1,2,2,1,1][1,0,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {302, "[2,2,0,0,1,0][2,2,1,1,1,0][0,0,2,2,0,1][1,1,2,2,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {385, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,0,0][1,0,2,2,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {446, "[2,2,1,1,1,0][2,2,1,1,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,1,1,0,0][1,1,0,0,0,0]"},
-            {451, "[2,2,0,0,1,0][2,2,0,0,1,0][0,0,3,3,0,1][0,0,3,3,0,1][0,0,1,1,0,0][1,1,0,0,0,0]"},
-            {593, "[2,2,0,0,1,0][2,2,0,0,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {597, "[2,2,0,0,1,0][2,2,0,0,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,1,1,1,1][1,1,0,0,1,1]"},
-            {603, "[2,2,0,1,0,0][2,2,0,1,0,0][0,1,2,2,0,0][0,1,2,2,0,0][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {613, "[2,2,0,0,0,1][2,2,0,0,0,1][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {682, "[2,2,0,1,0,0][2,2,1,0,0,0][0,1,3,3,0,0][1,0,3,3,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-        }},
-        {32, {
-            {102, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,3,3,1,1][1,0,3,3,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {173, "[3,3,0,1,1,1][3,3,0,1,1,1][0,1,2,2,0,0][0,1,2,2,0,0][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {181, "[3,3,1,1,0,1][3,3,1,1,0,1][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {185, "[3,3,1,1,1,0][3,3,1,1,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {202, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,2,2,0,1][1,1,2,2,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {203, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,2,2,0,1][1,1,2,2,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {238, "[2,2,0,1,1,1][2,2,0,1,1,1][0,1,2,2,1,1][0,1,2,2,1,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {258, "[3,3,0,1,1,1][3,3,1,0,1,1][0,1,2,2,0,0][1,0,2,2,0,0][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {263, "[3,3,0,0,1,0][3,3,1,1,1,0][0,0,2,2,0,1][1,1,2,2,0,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {285, "[2,2,0,1,0,0][2,2,1,0,0,0][0,1,3,3,1,1][1,0,3,3,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {357, "[2,2,0,0,1,0][2,2,1,1,1,0][0,0,3,3,0,1][1,1,3,3,0,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {369, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,1,1][1,0,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {395, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,1,1][1,0,2,2,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {399, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,3,3,0,0][1,0,3,3,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {447, "[3,3,1,1,1,0][3,3,1,1,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,1,1,0,0][1,1,0,0,0,0]"},
-            {462, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,2,2,0,1][1,1,2,2,0,1][0,0,1,1,0,0][1,1,0,0,0,0]"},
-            {556, "[2,2,0,1,1,1][2,2,0,1,1,1][0,1,2,2,1,1][0,1,2,2,1,1][0,0,1,1,0,0][1,1,0,0,0,0]"},
-            {594, "[2,2,1,1,1,0][2,2,1,1,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {598, "[2,2,1,1,1,0][2,2,1,1,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,1,1,1,1][1,1,0,0,1,1]"},
-            {609, "[2,2,0,1,1,1][2,2,0,1,1,1][0,1,2,2,0,0][0,1,2,2,0,0][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {610, "[2,2,0,1,1,1][2,2,0,1,1,1][0,1,2,2,0,0][0,1,2,2,0,0][0,0,1,1,1,1][1,1,0,0,1,1]"},
-            {614, "[2,2,1,1,0,1][2,2,1,1,0,1][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {672, "[2,2,0,0,1,0][2,2,0,0,1,0][0,0,3,3,0,1][0,0,3,3,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {673, "[2,2,0,0,1,0][2,2,0,0,1,0][0,0,3,3,0,1][0,0,3,3,0,1][0,0,1,1,1,1][1,1,0,0,1,1]"},
-            {674, "[2,2,0,1,0,0][2,2,0,1,0,0][0,1,3,3,0,0][0,1,3,3,0,0][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {675, "[2,2,0,0,0,1][2,2,0,0,0,1][0,0,3,3,0,1][0,0,3,3,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {691, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,0,0][1,0,2,2,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {696, "[2,2,0,1,0,0][2,2,1,0,0,0][0,1,2,2,1,1][1,0,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-        }},
-        {36, {
-            {206, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,3,3,0,1][1,1,3,3,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {207, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,3,3,0,1][1,1,3,3,0,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {239, "[2,2,0,1,1,1][2,2,0,1,1,1][0,1,3,3,1,1][0,1,3,3,1,1][0,0,0,0,0,0][1,1,1,1,0,0]"},
-            {370, "[3,3,0,1,1,1][3,3,1,0,1,1][0,1,2,2,1,1][1,0,2,2,1,1][0,0,1,1,0,0][0,0,1,1,0,0]"},
-            {402, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,3,3,1,1][1,0,3,3,1,1][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {465, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,3,3,0,1][1,1,3,3,0,1][0,0,1,1,0,0][1,1,0,0,0,0]"},
-            {559, "[2,2,0,1,1,1][2,2,0,1,1,1][0,1,3,3,1,1][0,1,3,3,1,1][0,0,1,1,0,0][1,1,0,0,0,0]"},
-            {564, "[2,2,0,1,1,1][2,2,0,1,1,1][0,1,2,2,1,1][0,1,2,2,1,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {565, "[2,2,0,1,0,0][2,2,0,1,0,0][0,1,3,3,1,1][0,1,3,3,1,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {595, "[3,3,1,1,1,0][3,3,1,1,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {599, "[3,3,1,1,1,0][3,3,1,1,1,0][0,0,2,2,0,1][0,0,2,2,0,1][0,0,1,1,1,1][1,1,0,0,1,1]"},
-            {615, "[3,3,1,1,0,1][3,3,1,1,0,1][0,0,2,2,0,1][0,0,2,2,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {653, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,0,0][1,0,2,2,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {662, "[3,3,0,0,1,0][3,3,1,1,1,0][1,1,2,2,0,1][0,0,2,2,0,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {667, "[2,2,0,0,1,0][2,2,1,1,1,0][0,0,2,2,0,1][1,1,2,2,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {692, "[3,3,0,1,1,1][3,3,1,0,1,1][0,1,2,2,0,0][1,0,2,2,0,0][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {697, "[3,3,0,1,0,0][3,3,1,0,0,0][0,1,2,2,1,1][1,0,2,2,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {704, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,1,1][1,0,2,2,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {894, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,2,2,0,1][1,1,2,2,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {895, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,2,2,0,1][1,1,2,2,0,1][0,0,1,1,1,1][1,1,0,0,1,1]"},
-            {899, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,2,2,0,1][1,1,2,2,0,1][0,0,1,1,1,1][1,1,0,0,1,1]"},
-        }},
-        {40, {
-            {566, "[2,2,0,1,1,1][2,2,0,1,1,1][0,1,3,3,1,1][0,1,3,3,1,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {654, "[3,3,0,1,1,1][3,3,1,0,1,1][0,1,2,2,0,0][1,0,2,2,0,0][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {683, "[2,2,0,0,1,0][2,2,1,1,1,0][0,0,3,3,0,1][1,1,3,3,0,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {707, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,3,3,1,1][1,0,3,3,1,1][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {901, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,2,2,1,1][1,0,2,2,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {903, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,3,3,0,1][1,1,3,3,0,1][0,0,0,0,1,1][1,1,1,1,1,1]"},
-            {904, "[2,2,1,1,0,1][2,2,1,1,0,1][1,1,3,3,0,1][1,1,3,3,0,1][0,0,1,1,1,1][1,1,0,0,1,1]"},
-            {905, "[2,2,1,1,1,0][2,2,1,1,1,0][1,1,3,3,0,1][1,1,3,3,0,1][0,0,1,1,1,1][1,1,0,0,1,1]"},
-        }},
-        {44, {
-            {907, "[2,2,0,1,1,1][2,2,1,0,1,1][0,1,3,3,1,1][1,0,3,3,1,1][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-    }},
-    {6, {
-        {36, {
-            {218, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {512, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,1,1][0,0,1,1,0,0]"},
-        }},
-        {40, {
-            {68, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,2,2][3,3,1,1,2,2][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {69, "[2,2,2,2,0,0][3,3,2,2,1,1][3,3,0,0,2,2][2,2,1,1,2,2][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {87, "[3,3,2,2,0,0][2,2,2,2,1,1][3,3,0,0,2,2][2,2,1,1,2,2][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {219, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {220, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {224, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {513, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {514, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {518, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {524, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {629, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-        }},
-        {44, {
-            {88, "[2,3,2,3,0,0][3,2,2,3,1,1][2,3,0,0,3,2][3,2,1,1,3,2][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {89, "[2,3,2,3,0,0][3,2,2,3,1,1][3,2,0,0,3,2][2,3,1,1,3,2][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {90, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,3,3][3,3,1,1,3,3][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {91, "[2,2,2,2,1,1][3,3,2,2,0,0][2,2,0,0,3,3][3,3,1,1,3,3][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {92, "[2,2,2,2,0,0][3,3,2,2,1,1][3,3,0,0,3,3][2,2,1,1,3,3][0,0,0,0,0,0][0,0,0,0,0,0]"},
-            {210, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {221, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {222, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {225, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {226, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {228, "[2,2,3,3,0,0][2,2,3,3,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {231, "[2,3,2,3,0,0][2,3,2,3,0,0][2,3,0,0,2,3][2,3,0,0,2,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {233, "[3,2,2,3,0,0][3,2,2,3,0,0][2,3,0,0,2,3][2,3,0,0,2,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {235, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,0,0,3,3][3,3,0,0,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {324, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,2,2][3,3,1,1,2,2][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {325, "[2,2,2,2,0,0][3,3,2,2,1,1][3,3,0,0,2,2][2,2,1,1,2,2][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {326, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,2,2][3,3,1,1,2,2][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {327, "[2,2,2,2,1,1][3,3,2,2,0,0][2,2,0,0,2,2][3,3,1,1,2,2][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {339, "[3,3,2,2,0,0][2,2,2,2,1,1][3,3,0,0,2,2][2,2,1,1,2,2][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {469, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {515, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {516, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {519, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,0,0,2,2][3,3,0,0,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {520, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,1,1,2,2][2,2,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {525, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {526, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {528, "[2,2,3,3,0,0][2,2,3,3,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {536, "[2,3,2,3,0,0][2,3,2,3,0,0][2,3,0,0,2,3][2,3,0,0,2,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {538, "[3,2,2,3,0,0][3,2,2,3,0,0][2,3,0,0,2,3][2,3,0,0,2,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {544, "[2,2,3,3,0,0][2,2,3,3,0,0][2,2,0,0,2,2][2,2,0,0,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {546, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,0,0,3,3][3,3,0,0,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {630, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,0,0,2,2][3,3,0,0,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {632, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,1,1,2,2][2,2,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {676, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,3,3][2,2,0,0,3,3][1,1,1,1,0,0][1,1,0,0,1,1]"},
-        }},
-        {48, {
-            {211, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {213, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {223, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {227, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {229, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {232, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,0,0,2,3][2,3,0,0,2,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {234, "[3,2,2,3,1,1][3,2,2,3,1,1][2,3,0,0,2,3][2,3,0,0,2,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {328, "[2,2,3,3,0,0][3,3,3,3,1,1][2,2,0,0,2,2][3,3,1,1,2,2][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {329, "[2,2,3,3,1,1][3,3,3,3,0,0][2,2,0,0,2,2][3,3,1,1,2,2][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {340, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,3,3][3,3,1,1,3,3][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {341, "[2,2,2,2,1,1][3,3,2,2,0,0][2,2,0,0,3,3][3,3,1,1,3,3][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {353, "[2,3,2,3,0,0][3,2,2,3,1,1][2,3,0,0,2,3][3,2,1,1,2,3][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {354, "[2,3,2,3,0,0][3,2,2,3,1,1][3,2,0,0,2,3][2,3,1,1,2,3][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {355, "[2,3,2,3,0,0][3,2,2,3,1,1][2,3,0,0,2,3][3,2,1,1,2,3][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {356, "[2,3,2,3,1,1][3,2,2,3,0,0][2,3,0,0,2,3][3,2,1,1,2,3][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {358, "[2,2,3,3,0,0][3,3,3,3,1,1][2,2,0,0,2,2][3,3,1,1,2,2][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {359, "[2,2,3,3,0,0][3,3,3,3,1,1][3,3,0,0,2,2][2,2,1,1,2,2][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {360, "[3,3,3,3,0,0][2,2,3,3,1,1][2,2,0,0,2,2][3,3,1,1,2,2][1,1,0,0,0,0][1,1,0,0,0,0]"},
-            {470, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {472, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {517, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {521, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,1,1,2,2][3,3,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {522, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,1,1,3,3][2,2,1,1,3,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {527, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {529, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {531, "[3,3,2,2,0,0][3,3,2,2,0,0][3,3,0,0,2,2][3,3,0,0,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {532, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,1,1,2,2][2,2,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {537, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,0,0,2,3][2,3,0,0,2,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {539, "[3,2,2,3,1,1][3,2,2,3,1,1][2,3,0,0,2,3][2,3,0,0,2,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {540, "[2,3,2,3,0,0][2,3,2,3,0,0][2,3,0,0,2,3][2,3,0,0,2,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {541, "[2,3,2,3,0,0][2,3,2,3,0,0][3,2,0,0,2,3][3,2,0,0,2,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {545, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,0,0,2,2][3,3,0,0,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {547, "[3,3,3,3,0,0][3,3,3,3,0,0][2,2,0,0,2,2][2,2,0,0,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {569, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {621, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,2,2][3,3,1,1,2,2][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {622, "[2,2,2,2,0,0][3,3,2,2,1,1][3,3,0,0,2,2][2,2,1,1,2,2][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {623, "[3,3,2,2,0,0][2,2,2,2,1,1][2,2,0,0,2,2][3,3,1,1,2,2][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {624, "[3,3,2,2,0,0][2,2,2,2,1,1][3,3,0,0,2,2][2,2,1,1,2,2][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {631, "[3,3,2,2,0,0][3,3,2,2,0,0][3,3,0,0,2,2][3,3,0,0,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {633, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,1,1,2,2][3,3,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {634, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,1,1,2,2][2,2,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {636, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,3,3][2,2,0,0,3,3][1,1,0,0,1,1][1,1,1,1,0,0]"},
-            {644, "[2,3,2,3,0,0][2,3,2,3,0,0][2,3,0,0,2,3][2,3,0,0,2,3][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {645, "[2,3,2,3,0,0][2,3,2,3,0,0][3,2,0,0,2,3][3,2,0,0,2,3][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {677, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,0,0,3,3][3,3,0,0,3,3][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {678, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,0,0,3,3][2,2,0,0,3,3][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {715, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,2,2][3,3,1,1,2,2][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {716, "[2,2,2,2,1,1][3,3,2,2,0,0][2,2,0,0,2,2][3,3,1,1,2,2][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {749, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-        }},
-        {52, {
-            {212, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {214, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {215, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {216, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,1,1,2,3][2,3,1,1,2,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {217, "[3,2,2,3,1,1][3,2,2,3,1,1][2,3,1,1,2,3][2,3,1,1,2,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {230, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,0,0][0,0,1,1,1,1]"},
-            {342, "[2,2,3,3,0,0][3,3,3,3,1,1][2,2,0,0,3,3][3,3,1,1,3,3][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {343, "[2,2,3,3,1,1][3,3,3,3,0,0][2,2,0,0,3,3][3,3,1,1,3,3][0,0,0,0,1,1][0,0,0,0,1,1]"},
-            {471, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {473, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {474, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {475, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,1,1,2,3][2,3,1,1,2,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {476, "[3,2,2,3,1,1][3,2,2,3,1,1][2,3,1,1,2,3][2,3,1,1,2,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {523, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,1,1,3,3][3,3,1,1,3,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {530, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,0,0,1,1][0,0,1,1,0,0]"},
-            {533, "[3,3,2,2,0,0][3,3,2,2,0,0][3,3,1,1,2,2][3,3,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {534, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,1,1,3,3][2,2,1,1,3,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {542, "[2,3,2,3,0,0][2,3,2,3,0,0][2,3,1,1,2,3][2,3,1,1,2,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {543, "[2,3,2,3,0,0][2,3,2,3,0,0][3,2,1,1,2,3][3,2,1,1,2,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {570, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,1,1,2,2][3,3,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {574, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,2,2][2,2,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {625, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,3,3][3,3,1,1,3,3][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {626, "[2,2,2,2,1,1][3,3,2,2,0,0][2,2,0,0,3,3][3,3,1,1,3,3][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {627, "[2,2,2,2,0,0][3,3,2,2,1,1][3,3,0,0,3,3][2,2,1,1,3,3][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {628, "[2,2,2,2,1,1][3,3,2,2,0,0][3,3,0,0,3,3][2,2,1,1,3,3][1,1,0,0,1,1][1,1,0,0,1,1]"},
-            {635, "[3,3,2,2,0,0][3,3,2,2,0,0][3,3,1,1,2,2][3,3,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {637, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,0,0,3,3][2,2,0,0,3,3][1,1,0,0,1,1][1,1,1,1,0,0]"},
-            {638, "[3,3,3,3,0,0][3,3,3,3,0,0][2,2,1,1,2,2][2,2,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {642, "[2,3,2,3,0,0][3,2,2,3,1,1][2,3,0,0,3,2][3,2,1,1,3,2][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {643, "[2,3,2,3,0,0][3,2,2,3,1,1][3,2,0,0,3,2][2,3,1,1,3,2][1,1,1,1,0,0][1,1,1,1,0,0]"},
-            {646, "[2,3,2,3,0,0][2,3,2,3,0,0][2,3,1,1,2,3][2,3,1,1,2,3][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {647, "[2,3,2,3,0,0][2,3,2,3,0,0][3,2,1,1,2,3][3,2,1,1,2,3][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {717, "[2,2,3,3,1,1][3,3,3,3,0,0][2,2,0,0,2,2][3,3,1,1,2,2][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {718, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,3,3][3,3,1,1,3,3][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {719, "[2,2,2,2,1,1][3,3,2,2,0,0][2,2,0,0,3,3][3,3,1,1,3,3][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {736, "[2,3,2,3,0,0][3,2,2,3,1,1][2,3,0,0,2,3][3,2,1,1,2,3][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {737, "[2,3,2,3,1,1][3,2,2,3,0,0][2,3,0,0,2,3][3,2,1,1,2,3][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {750, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,1,1,2,2][3,3,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {754, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,2,2][2,2,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {829, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,0,0,2,2][3,3,1,1,2,2][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {830, "[2,2,2,2,0,0][3,3,2,2,1,1][3,3,0,0,2,2][2,2,1,1,2,2][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {886, "[3,3,2,2,0,0][2,2,2,2,1,1][3,3,0,0,2,2][2,2,1,1,2,2][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-        {56, {
-            {535, "[3,3,2,2,0,0][3,3,2,2,0,0][3,3,1,1,3,3][3,3,1,1,3,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {571, "[3,3,2,2,1,1][3,3,2,2,1,1][3,3,1,1,2,2][3,3,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {572, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,1,1,2,3][2,3,1,1,2,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {573, "[2,3,2,3,1,1][2,3,2,3,1,1][3,2,1,1,2,3][3,2,1,1,2,3][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {575, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,1,1,2,2][3,3,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {576, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,1,1,2,2][2,2,1,1,2,2][1,1,0,0,0,0][1,1,1,1,1,1]"},
-            {639, "[3,3,3,3,0,0][3,3,3,3,0,0][3,3,1,1,2,2][3,3,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {720, "[2,2,3,3,0,0][3,3,3,3,1,1][2,2,0,0,3,3][3,3,1,1,3,3][0,0,1,1,1,1][0,0,1,1,1,1]"},
-            {751, "[3,3,2,2,1,1][3,3,2,2,1,1][3,3,1,1,2,2][3,3,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {752, "[2,3,2,3,1,1][2,3,2,3,1,1][2,3,1,1,2,3][2,3,1,1,2,3][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {753, "[2,3,2,3,1,1][2,3,2,3,1,1][3,2,1,1,2,3][3,2,1,1,2,3][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {755, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,1,1,2,2][3,3,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {756, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,1,1,2,2][2,2,1,1,2,2][1,1,1,1,0,0][1,1,0,0,1,1]"},
-            {887, "[2,3,2,3,0,0][3,2,2,3,1,1][2,3,0,0,3,2][3,2,1,1,3,2][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {888, "[2,3,2,3,0,0][3,2,2,3,1,1][3,2,0,0,3,2][2,3,1,1,3,2][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {889, "[2,2,2,2,0,0][3,3,2,2,1,1][3,3,1,1,3,3][2,2,0,0,3,3][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {890, "[2,2,2,2,1,1][3,3,2,2,0,0][3,3,1,1,3,3][2,2,0,0,3,3][1,1,1,1,1,1][1,1,1,1,1,1]"},
-            {893, "[2,2,2,2,0,0][3,3,2,2,1,1][2,2,1,1,3,3][3,3,0,0,3,3][1,1,1,1,1,1][1,1,1,1,1,1]"},
-        }},
-    }},
-    {7, {
-        {24, {
-            {579, "[2,2,0,0,0,0][2,2,0,0,0,0][0,0,2,2,0,0][0,0,2,2,0,0][0,0,0,0,2,2][0,0,0,0,2,2]"},
-        }},
-    }},
-    {8, {
-        {48, {
-            {779, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,2,2,2,2][0,0,2,2,2,2]"},
-        }},
-        {52, {
-            {780, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {783, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-        }},
-        {56, {
-            {781, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {784, "[2,2,3,3,0,0][2,2,3,3,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {788, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {846, "[2,2,3,3,0,0][2,2,3,3,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {848, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {850, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,1,1,2,2][2,2,1,1,2,2][0,0,2,2,3,3][0,0,2,2,3,3]"},
-        }},
-        {60, {
-            {782, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {785, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {786, "[3,3,3,3,0,0][3,3,3,3,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {789, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {791, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {793, "[3,3,2,2,0,0][3,3,2,2,0,0][2,2,1,1,3,3][2,2,1,1,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {820, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,0,0,2,2][3,3,0,0,3,3][0,0,2,2,2,2][0,0,3,3,3,3]"},
-            {823, "[2,2,2,2,0,0][3,3,3,3,0,0][2,2,0,0,3,3][3,3,0,0,2,2][0,0,2,2,2,2][0,0,3,3,3,3]"},
-            {847, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {853, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,1,1,3,3][2,2,1,1,3,3][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {857, "[2,2,3,3,0,0][2,2,3,3,0,0][3,3,0,0,2,2][3,3,0,0,2,2][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {861, "[2,3,3,2,0,0][2,3,3,2,0,0][2,3,0,0,3,2][2,3,0,0,3,2][0,0,2,3,2,3][0,0,2,3,2,3]"},
-            {862, "[3,2,3,2,0,0][3,2,3,2,0,0][2,3,0,0,3,2][2,3,0,0,3,2][0,0,2,3,2,3][0,0,2,3,2,3]"},
-            {880, "[2,3,2,3,0,0][3,2,3,2,0,0][2,3,0,0,2,3][3,2,0,0,3,2][0,0,2,3,2,3][0,0,3,2,3,2]"},
-            {882, "[2,3,2,3,0,0][3,2,3,2,0,0][2,3,0,0,3,2][3,2,0,0,2,3][0,0,2,3,2,3][0,0,3,2,3,2]"},
-            {892, "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,3,3][2,2,0,0,3,3][0,0,3,3,3,3][0,0,3,3,3,3]"},
-            {915, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][1,1,2,2,2,2][1,1,2,2,2,2]"},
-        }},
-        {64, {
-            {787, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {790, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {792, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {794, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {795, "[3,3,3,3,0,0][3,3,3,3,0,0][2,2,1,1,3,3][2,2,1,1,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {797, "[3,3,2,2,1,1][3,3,2,2,1,1][3,3,1,1,2,2][3,3,1,1,2,2][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {821, "[2,2,2,2,1,1][3,3,3,3,1,1][2,2,0,0,2,2][3,3,0,0,3,3][0,0,2,2,2,2][0,0,3,3,3,3]"},
-            {822, "[2,2,3,3,1,1][3,3,2,2,1,1][2,2,0,0,2,2][3,3,0,0,3,3][0,0,2,2,2,2][0,0,3,3,3,3]"},
-            {824, "[2,2,2,2,1,1][3,3,3,3,1,1][2,2,0,0,3,3][3,3,0,0,2,2][0,0,2,2,2,2][0,0,3,3,3,3]"},
-            {825, "[2,2,3,3,1,1][3,3,2,2,1,1][2,2,0,0,3,3][3,3,0,0,2,2][0,0,2,2,2,2][0,0,3,3,3,3]"},
-            {851, "[3,3,2,2,1,1][3,3,2,2,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {854, "[2,2,2,2,0,0][2,2,2,2,0,0][3,3,1,1,3,3][3,3,1,1,3,3][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {855, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,1,1,2,2][3,3,1,1,2,2][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {858, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,0,0,2,2][3,3,0,0,2,2][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {860, "[3,2,3,2,1,1][3,2,3,2,1,1][2,3,0,0,2,3][2,3,0,0,2,3][0,0,2,3,2,3][0,0,2,3,2,3]"},
-            {863, "[3,2,3,2,1,1][3,2,3,2,1,1][2,3,0,0,3,2][2,3,0,0,3,2][0,0,2,3,2,3][0,0,2,3,2,3]"},
-            {881, "[2,3,2,3,1,1][3,2,3,2,1,1][2,3,0,0,2,3][3,2,0,0,3,2][0,0,2,3,2,3][0,0,3,2,3,2]"},
-            {883, "[2,3,2,3,1,1][3,2,3,2,1,1][2,3,0,0,3,2][3,2,0,0,2,3][0,0,2,3,2,3][0,0,3,2,3,2]"},
-            {891, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,0,0,2,2][2,2,0,0,2,2][0,0,3,3,3,3][0,0,3,3,3,3]"},
-            {916, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,3,3][2,2,1,1,3,3][1,1,2,2,2,2][1,1,2,2,2,2]"},
-        }},
-        {68, {
-            {796, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,1,1,3,3][2,2,1,1,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {798, "[3,3,2,2,1,1][3,3,2,2,1,1][3,3,1,1,3,3][3,3,1,1,3,3][0,0,2,2,2,2][0,0,2,2,2,2]"},
-            {826, "[2,2,2,2,1,1][3,3,3,3,1,1][2,2,1,1,2,2][3,3,1,1,3,3][0,0,2,2,2,2][0,0,3,3,3,3]"},
-            {827, "[2,2,2,2,1,1][3,3,3,3,1,1][2,2,1,1,3,3][3,3,1,1,2,2][0,0,2,2,2,2][0,0,3,3,3,3]"},
-            {828, "[2,2,3,3,1,1][3,3,2,2,1,1][2,2,1,1,3,3][3,3,1,1,2,2][0,0,2,2,2,2][0,0,3,3,3,3]"},
-            {849, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,0,0,3,3][2,2,0,0,3,3][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {852, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,1,1,2,2][2,2,1,1,2,2][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {856, "[2,2,2,2,1,1][2,2,2,2,1,1][3,3,1,1,3,3][3,3,1,1,3,3][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {859, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,1,1,2,2][3,3,1,1,2,2][0,0,2,2,3,3][0,0,2,2,3,3]"},
-            {864, "[3,2,2,3,1,1][3,2,2,3,1,1][2,3,1,1,2,3][2,3,1,1,2,3][0,0,2,3,2,3][0,0,2,3,2,3]"},
-            {865, "[3,2,2,3,1,1][3,2,2,3,1,1][2,3,1,1,3,2][2,3,1,1,3,2][0,0,2,3,2,3][0,0,2,3,2,3]"},
-            {866, "[3,2,3,2,1,1][3,2,3,2,1,1][2,3,1,1,3,2][2,3,1,1,3,2][0,0,2,3,2,3][0,0,2,3,2,3]"},
-            {884, "[2,3,2,3,1,1][3,2,3,2,1,1][2,3,1,1,2,3][3,2,1,1,3,2][0,0,2,3,2,3][0,0,3,2,3,2]"},
-            {885, "[2,3,2,3,1,1][3,2,3,2,1,1][2,3,1,1,3,2][3,2,1,1,2,3][0,0,2,3,2,3][0,0,3,2,3,2]"},
-            {917, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,3,3][2,2,1,1,3,3][1,1,2,2,2,2][1,1,2,2,2,2]"},
-            {921, "[2,2,3,3,1,1][2,2,3,3,1,1][2,2,1,1,2,2][2,2,1,1,2,2][1,1,2,2,3,3][1,1,2,2,3,3]"},
-            {922, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,3,3][2,2,1,1,3,3][1,1,2,2,3,3][1,1,2,2,3,3]"},
-        }},
-        {72, {
-            {918, "[3,3,3,3,1,1][3,3,3,3,1,1][2,2,1,1,3,3][2,2,1,1,3,3][1,1,2,2,2,2][1,1,2,2,2,2]"},
-            {919, "[2,2,2,2,1,1][3,3,3,3,1,1][2,2,1,1,2,2][3,3,1,1,3,3][1,1,2,2,2,2][1,1,3,3,3,3]"},
-            {920, "[2,2,2,2,1,1][3,3,3,3,1,1][2,2,1,1,3,3][3,3,1,1,2,2][1,1,2,2,2,2][1,1,3,3,3,3]"},
-            {923, "[2,2,3,3,1,1][2,2,3,3,1,1][3,3,1,1,2,2][3,3,1,1,2,2][1,1,2,2,3,3][1,1,2,2,3,3]"},
-            {924, "[2,3,3,2,1,1][2,3,3,2,1,1][2,3,1,1,3,2][2,3,1,1,3,2][1,1,2,3,2,3][1,1,2,3,2,3]"},
-            {925, "[3,2,3,2,1,1][3,2,3,2,1,1][2,3,1,1,3,2][2,3,1,1,3,2][1,1,2,3,2,3][1,1,2,3,2,3]"},
-            {926, "[2,3,2,3,1,1][3,2,3,2,1,1][2,3,1,1,2,3][3,2,1,1,3,2][1,1,2,3,2,3][1,1,3,2,3,2]"},
-            {927, "[2,3,2,3,1,1][3,2,3,2,1,1][2,3,1,1,3,2][3,2,1,1,2,3][1,1,2,3,2,3][1,1,3,2,3,2]"},
-            {928, "[2,2,2,2,1,1][2,2,2,2,1,1][2,2,1,1,3,3][2,2,1,1,3,3][1,1,3,3,3,3][1,1,3,3,3,3]"},
-        }},
-    }},
-};
@@ -0,0 +1,49 @@
+#include "data/embedded-patterns.hpp"
+
+#include <gtest/gtest.h>
+#include <set>
+#include <stdexcept>
+
+// Everything is there before main runs
+static_assert(EMBEDDED_928.size() == 928 && EMBEDDED_785.size() == 785 && EMBEDDED_2704.size() == 2704);
+static_assert(pattern928(1).id == 1 && pattern928(928).id == 928);
+static_assert(pattern928(759).sum == pattern928(759).pattern.sum());
+static_assert(find928(pattern928(759).canonical) == 759);
+
+TEST(EmbeddedPatternsTest, Patterns) {
+    for (const embedded928Pattern &embedded : EMBEDDED_928) {
+        EXPECT_EQ(embedded.sum, embedded.pattern.sum());
+        EXPECT_EQ(embedded.sum, embedded.aligned.sum());
+        EXPECT_EQ(embedded.canonical, embedded.pattern.orbitCanonical());
+    }
+    auto checkFile = [](const auto &patterns) {
+        for (size_t i = 0; i < patterns.size(); i++) {
+            EXPECT_EQ(patterns[i].id, int(i) + 1);
+            EXPECT_EQ(patterns[i].sum, patterns[i].pattern.sum());
+            EXPECT_EQ(patterns[i].canonical, patterns[i].pattern.orbitCanonical());
+        }
+    };
+    checkFile(EMBEDDED_785);
+    checkFile(EMBEDDED_2704);
+    EXPECT_THROW(pattern928(0), std::out_of_range);
+    EXPECT_THROW(pattern928(929), std::out_of_range);
+}
+
+// The same relations patterns/README.md describes for the files
+TEST(EmbeddedPatternsTest, Subsets) {
+    std::set<packedMatrix> all;
+    for (const embeddedPattern &embedded : EMBEDDED_2704) all.insert(embedded.pattern);
+    std::set<packedMatrix> patterns928;
+    for (const embedded928Pattern &embedded : EMBEDDED_928) {
+        EXPECT_TRUE(all.contains(embedded.pattern)) << "Pattern " << embedded.id;
+        patterns928.insert(embedded.pattern);
+    }
+    for (const embeddedPattern &embedded : EMBEDDED_785) EXPECT_TRUE(patterns928.contains(embedded.pattern)) << "Pattern " << embedded.id;
+    // Each of the 2704 is a rearrangement / transpose / 2-3 swap of one of the 928
+    for (const embeddedPattern &embedded : EMBEDDED_2704) {
+        int id = find928(embedded.canonical);
+        ASSERT_NE(id, 0) << "Pattern " << embedded.id;
+        EXPECT_EQ(pattern928(id).canonical, embedded.canonical);
+    }
+    EXPECT_EQ(find928(packedMatrix()), 0);
+}
@@ -0,0 +1,245 @@
+#include "packed-matrix.hpp"
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+
+// Transpose both planes
+//  Bit (row * Cols + col) moves to bit (col * Rows + row)
+template <int Rows, int Cols, int MaxValue>
+typename bitPlaneMatrix<Rows, Cols, MaxValue>::transposeType bitPlaneMatrix<Rows, Cols, MaxValue>::transposed() const {
+    transposeType t;
+    for (int row = 0; row < ROWS; row++) {
+        uint64_t n = rowN(row);
+        uint64_t m = rowM(row);
+        for (int col = 0; col < COLS; col++) {
+            t.nBits |= ((n >> col) & 1) << (col * ROWS + row);
+            t.mBits |= ((m >> col) & 1) << (col * ROWS + row);
+        }
+    }
+    return t;
+}
+
+template <int Rows, int Cols, int MaxValue>
+void bitPlaneMatrix<Rows, Cols, MaxValue>::rowPairCounts(pairTable &pairs) const {
+    for (int r = 0; r < ROWS; r++) pairs[r][r] = COLS;
+    for (int offset = 1; offset < ROWS; offset++) {
+        uint64_t agree = rowAgreement(offset);
+        for (int r = 0; r + offset < ROWS; r++) {
+            int count = std::popcount((agree >> (r * COLS)) & ROW_MASK);
+            pairs[r][r+offset] = count;
+            pairs[r+offset][r] = count;
+        }
+    }
+}
+
+template <int Rows, int Cols, int MaxValue>
+void bitPlaneMatrix<Rows, Cols, MaxValue>::rowValuePairCounts(valuePairTable &valuePairs) const {
+    for (int v = 0; v <= MAX_VALUE; v++) {
+        uint64_t mask = valueMask(v);
+        for (int r = 0; r < ROWS; r++) {
+            valuePairs[r][r][v] = std::popcount((mask >> (r * COLS)) & ROW_MASK);
+        }
+        for (int offset = 1; offset < ROWS; offset++) {
+            uint64_t both = mask & (mask >> (offset * COLS));
+            for (int r = 0; r + offset < ROWS; r++) {
+                int count = std::popcount((both >> (r * COLS)) & ROW_MASK);
+                valuePairs[r][r+offset][v] = count;
+                valuePairs[r+offset][r][v] = count;
+            }
+        }
+    }
+}
+
+template <int Rows, int Cols, int MaxValue>
+typename bitPlaneMatrix<Rows, Cols, MaxValue>::caseInvariantsType bitPlaneMatrix<Rows, Cols, MaxValue>::caseInvariants() const {
+    caseInvariantsType inv;
+    transposeType t = transposed();
+    inv.sum = std::popcount(mBits);
+    for (int r = 0; r < ROWS; r++) inv.rowCounts[std::popcount(rowM(r))]++;
+    for (int c = 0; c < COLS; c++) inv.colCounts[std::popcount(t.rowM(c))]++;
+    pairTable rowPairs;
+    typename transposeType::pairTable colPairs;
+    rowPairCounts(rowPairs);
+    t.rowPairCounts(colPairs);
+    for (int i = 0; i < ROWS; i++) {
+        for (int j = 0; j < ROWS; j++) inv.rowPairs[rowPairs[i][j]]++;
+    }
+    for (int i = 0; i < COLS; i++) {
+        for (int j = 0; j < COLS; j++) inv.colPairs[colPairs[i][j]]++;
+    }
+    return inv;
+}
+
+template <int Rows, int Cols, int MaxValue>
+bitPlaneMatrix<Rows, Cols, MaxValue> bitPlaneMatrix<Rows, Cols, MaxValue>::permuted(const std::array<int, ROWS> &rowOrder, const std::array<int, COLS> &colOrder) const {
+    bitPlaneMatrix result;
+    for (int r = 0; r < ROWS; r++) {
+        for (int c = 0; c < COLS; c++) result.set(r, c, get(rowOrder[r], colOrder[c]));
+    }
+    return result;
+}
+
+template <int Rows, int Cols, int MaxValue>
+bitPlaneMatrix<Rows, Cols, MaxValue> bitPlaneMatrix<Rows, Cols, MaxValue>::swappedRows(int i, int j) const {
+    bitPlaneMatrix s = *this;
+    s.setRowCode(i, rowCode(j));
+    s.setRowCode(j, rowCode(i));
+    return s;
+}
+
+// Swapping two columns is a delta swap on every row slice at once
+template <int Rows, int Cols, int MaxValue>
+bitPlaneMatrix<Rows, Cols, MaxValue> bitPlaneMatrix<Rows, Cols, MaxValue>::swappedColumns(int i, int j) const {
+    if (i == j) return *this;
+    if (i > j) std::swap(i, j);
+    int shift = j - i;
+    uint64_t colMask = 0;
+    for (int row = 0; row < ROWS; row++) colMask |= uint64_t(1) << (row * COLS + i);
+    uint64_t nDelta = (nBits ^ (nBits >> shift)) & colMask;
+    uint64_t mDelta = (mBits ^ (mBits >> shift)) & colMask;
+    return bitPlaneMatrix(nBits ^ nDelta ^ (nDelta << shift), mBits ^ mDelta ^ (mDelta << shift));
+}
+
+// splitmix64 finalizer
+static uint64_t mix64(uint64_t h) {
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+// Both planes can be up to 64 bits so they can't share a single word, mix them in one after the other
+template <int Rows, int Cols, int MaxValue>
+uint64_t bitPlaneMatrix<Rows, Cols, MaxValue>::hash() const {
+    return mix64(mix64(nBits) ^ mBits);
+}
+
+// A signature for each row that doesn't change when rows or columns are rearranged
+//  It's made from the value counts of the row and the sorted value pair counts against every other row
+//  Rows with different signatures can never be mapped onto each other
+//  Each count is packed into just enough bits to hold a full row
+template <typename Matrix>
+static void rowSignatures(const Matrix &pm, std::array<uint64_t, Matrix::ROWS> &sigs) {
+    constexpr int COUNT_BITS = std::bit_width(unsigned(Matrix::COLS));
+    std::array<std::array<uint64_t, 4>, Matrix::ROWS> valueRows;
+    for (int v = 0; v < 4; v++) {
+        uint64_t mask = pm.valueMask(v);
+        for (int r = 0; r < Matrix::ROWS; r++) {
+            valueRows[r][v] = (mask >> (r * Matrix::COLS)) & Matrix::ROW_MASK;
+        }
+    }
+    for (int r = 0; r < Matrix::ROWS; r++) {
+        uint64_t counts = 0;
+        for (int v = 0; v < 4; v++) counts = counts << COUNT_BITS | std::popcount(valueRows[r][v]);
+        std::array<uint64_t, Matrix::ROWS-1> pairs;
+        int n = 0;
+        for (int s = 0; s < Matrix::ROWS; s++) {
+            if (s == r) continue;
+            uint64_t pair = 0;
+            for (int v = 0; v < 4; v++) pair = pair << COUNT_BITS | std::popcount(valueRows[r][v] & valueRows[s][v]);
+            pairs[n++] = pair;
+        }
+        std::sort(pairs.begin(), pairs.end());
+        uint64_t sig = mix64(counts);
+        for (uint64_t pair : pairs) sig = mix64(sig ^ pair);
+        sigs[r] = sig;
+    }
+}
+
+// Step through every ordering that keeps the blocks of equal signatures in place
+//  Each block is permuted on its own like the digits of an odometer
+template <size_t N>
+static bool nextBlockPermutation(std::array<int, N> &order, const std::array<int, N+1> &blockStarts, int blocks) {
+    for (int b = blocks-1; b >= 0; b--) {
+        if (std::next_permutation(order.begin() + blockStarts[b], order.begin() + blockStarts[b+1])) return true;
+    }
+    return false;
+}
+
+// Canonical labeling
+//  Rows are ordered by signature and only rows with the same signature get permuted against each other
+//  For each of those row orders the columns are sorted by (signature, column contents)
+//  which is the smallest column order for that row order
+//  The smallest result over all the row orders is the canonical form
+template <int Rows, int Cols, int MaxValue>
+bitPlaneMatrix<Rows, Cols, MaxValue> bitPlaneMatrix<Rows, Cols, MaxValue>::canonical() const {
+    std::array<uint64_t, ROWS> rowSigs;
+    std::array<uint64_t, COLS> colSigs;
+    rowSignatures(*this, rowSigs);
+    rowSignatures(transposed(), colSigs);
+
+    std::array<int, ROWS> rowOrder;
+    for (int r = 0; r < ROWS; r++) rowOrder[r] = r;
+    std::sort(rowOrder.begin(), rowOrder.end(), [&](int a, int b) {
+        return rowSigs[a] != rowSigs[b] ? rowSigs[a] < rowSigs[b] : a < b;
+    });
+    std::array<int, ROWS+1> blockStarts;
+    int blocks = 0;
+    for (int r = 0; r < ROWS; r++) {
+        if (r == 0 || rowSigs[rowOrder[r]] != rowSigs[rowOrder[r-1]]) blockStarts[blocks++] = r;
+    }
+    blockStarts[blocks] = ROWS;
+
+    // Column contents as a (2 * Rows)-bit value with the first row in the highest bits
+    std::array<uint16_t, COLS> best;
+    bool haveBest = false;
+    do {
+        std::array<std::pair<uint64_t, uint16_t>, COLS> colKeys;
+        for (int c = 0; c < COLS; c++) {
+            uint16_t contents = 0;
+            for (int r = 0; r < ROWS; r++) contents = contents << 2 | get(rowOrder[r], c);
+            colKeys[c] = {colSigs[c], contents};
+        }
+        std::sort(colKeys.begin(), colKeys.end());
+        std::array<uint16_t, COLS> candidate;
+        for (int c = 0; c < COLS; c++) candidate[c] = colKeys[c].second;
+        if (!haveBest || candidate < best) {
+            best = candidate;
+            haveBest = true;
+        }
+    } while (nextBlockPermutation(rowOrder, blockStarts, blocks));
+
+    bitPlaneMatrix result;
+    for (int c = 0; c < COLS; c++) {
+        for (int r = 0; r < ROWS; r++) {
+            result.set(r, c, (best[c] >> (2 * (ROWS-1-r))) & 3);
+        }
+    }
+    return result;
+}
+
+template <int Rows, int Cols, int MaxValue>
+bitPlaneMatrix<Rows, Cols, MaxValue> bitPlaneMatrix<Rows, Cols, MaxValue>::orbitCanonical() const requires (ROWS == COLS) {
+    bitPlaneMatrix swapped = swapped23();
+    return std::min({canonical(), transposed().canonical(), swapped.canonical(), swapped.transposed().canonical()});
+}
+
+template <int Rows, int Cols, int MaxValue>
+std::string bitPlaneMatrix<Rows, Cols, MaxValue>::toString() const {
+    std::stringstream ss;
+    ss << *this;
+    return ss.str();
+}
+
+template <int Rows, int Cols, int MaxValue>
+std::ostream& operator<<(std::ostream& os, const bitPlaneMatrix<Rows, Cols, MaxValue> &pm) {
+    for (int i = 0; i < Rows; i++) {
+        os << "[";
+        for (int j = 0; j < Cols; j++) {
+            os << pm.get(i, j);
+            if (j != Cols-1) os << ",";
+        }
+        os << "]";
+    }
+    return os;
+}
+
+template class bitPlaneMatrix<4, 4, 3>;
+template class bitPlaneMatrix<6, 6, 3>;
+template class bitPlaneMatrix<8, 8, 3>;
+template std::ostream& operator<<(std::ostream&, const bitPlaneMatrix<4, 4, 3> &);
+template std::ostream& operator<<(std::ostream&, const bitPlaneMatrix<6, 6, 3> &);
+template std::ostream& operator<<(std::ostream&, const bitPlaneMatrix<8, 8, 3> &);
@@ -0,0 +1,272 @@
+#ifndef PACKED_MATRIX_HPP
+#define PACKED_MATRIX_HPP
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+
+// Rearrangement invariants of a case style matrix (0s and 1s), the same counts that zmatrix::invariantsMatch compares
+//  Every histogram is indexed by a count, from 0 to the length of a row (rowCounts / rowPairs) or a column (colCounts / colPairs)
+template <int Rows, int Cols>
+struct bitPlaneCaseInvariants {
+    int sum = 0;
+    std::array<int, Cols+1> rowCounts{};  // Number of rows with k 1s
+    std::array<int, Rows+1> colCounts{};  // Number of columns with k 1s
+    std::array<int, Cols+1> rowPairs{};   // Number of (ordered) row pairs that agree in k places, a row paired with itself agrees in all of them
+    std::array<int, Rows+1> colPairs{};   // Number of (ordered) column pairs that agree in k places
+
+    constexpr bitPlaneCaseInvariants<Cols, Rows> transposed() const {
+        bitPlaneCaseInvariants<Cols, Rows> t;
+        t.sum = sum;
+        t.rowCounts = colCounts;
+        t.colCounts = rowCounts;
+        t.rowPairs = colPairs;
+        t.colPairs = rowPairs;
+        return t;
+    }
+    constexpr bool operator==(const bitPlaneCaseInvariants &other) const = default;
+};
+
+// A matrix with entries 0-3 packed into two bit planes, its size is fixed at compile time
+//  This uses the same N / M split as patternElementAddition where N is bit 1 and M is bit 0:
+//    0 == N=0, M=0
+//    1 == N=0, M=1
+//    2 == N=1, M=0
+//    3 == N=1, M=1
+//  Entry [row][col] lives at bit (row * Cols + col) of each plane so every row is a Cols-bit slice
+//  Case style matrices (0s and 1s) only use the M plane
+// This is a plain value type; copying it doesn't allocate and equality is two integer compares
+//  Every loop below runs over Rows or Cols so the compiler can unroll it for each size
+//  packedMatrix (6x6) is the size the patterns use, the 4x4 and 8x8 instances are there for smaller / larger studies
+template <int Rows, int Cols, int MaxValue>
+class bitPlaneMatrix {
+    // Two planes hold values up to 3 and a whole plane has to fit in one word
+    //  Rows / columns need at least 4 bits so the slice counters below can't carry into the next slice
+    static_assert(MaxValue >= 1 && MaxValue <= 3, "bitPlaneMatrix only has planes for the values 0-3");
+    static_assert(Rows >= 4 && Cols >= 4 && Rows * Cols <= 64, "bitPlaneMatrix needs 4-64 bits in each direction and at most 64 entries");
+
+    public:
+        static constexpr int ROWS = Rows;
+        static constexpr int COLS = Cols;
+        static constexpr int MAX_VALUE = MaxValue;
+        static constexpr uint64_t ROW_MASK = (uint64_t(1) << COLS) - 1;
+        static constexpr uint64_t PLANE_MASK = (ROWS * COLS == 64) ? ~uint64_t(0) : (uint64_t(1) << (ROWS * COLS)) - 1;
+
+        // pairs[i][j] -> number of columns where rows i and j hold the same value
+        // valuePairs[i][j][v] -> number of columns where rows i and j both hold v
+        using pairTable = std::array<std::array<int, ROWS>, ROWS>;
+        using valuePairTable = std::array<std::array<std::array<int, MAX_VALUE+1>, ROWS>, ROWS>;
+        using caseInvariantsType = bitPlaneCaseInvariants<ROWS, COLS>;
+        using transposeType = bitPlaneMatrix<COLS, ROWS, MAX_VALUE>;
+
+        constexpr bitPlaneMatrix() = default;
+        constexpr bitPlaneMatrix(uint64_t n, uint64_t m) : nBits(n & PLANE_MASK), mBits(m & PLANE_MASK) {}
+
+        uint64_t nBits = 0;  // Bit 1 (N) of every entry
+        uint64_t mBits = 0;  // Bit 0 (M) of every entry
+
+        constexpr int get(int row, int col) const {
+            int bit = row * COLS + col;
+            return int(((nBits >> bit) & 1) << 1 | ((mBits >> bit) & 1));
+        }
+        constexpr void set(int row, int col, int value) {
+            uint64_t bit = uint64_t(1) << (row * COLS + col);
+            nBits = (value & 2) ? (nBits | bit) : (nBits & ~bit);
+            mBits = (value & 1) ? (mBits | bit) : (mBits & ~bit);
+        }
+        // Cols-bit slices of a single row
+        constexpr uint64_t rowN(int row) const { return (nBits >> (row * COLS)) & ROW_MASK; }
+        constexpr uint64_t rowM(int row) const { return (mBits >> (row * COLS)) & ROW_MASK; }
+        // A row as a single code -> N slice in the low Cols bits, M slice in the Cols bits above it
+        constexpr int rowCode(int row) const { return int(rowN(row) | (rowM(row) << COLS)); }
+        constexpr void setRowCode(int row, int code) {
+            int shift = row * COLS;
+            nBits = (nBits & ~(ROW_MASK << shift)) | (uint64_t(code & ROW_MASK) << shift);
+            mBits = (mBits & ~(ROW_MASK << shift)) | (uint64_t((code >> COLS) & ROW_MASK) << shift);
+        }
+
+        constexpr int sum() const { return 2 * std::popcount(nBits) + std::popcount(mBits); }
+        // Number of entries equal to value
+        constexpr int count(int value) const { return std::popcount(valueMask(value)); }
+        // Bit mask of the entries equal to value
+        constexpr uint64_t valueMask(int value) const {
+            uint64_t n = (value & 2) ? nBits : ~nBits;
+            uint64_t m = (value & 1) ? mBits : ~mBits;
+            return n & m & PLANE_MASK;
+        }
+
+        // Slice r holds the columns where rows r and r+offset agree, for every r at once
+        constexpr uint64_t rowAgreement(int offset) const {
+            int shift = offset * COLS;
+            uint64_t diff = (nBits ^ (nBits >> shift)) | (mBits ^ (mBits >> shift));
+            return ~diff & (PLANE_MASK >> shift);
+        }
+        // Row pair counts from the bit planes -> each row offset covers all of its row pairs with one XOR/AND pass
+        //  Column pair counts are the row pair counts of the transpose
+        void rowPairCounts(pairTable &pairs) const;
+        void rowValuePairCounts(valuePairTable &valuePairs) const;
+
+        // Invariants of a case style matrix, only the M plane is counted
+        caseInvariantsType caseInvariants() const;
+
+        // Orthonormality rules from patternMatrix::isNormalized / isOrthogonal with mij = Nij + 2*Mij
+        //  mij is odd exactly where N is set and mij = 3 exactly where N and M are both set, so:
+        //    i.   Σ mij = 0 (mod 4)        -> popcount(N) + 2 * popcount(M) = 0 (mod 4)
+        //    ii.  mij = 3 has to be paired -> popcount(N & M) is even
+        //    iii. ri · rj = 0 (mod 2)      -> popcount(Ni & Nj) is even
+        //    iv.  (1,2), (1,3), (2,3) pairs are even -> popcount(nonzero in both & different) is even
+        // Everything below is straight line bit twiddling, no branches on the values
+        //  Rows are checked as slices side by side and columns with counters that add the slices together
+        //  Only square matrices have these rules, the row and column pair masks share one layout
+
+        // A single row as its N and M slices
+        //  These use the slice counts too, they stay cheap when rowTable is worked out at compile time
+        static constexpr bool isRowNormalized(uint64_t n, uint64_t m) requires (ROWS == COLS) {
+            return (((sliceCounts(n) + 2 * sliceCounts(m)) & 3) | (sliceParity(n & m) & 1)) == 0;
+        }
+        static constexpr bool areRowsOrthogonal(uint64_t n1, uint64_t m1, uint64_t n2, uint64_t m2) requires (ROWS == COLS) {
+            uint64_t mixed = (n1 | m1) & (n2 | m2) & ((n1 ^ n2) | (m1 ^ m2));
+            return ((sliceParity(n1 & n2) | sliceParity(mixed)) & 1) == 0;
+        }
+
+        //  Bit r of the result is set when row r breaks rule i or ii
+        constexpr int rowNormalizationFailures() const requires (ROWS == COLS) {
+            uint64_t rule1 = (sliceCounts(nBits) + 2 * sliceCounts(mBits)) & SLICE_COUNT_MASK;
+            uint64_t rule2 = sliceCounts(nBits & mBits) & SLICE_LOW_BITS;
+            return gatherSlices((rule1 | (rule1 >> 1) | rule2) & SLICE_LOW_BITS);
+        }
+        //  Bit c of the result is set when column c breaks rule i or ii
+        constexpr int colNormalizationFailures() const requires (ROWS == COLS) {
+            // Σ N (mod 4) for every column at once, low / high bit counters with a carry from one into the other
+            uint64_t low = 0;
+            uint64_t high = 0;
+            for (int row = 0; row < ROWS; row++) {
+                uint64_t n = rowN(row);
+                high ^= low & n;
+                low ^= n;
+            }
+            // 2 * Σ M only touches the high bit
+            return int(low | (high ^ foldSlices(mBits)) | foldSlices(nBits & mBits));
+        }
+        //  Bit (i * Cols + j) of the result is set when rows i < j break rule iii or iv
+        constexpr uint64_t rowOrthogonalityFailures() const requires (ROWS == COLS) {
+            uint64_t failures = 0;
+            uint64_t nonZero = nBits | mBits;
+            for (int offset = 1; offset < ROWS; offset++) {
+                // Slice r compares row r with row r+offset
+                int shift = offset * COLS;
+                uint64_t odd = nBits & (nBits >> shift);
+                uint64_t mixed = nonZero & (nonZero >> shift) & ((nBits ^ (nBits >> shift)) | (mBits ^ (mBits >> shift)));
+                failures |= spreadPairs(gatherSlices((sliceParity(odd) | sliceParity(mixed)) & SLICE_LOW_BITS), offset);
+            }
+            return failures;
+        }
+        //  Bit (i * Cols + j) of the result is set when columns i < j break rule iii or iv
+        constexpr uint64_t colOrthogonalityFailures() const requires (ROWS == COLS) {
+            uint64_t failures = 0;
+            uint64_t nonZero = nBits | mBits;
+            for (int offset = 1; offset < COLS; offset++) {
+                // Bit c of every slice compares column c with column c+offset
+                uint64_t inRange = (ROW_MASK >> offset) * SLICE_LOW_BITS;
+                uint64_t odd = nBits & (nBits >> offset) & inRange;
+                uint64_t mixed = nonZero & (nonZero >> offset) & ((nBits ^ (nBits >> offset)) | (mBits ^ (mBits >> offset))) & inRange;
+                failures |= spreadPairs(int(foldSlices(odd) | foldSlices(mixed)), offset);
+            }
+            return failures;
+        }
+        // Rows and columns
+        constexpr bool isNormalized() const requires (ROWS == COLS) { return (rowNormalizationFailures() | colNormalizationFailures()) == 0; }
+        constexpr bool isOrthogonal() const requires (ROWS == COLS) { return (rowOrthogonalityFailures() | colOrthogonalityFailures()) == 0; }
+        constexpr bool isOrthonormal() const requires (ROWS == COLS) { return isNormalized() && isOrthogonal(); }
+
+        transposeType transposed() const;
+        // 2s swapped for 3s and 3s swapped for 2s -> flip M wherever N is set
+        constexpr bitPlaneMatrix swapped23() const { return bitPlaneMatrix(nBits, mBits ^ nBits); }
+        // 1s swapped for 2s and 2s swapped for 1s -> the planes trade places, this is how the old and new encodings differ
+        constexpr bitPlaneMatrix swapped12() const { return bitPlaneMatrix(mBits, nBits); }
+        // Case style view of the pattern, 0s for 0,1 and 1s for 2,3
+        constexpr bitPlaneMatrix caseView() const { return bitPlaneMatrix(0, nBits); }
+        // Row r of the result is row rowOrder[r] of this matrix and column c is column colOrder[c]
+        bitPlaneMatrix permuted(const std::array<int, ROWS> &rowOrder, const std::array<int, COLS> &colOrder) const;
+        bitPlaneMatrix swappedRows(int i, int j) const;
+        bitPlaneMatrix swappedColumns(int i, int j) const;
+
+        // Row and column permutation invariant form of the matrix
+        //  Two matrices are rearrangements of each other iff their canonical forms are equal
+        bitPlaneMatrix canonical() const;
+        uint64_t canonicalHash() const { return canonical().hash(); }
+        // Smallest canonical form of the pattern, its transpose and their 2/3 swaps
+        //  Patterns that patternMatrix::isDuplicate matches share this form
+        bitPlaneMatrix orbitCanonical() const requires (ROWS == COLS);
+
+        uint64_t hash() const;
+        std::string toString() const;
+
+        constexpr bool operator==(const bitPlaneMatrix &other) const = default;
+        constexpr bool operator<(const bitPlaneMatrix &other) const {
+            return (nBits != other.nBits) ? nBits < other.nBits : mBits < other.mBits;
+        }
+
+    private:
+        // Bit 0 of every row slice
+        static constexpr uint64_t SLICE_LOW_BITS = PLANE_MASK / ROW_MASK;
+        // Bits 0 and 1 of every row slice
+        static constexpr uint64_t SLICE_COUNT_MASK = 3 * SLICE_LOW_BITS;
+
+        // Popcount of every row slice, left in the low bits of the slice
+        static constexpr uint64_t sliceCounts(uint64_t bits) {
+            uint64_t counts = 0;
+            for (int col = 0; col < COLS; col++) counts += (bits >> col) & SLICE_LOW_BITS;
+            return counts;
+        }
+        // Parity of every row slice in bit 0 of the slice, the other bits are junk
+        static constexpr uint64_t sliceParity(uint64_t bits) {
+            uint64_t x = bits;
+            for (int col = 1; col < COLS; col++) x ^= bits >> col;
+            return x;
+        }
+        // XOR of all the row slices -> bit c is the parity of column c
+        static constexpr uint64_t foldSlices(uint64_t bits) {
+            uint64_t x = 0;
+            for (int row = 0; row < ROWS; row++) x ^= bits >> (row * COLS);
+            return x & ROW_MASK;
+        }
+        // Bit 0 of slice r -> bit r
+        static constexpr int gatherSlices(uint64_t lowBits) {
+            int gathered = 0;
+            for (int row = 0; row < ROWS; row++) gathered |= int((lowBits >> (row * COLS)) & 1) << row;
+            return gathered;
+        }
+        // Bit i -> bit (i * Cols + i + offset), the pair (i, i+offset) in the failure masks
+        static constexpr uint64_t spreadPairs(int bits, int offset) {
+            uint64_t pairs = 0;
+            for (int i = 0; i + offset < ROWS; i++) pairs |= uint64_t((bits >> i) & 1) << (i * COLS + i + offset);
+            return pairs;
+        }
+};
+
+// Same output as zmatrix -> [a,b,c,d,e,f][...]...
+template <int Rows, int Cols, int MaxValue>
+std::ostream& operator<<(std::ostream&, const bitPlaneMatrix<Rows, Cols, MaxValue> &);
+
+// The pattern size and the sizes kept around for other studies
+//  These are the only instances built in packed-matrix.cpp, add a line there for any other size
+using packedMatrix = bitPlaneMatrix<6, 6, 3>;
+using packedMatrix4 = bitPlaneMatrix<4, 4, 3>;
+using packedMatrix8 = bitPlaneMatrix<8, 8, 3>;
+using packedCaseInvariants = packedMatrix::caseInvariantsType;
+
+extern template class bitPlaneMatrix<4, 4, 3>;
+extern template class bitPlaneMatrix<6, 6, 3>;
+extern template class bitPlaneMatrix<8, 8, 3>;
+
+template <int Rows, int Cols, int MaxValue>
+struct std::hash<bitPlaneMatrix<Rows, Cols, MaxValue>> {
+    size_t operator()(const bitPlaneMatrix<Rows, Cols, MaxValue> &pm) const { return pm.hash(); }
+};
+
+#endif // PACKED_MATRIX_HPP
@@ -0,0 +1,398 @@
+#include "packed-matrix.hpp"
+#include "zmatrix.hpp"
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <unordered_set>
+
+std::vector<std::vector<int>> PATTERN_B = {
+    {3, 2, 0, 0, 0, 0},
+    {3, 2, 0, 0, 0, 0},
+    {1, 1, 3, 3, 1, 1},
+    {1, 1, 3, 3, 1, 1},
+    {0, 0, 0, 0, 3, 2},
+    {0, 0, 0, 0, 2, 3}
+};
+
+std::vector<std::vector<int>> CASE7 = {
+    {1, 1, 0, 0, 0, 0},
+    {1, 1, 0, 0, 0, 0},
+    {0, 0, 1, 1, 0, 0},
+    {0, 0, 1, 1, 0, 0},
+    {0, 0, 0, 0, 1, 1},
+    {0, 0, 0, 0, 1, 1}
+};
+
+zmatrix makeZMatrix(std::vector<std::vector<int>> values, int maxValue) {
+    zmatrix zm = zmatrix(6, 6, maxValue);
+    zm.z = values;
+    zm.updateMetadata();
+    return zm;
+}
+
+TEST(PackedMatrixTest, GetAndSet) {
+    packedMatrix pm;
+    EXPECT_EQ(pm.sum(), 0);
+    for (int v = 0; v < 4; v++) {
+        pm.set(2, 3, v);
+        EXPECT_EQ(pm.get(2, 3), v);
+        EXPECT_EQ(pm.sum(), v);
+    }
+    pm.set(5, 5, 2);
+    EXPECT_EQ(pm.nBits, (uint64_t(1) << 35) | (uint64_t(1) << 15));
+    EXPECT_EQ(pm.mBits, uint64_t(1) << 15);
+    EXPECT_EQ(pm.count(0), 34);
+    EXPECT_EQ(pm.count(2), 1);
+    EXPECT_EQ(pm.count(3), 1);
+}
+
+TEST(PackedMatrixTest, ZMatrixRoundTrip) {
+    zmatrix zPattern = makeZMatrix(PATTERN_B, 3);
+    packedMatrix pm = zPattern.toPacked();
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            EXPECT_EQ(pm.get(i, j), PATTERN_B[i][j]);
+        }
+    }
+    EXPECT_EQ(pm.sum(), zPattern.getSum());
+    for (int v = 0; v < 4; v++) EXPECT_EQ(pm.count(v), zPattern.getNumCounts()[v]);
+    zmatrix unpacked = zmatrix(pm);
+    EXPECT_TRUE(unpacked.strictMatch(zPattern));
+    EXPECT_EQ(unpacked.getSum(), zPattern.getSum());
+    EXPECT_EQ(unpacked.getRowPairCounts(), zPattern.getRowPairCounts());
+    std::stringstream ss;
+    ss << zPattern;
+    EXPECT_EQ(pm.toString(), ss.str());
+
+    zmatrix zCase = makeZMatrix(CASE7, 1);
+    packedMatrix pc = zCase.toPacked();
+    EXPECT_EQ(pc.nBits, 0);
+    EXPECT_EQ(pc.sum(), 12);
+    EXPECT_TRUE(zmatrix(pc, 1).strictMatch(zCase));
+
+    // Case view of a pattern is the same as the case matrix it was built from
+    EXPECT_EQ(makeZMatrix(PATTERN_B, 3).toPacked().caseView().sum(), 12);
+}
+
+TEST(PackedMatrixTest, NotPackable) {
+    zmatrix big = zmatrix(8, 8, 3);
+    EXPECT_FALSE(big.isPackable());
+    EXPECT_THROW(big.toPacked(), std::runtime_error);
+    zmatrix groupings = zmatrix(6, 6, 36);
+    EXPECT_THROW(groupings.toPacked(), std::runtime_error);
+}
+
+TEST(PackedMatrixTest, Transforms) {
+    packedMatrix pm = makeZMatrix(PATTERN_B, 3).toPacked();
+    packedMatrix t = pm.transposed();
+    packedMatrix s = pm.swapped23();
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            EXPECT_EQ(t.get(j, i), PATTERN_B[i][j]);
+            int v = PATTERN_B[i][j];
+            EXPECT_EQ(s.get(i, j), v == 2 ? 3 : (v == 3 ? 2 : v));
+        }
+    }
+    EXPECT_EQ(t.transposed(), pm);
+    EXPECT_EQ(s.swapped23(), pm);
+
+    packedMatrix r = pm.swappedRows(0, 4);
+    packedMatrix c = pm.swappedColumns(5, 1);
+    for (int j = 0; j < 6; j++) {
+        EXPECT_EQ(r.get(0, j), PATTERN_B[4][j]);
+        EXPECT_EQ(r.get(4, j), PATTERN_B[0][j]);
+        EXPECT_EQ(c.get(j, 1), PATTERN_B[j][5]);
+        EXPECT_EQ(c.get(j, 5), PATTERN_B[j][1]);
+    }
+    EXPECT_EQ(r.swappedRows(4, 0), pm);
+    EXPECT_EQ(c.swappedColumns(1, 5), pm);
+
+    std::array<int, 6> identity = {0, 1, 2, 3, 4, 5};
+    std::array<int, 6> rowOrder = {4, 1, 2, 3, 0, 5};
+    std::array<int, 6> colOrder = {0, 5, 2, 3, 4, 1};
+    EXPECT_EQ(pm.permuted(identity, identity), pm);
+    EXPECT_EQ(pm.permuted(rowOrder, identity), r);
+    EXPECT_EQ(pm.permuted(identity, colOrder), c);
+    EXPECT_EQ(pm.permuted(rowOrder, colOrder), r.swappedColumns(5, 1));
+}
+
+TEST(PackedMatrixTest, EqualityAndHash) {
+    packedMatrix a = makeZMatrix(PATTERN_B, 3).toPacked();
+    packedMatrix b = makeZMatrix(PATTERN_B, 3).toPacked();
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.hash(), b.hash());
+    b.set(0, 0, 2);
+    EXPECT_NE(a, b);
+
+    std::unordered_set<packedMatrix> seen;
+    seen.insert(a);
+    seen.insert(b);
+    seen.insert(a.transposed());
+    seen.insert(a);
+    EXPECT_EQ(seen.size(), 3);
+}
+
+TEST(PackedMatrixTest, CanonicalIgnoresRearrangements) {
+    packedMatrix pm = makeZMatrix(PATTERN_B, 3).toPacked();
+    packedMatrix canonical = pm.canonical();
+    EXPECT_EQ(canonical.canonical(), canonical);
+    EXPECT_EQ(canonical.sum(), pm.sum());
+
+    packedMatrix shuffled = pm;
+    int swaps[][2] = {{0, 3}, {5, 1}, {2, 4}, {1, 0}, {3, 5}, {4, 4}};
+    for (auto &swap : swaps) {
+        shuffled = shuffled.swappedRows(swap[0], swap[1]);
+        EXPECT_EQ(shuffled.canonical(), canonical);
+        shuffled = shuffled.swappedColumns(swap[1], swap[0]);
+        EXPECT_EQ(shuffled.canonical(), canonical);
+    }
+    EXPECT_EQ(shuffled.canonicalHash(), pm.canonicalHash());
+
+    packedMatrix changed = pm;
+    changed.set(0, 0, 2);
+    EXPECT_NE(changed.canonical(), canonical);
+    // The 2/3 swap of PATTERN_B is a different pattern
+    EXPECT_NE(pm.swapped23().canonical(), canonical);
+}
+
+TEST(PackedMatrixTest, PairCounts) {
+    packedMatrix pm = makeZMatrix(PATTERN_B, 3).toPacked();
+    packedMatrix::pairTable pairs;
+    packedMatrix::valuePairTable valuePairs;
+    pm.rowPairCounts(pairs);
+    pm.rowValuePairCounts(valuePairs);
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            int expected = 0;
+            int expectedValues[4] = {0, 0, 0, 0};
+            for (int k = 0; k < 6; k++) {
+                if (PATTERN_B[i][k] == PATTERN_B[j][k]) {
+                    expected++;
+                    expectedValues[PATTERN_B[i][k]]++;
+                }
+            }
+            EXPECT_EQ(pairs[i][j], expected) << "rows " << i << ", " << j;
+            for (int v = 0; v < 4; v++) EXPECT_EQ(valuePairs[i][j][v], expectedValues[v]);
+        }
+    }
+    // Column pair counts come from the transpose
+    pm.transposed().rowPairCounts(pairs);
+    EXPECT_EQ(pairs[0][1], 4);
+    EXPECT_EQ(pairs[2][3], 6);
+    EXPECT_EQ(pairs[4][5], 4);
+}
+
+TEST(PackedMatrixTest, CaseInvariants) {
+    packedCaseInvariants inv = makeZMatrix(CASE7, 1).toPacked().caseInvariants();
+    EXPECT_EQ(inv.sum, 12);
+    EXPECT_EQ(inv.rowCounts[2], 6);
+    EXPECT_EQ(inv.colCounts[2], 6);
+    // Each row matches itself and its partner in all 6 places and the other 4 rows in 2 places
+    EXPECT_EQ(inv.rowPairs[6], 12);
+    EXPECT_EQ(inv.rowPairs[2], 24);
+    EXPECT_EQ(inv.transposed(), inv);
+
+    // Rearranging doesn't change the invariants but transposing swaps the row and column halves
+    packedMatrix c = packedMatrix(0, 0b000011000011000011000011);
+    packedMatrix shuffled = c.swappedRows(0, 5).swappedColumns(1, 4);
+    EXPECT_EQ(shuffled.caseInvariants(), c.caseInvariants());
+    EXPECT_EQ(c.transposed().caseInvariants(), c.caseInvariants().transposed());
+    EXPECT_NE(c.transposed().caseInvariants(), c.caseInvariants());
+}
+
+TEST(PackedMatrixTest, Orthonormality) {
+    zmatrix zm = makeZMatrix({
+        {0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 1, 1},
+        {0, 0, 0, 1, 2, 2},
+        {0, 0, 0, 1, 2, 2}
+    }, 3);
+    packedMatrix pm = zm.toPacked();
+    EXPECT_EQ(pm.rowNormalizationFailures(), 0);
+    EXPECT_EQ(pm.rowOrthogonalityFailures(), 0);
+    EXPECT_TRUE(pm.isNormalized());
+    EXPECT_TRUE(pm.isOrthogonal());
+
+    // A single 3 in row 3 breaks rule ii for that row and rule iv against rows 4 and 5
+    packedMatrix broken = pm;
+    broken.set(3, 4, 3);
+    EXPECT_EQ(broken.rowNormalizationFailures(), 1 << 3);
+    EXPECT_EQ(broken.rowOrthogonalityFailures(), (uint64_t(1) << (3 * 6 + 4)) | (uint64_t(1) << (3 * 6 + 5)));
+    EXPECT_FALSE(broken.isNormalized());
+    EXPECT_FALSE(broken.isOrthogonal());
+    EXPECT_FALSE(broken.transposed().isNormalized());
+    EXPECT_FALSE(makeZMatrix(PATTERN_B, 3).toPacked().isNormalized());
+    EXPECT_FALSE(broken.isOrthonormal());
+    EXPECT_TRUE(pm.isOrthonormal());
+
+    // The same entry breaks column 4 and its pair with column 5, column 3 still has two even pairs with it
+    EXPECT_EQ(broken.colNormalizationFailures(), 1 << 4);
+    EXPECT_EQ(broken.colOrthogonalityFailures(), uint64_t(1) << (4 * 6 + 5));
+    static_assert(packedMatrix().isOrthonormal());
+}
+
+// The mij = Nij + 2*Mij sums straight from patternMatrix::isNormalized / isOrthogonal
+template <typename Matrix>
+static int refRowFailures(const Matrix &pm) {
+    int failures = 0;
+    for (int i = 0; i < Matrix::ROWS; i++) {
+        int sum = 0;
+        int threes = 0;
+        for (int j = 0; j < Matrix::COLS; j++) {
+            int mij = pm.get(i, j) / 2 + 2 * (pm.get(i, j) % 2);
+            sum += mij;
+            if (mij == 3) threes++;
+        }
+        if (sum % 4 != 0 || threes % 2 != 0) failures |= 1 << i;
+    }
+    return failures;
+}
+
+template <typename Matrix>
+static uint64_t refRowPairFailures(const Matrix &pm) {
+    uint64_t failures = 0;
+    for (int i = 0; i < Matrix::ROWS; i++) {
+        for (int j = i + 1; j < Matrix::ROWS; j++) {
+            int dot = 0;
+            int pairs = 0;
+            for (int k = 0; k < Matrix::COLS; k++) {
+                int mik = pm.get(i, k) / 2 + 2 * (pm.get(i, k) % 2);
+                int mjk = pm.get(j, k) / 2 + 2 * (pm.get(j, k) % 2);
+                dot += mik * mjk;
+                if (mik != 0 && mjk != 0 && mik != mjk) pairs++;
+            }
+            if (dot % 2 != 0 || pairs % 2 != 0) failures |= uint64_t(1) << (i * Matrix::COLS + j);
+        }
+    }
+    return failures;
+}
+
+// Random matrices of any size checked against the sums above
+template <typename Matrix>
+static void checkOrthonormalityMatchesSums(int rounds) {
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int n = 0; n < rounds; n++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        uint64_t nBits = state;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        // Thin the entries out every other round so plenty of the matrices pass
+        Matrix pm = (n % 2) ? Matrix(nBits & state, state & (state >> 3)) : Matrix(nBits, state);
+        Matrix t = pm.transposed();
+        ASSERT_EQ(pm.rowNormalizationFailures(), refRowFailures(pm)) << pm;
+        ASSERT_EQ(pm.colNormalizationFailures(), refRowFailures(t)) << pm;
+        ASSERT_EQ(pm.rowOrthogonalityFailures(), refRowPairFailures(pm)) << pm;
+        ASSERT_EQ(pm.colOrthogonalityFailures(), refRowPairFailures(t)) << pm;
+        for (int i = 0; i < Matrix::ROWS; i++) {
+            EXPECT_EQ(Matrix::isRowNormalized(pm.rowN(i), pm.rowM(i)), (refRowFailures(pm) & (1 << i)) == 0);
+            for (int j = i + 1; j < Matrix::ROWS; j++) {
+                bool orthogonal = (refRowPairFailures(pm) & (uint64_t(1) << (i * Matrix::COLS + j))) == 0;
+                EXPECT_EQ(Matrix::areRowsOrthogonal(pm.rowN(i), pm.rowM(i), pm.rowN(j), pm.rowM(j)), orthogonal);
+            }
+        }
+    }
+}
+
+TEST(PackedMatrixTest, OrthonormalityMatchesSums) {
+    checkOrthonormalityMatchesSums<packedMatrix>(20000);
+}
+
+// The 4x4 and 8x8 instances run the same kernels with their own slice widths
+TEST(PackedMatrixTest, OtherSizesMatchSums) {
+    checkOrthonormalityMatchesSums<packedMatrix4>(5000);
+    checkOrthonormalityMatchesSums<packedMatrix8>(5000);
+    static_assert(packedMatrix4().isOrthonormal());
+    static_assert(packedMatrix8::PLANE_MASK == ~uint64_t(0));
+}
+
+TEST(PackedMatrixTest, OtherSizesMatchZMatrix) {
+    // Every value in every row of the 8x8 and a shifted copy of it in the 4x4
+    packedMatrix8 big;
+    packedMatrix4 small;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            big.set(i, j, (i * 3 + j * j) % 4);
+            if (i < 4 && j < 4) small.set(i, j, (i + j / 2) % 4);
+        }
+    }
+    std::stringstream ss;
+    ss << big;
+    EXPECT_EQ(big.toString(), ss.str());
+    EXPECT_EQ(big.transposed().transposed(), big);
+    EXPECT_EQ(small.transposed().transposed(), small);
+
+    zmatrix zBig = zmatrix(8, 8, 3);
+    zmatrix zSmall = zmatrix(4, 4, 3);
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            zBig.z[i][j] = big.get(i, j);
+            if (i < 4 && j < 4) zSmall.z[i][j] = small.get(i, j);
+        }
+    }
+    zBig.updateMetadata();
+    zSmall.updateMetadata();
+    EXPECT_EQ(zBig.getSum(), big.sum());
+    EXPECT_EQ(zSmall.getSum(), small.sum());
+
+    packedMatrix8::pairTable pairs;
+    packedMatrix8::valuePairTable valuePairs;
+    big.rowPairCounts(pairs);
+    big.rowValuePairCounts(valuePairs);
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            int expected = 0;
+            int expectedValues[4] = {0, 0, 0, 0};
+            for (int k = 0; k < 8; k++) {
+                if (big.get(i, k) == big.get(j, k)) {
+                    expected++;
+                    expectedValues[big.get(i, k)]++;
+                }
+            }
+            EXPECT_EQ(pairs[i][j], expected) << "rows " << i << ", " << j;
+            for (int v = 0; v < 4; v++) EXPECT_EQ(valuePairs[i][j][v], expectedValues[v]);
+            // zmatrix counts its 8x8 pairs on the same planes
+            EXPECT_EQ(zBig.getRowPairCounts()[i][j], expected);
+            if (i != j) {
+                for (int v = 0; v < 4; v++) EXPECT_EQ(zBig.getRowValuePairCounts()[i][j][v], expectedValues[v]);
+            }
+        }
+    }
+    big.transposed().rowPairCounts(pairs);
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) EXPECT_EQ(zBig.getColPairCounts()[i][j], pairs[i][j]);
+    }
+
+    // Rearranging rows and columns keeps the canonical form, changing an entry doesn't
+    packedMatrix8 canonical = big.canonical();
+    std::array<int, 8> rowOrder = {7, 2, 5, 0, 1, 6, 3, 4};
+    std::array<int, 8> colOrder = {1, 0, 3, 2, 6, 7, 4, 5};
+    EXPECT_EQ(big.permuted(rowOrder, colOrder).canonical(), canonical);
+    EXPECT_EQ(big.swappedRows(0, 7).swappedColumns(2, 6).canonical(), canonical);
+    EXPECT_EQ(big.transposed().orbitCanonical(), big.orbitCanonical());
+    packedMatrix8 changed = big;
+    changed.set(7, 7, (big.get(7, 7) + 1) % 4);
+    EXPECT_NE(changed.canonical(), canonical);
+    std::array<int, 4> smallOrder = {3, 1, 0, 2};
+    EXPECT_EQ(small.permuted(smallOrder, smallOrder).canonical(), small.canonical());
+
+    packedMatrix4::caseInvariantsType inv = small.caseView().caseInvariants();
+    EXPECT_EQ(inv.sum, small.caseView().sum());
+    EXPECT_EQ(small.caseView().swappedRows(0, 3).caseInvariants(), inv);
+}
+
+TEST(PackedMatrixTest, OrbitCanonical) {
+    packedMatrix pm = makeZMatrix(PATTERN_B, 3).toPacked();
+    packedMatrix orbit = pm.orbitCanonical();
+    EXPECT_EQ(pm.transposed().orbitCanonical(), orbit);
+    EXPECT_EQ(pm.swapped23().orbitCanonical(), orbit);
+    EXPECT_EQ(pm.swapped23().transposed().swappedRows(1, 4).orbitCanonical(), orbit);
+    EXPECT_FALSE(pm.canonical() < orbit);
+    packedMatrix changed = pm;
+    changed.set(0, 0, 1);
+    EXPECT_NE(changed.orbitCanonical(), orbit);
+}
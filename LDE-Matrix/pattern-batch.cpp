@@ -0,0 +1,118 @@
+#include "pattern-batch.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "pattern-core.hpp"
+#include "pattern-parser.hpp"
+#include "subcase-rules.hpp"
+
+void patternBatch::reserve(size_t n) {
+    nBits.reserve(n);
+    mBits.reserve(n);
+    ids.reserve(n);
+    caseMatches.reserve(n);
+    subCaseMatches.reserve(n);
+    sums.reserve(n);
+    flags.reserve(n);
+    duplicateOf.reserve(n);
+}
+
+void patternBatch::clear() {
+    nBits.clear();
+    mBits.clear();
+    ids.clear();
+    caseMatches.clear();
+    subCaseMatches.clear();
+    sums.clear();
+    flags.clear();
+    duplicateOf.clear();
+}
+
+void patternBatch::add(int id, const packedMatrix &pattern) {
+    nBits.push_back(pattern.nBits);
+    mBits.push_back(pattern.mBits);
+    ids.push_back(id);
+    caseMatches.push_back(-1);
+    subCaseMatches.push_back('-');
+    sums.push_back(pattern.sum());
+    flags.push_back(0);
+    duplicateOf.push_back(-1);
+}
+
+void patternBatch::add(int id, const std::string &matrix, bool newEncoding) {
+    add(id, parse(matrix, newEncoding));
+}
+
+patternMatrix patternBatch::toPatternMatrix(size_t i) const {
+    patternMatrix pm(patternCore(ids[i], pattern(i)));
+    pm.caseMatch = caseMatches[i];
+    pm.subCaseMatch = subCaseMatches[i];
+    return pm;
+}
+
+packedMatrix patternBatch::parse(std::string_view m, bool newEncoding) {
+    return patternParser::parse(m, newEncoding);
+}
+
+size_t patternBatch::load(std::istream &is, bool newEncoding) {
+    size_t added = 0;
+    std::string line;
+    packedMatrix p;
+    while (std::getline(is, line)) {
+        int id = int(added) + 1;
+        if (!patternParser::parseLine(line, id, p, newEncoding)) continue;
+        add(id, p);
+        added++;
+    }
+    return added;
+}
+
+size_t patternBatch::loadFromFile(const std::string &filename, bool newEncoding) {
+    std::ifstream file(filename);
+    if (!file.is_open()) throw std::runtime_error("Error opening file: " + filename);
+    return load(file, newEncoding);
+}
+
+void patternBatch::classify() {
+    for (size_t i = 0; i < size(); i++) {
+        patternCore pc(ids[i], pattern(i));
+        caseMatches[i] = pc.matchOnCases();
+    }
+}
+
+void patternBatch::classifySubCases() {
+    const subCaseTable &table = subCaseTable::instance();
+    for (size_t i = 0; i < size(); i++) {
+        char subCase = '-';
+        if (!table.match(caseMatches[i], pattern(i), subCase)) subCase = '-';
+        subCaseMatches[i] = subCase;
+    }
+}
+
+void patternBatch::checkOrthonormality() {
+    for (size_t i = 0; i < size(); i++) {
+        packedMatrix p = pattern(i);
+        uint8_t f = flags[i] & ~(NORMALIZED | ORTHOGONAL);
+        if (p.isNormalized()) f |= NORMALIZED;
+        if (p.isOrthogonal()) f |= ORTHOGONAL;
+        flags[i] = f;
+    }
+}
+
+size_t patternBatch::dedup() {
+    std::unordered_map<packedMatrix, int> firstSeen;
+    firstSeen.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+        auto [it, inserted] = firstSeen.try_emplace(pattern(i).orbitCanonical(), int(i));
+        if (inserted) {
+            duplicateOf[i] = -1;
+            flags[i] &= ~DUPLICATE;
+        } else {
+            duplicateOf[i] = it->second;
+            flags[i] |= DUPLICATE;
+        }
+    }
+    return firstSeen.size();
+}
@@ -0,0 +1,65 @@
+#ifndef PATTERN_BATCH_HPP
+#define PATTERN_BATCH_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "packed-matrix.hpp"
+#include "pattern-matrix.hpp"
+
+// A batch of patterns kept as parallel arrays instead of a std::vector<patternMatrix>
+//  Each pattern is 2 words of packed bits plus a few bytes of results, so millions of them fit in memory
+//  The kernels sweep the arrays front to back and only touch the arrays they need
+//  Anything that needs the full patternMatrix (T-Gates, LDE reduction, subcases) can build one with toPatternMatrix
+class patternBatch {
+    public:
+        // Bits in flags
+        static constexpr uint8_t NORMALIZED = 1;
+        static constexpr uint8_t ORTHOGONAL = 2;
+        static constexpr uint8_t DUPLICATE = 4;
+
+        std::vector<uint64_t> nBits;       // packedMatrix::nBits of each pattern
+        std::vector<uint64_t> mBits;       // packedMatrix::mBits of each pattern
+        std::vector<int> ids;
+        std::vector<int8_t> caseMatches;   // -1 when no case matched or classify hasn't run
+        std::vector<char> subCaseMatches;  // '-' until a subcase is assigned
+        std::vector<uint8_t> sums;
+        std::vector<uint8_t> flags;
+        std::vector<int> duplicateOf;      // Index of the first pattern in the same dedup group, -1 for the first one
+
+        size_t size() const { return ids.size(); }
+        bool empty() const { return ids.empty(); }
+        void reserve(size_t n);
+        void clear();
+        void add(int id, const packedMatrix &pattern);
+        void add(int id, const std::string &matrix, bool newEncoding = false);
+        packedMatrix pattern(size_t i) const { return packedMatrix(nBits[i], mBits[i]); }
+        bool hasFlag(size_t i, uint8_t flag) const { return (flags[i] & flag) != 0; }
+        patternMatrix toPatternMatrix(size_t i) const;
+
+        // One pattern per line, either "[0 0,0 1,...][...]", "[0,1,...][...]" or "[[0 1 ...] [...]]"
+        //  A number before the first [ is used as the id, otherwise a pattern's id is its place among the patterns in the file, from 1
+        //  Comment lines don't count so a file with a # header still numbers its first pattern 1
+        //  Blank lines and # comments are skipped and anything after the last ] is ignored
+        //  Returns the number of patterns added
+        size_t load(std::istream &is, bool newEncoding = false);
+        size_t loadFromFile(const std::string &filename, bool newEncoding = false);
+        // patternParser::parse, kept here so callers of the batch don't need another include
+        static packedMatrix parse(std::string_view m, bool newEncoding = false);
+
+        // Kernels
+        //  Sets caseMatches with the same rules as patternMatrix::matchOnCases
+        void classify();
+        //  Sets subCaseMatches from SUBCASE_RULES for every pattern with a case, as patternMatrix::determineSubCase would
+        //  The rules look at fixed rows and columns so the patterns should already be lined up with their cases
+        void classifySubCases();
+        //  Sets the NORMALIZED and ORTHOGONAL flags
+        void checkOrthonormality();
+        //  Groups the patterns the same way patternMatrix::isDuplicate does, sets DUPLICATE / duplicateOf and returns the number of groups
+        size_t dedup();
+};
+
+#endif // PATTERN_BATCH_HPP
@@ -0,0 +1,99 @@
+#include "pattern-batch.hpp"
+#include "pattern-matrix.hpp"
+#include "data/embedded-patterns.hpp"
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST(PatternBatchTest, Parse) {
+    packedMatrix pairs = patternBatch::parse("[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 0,1 0]");
+    packedMatrix numbers = patternBatch::parse("[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]");
+    packedMatrix spaces = patternBatch::parse("[[0 0 0 0 0 0] [0 0 0 0 0 0] [0 0 0 0 0 0] [0 0 0 0 1 1] [0 0 0 1 2 2] [0 0 0 1 2 2]] LDE1only");
+    EXPECT_EQ(pairs, numbers);
+    EXPECT_EQ(spaces, numbers);
+    EXPECT_EQ(numbers.get(4, 3), 1);
+    EXPECT_EQ(numbers.get(4, 4), 2);
+    EXPECT_EQ(numbers.sum(), 12);
+
+    // The new encoding swaps 1s and 2s
+    packedMatrix newEncoding = patternBatch::parse("[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,2,2][0,0,0,2,1,1][0,0,0,2,1,1]", true);
+    EXPECT_EQ(newEncoding, numbers);
+
+    EXPECT_THROW(patternBatch::parse(""), std::runtime_error);
+    EXPECT_THROW(patternBatch::parse("[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2]"), std::runtime_error);
+    EXPECT_THROW(patternBatch::parse("[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2][0,0,0,0,0,0]"), std::runtime_error);
+    EXPECT_THROW(patternBatch::parse("[0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]"), std::runtime_error);
+    EXPECT_THROW(patternBatch::parse("[0,0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]"), std::runtime_error);
+    EXPECT_THROW(patternBatch::parse("[0,0,0,0,0,4][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]"), std::runtime_error);
+}
+
+TEST(PatternBatchTest, Load) {
+    std::istringstream is(
+        "# Comments and blank lines are skipped\n"
+        "[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]\n"
+        "\n"
+        "352000584 [1,1,3,3,0,0][1,1,3,3,0,0][0,0,0,0,2,2][0,0,0,0,2,2][3,3,3,3,0,0][3,3,3,3,0,0]\n"
+        "[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,1,1,1,1][0,0,2,2,2,2][0,0,2,2,2,2]\n");
+    patternBatch batch;
+    EXPECT_EQ(batch.load(is), 3);
+    ASSERT_EQ(batch.size(), 3);
+    EXPECT_EQ(batch.ids[0], 1);
+    EXPECT_EQ(batch.ids[1], 352000584);
+    // The third pattern is on line 5, it's numbered by the patterns before it
+    EXPECT_EQ(batch.ids[2], 3);
+    EXPECT_EQ(batch.sums[0], 12);
+    EXPECT_EQ(batch.sums[1], 48);
+    EXPECT_EQ(batch.caseMatches[1], -1);
+    EXPECT_EQ(batch.subCaseMatches[1], '-');
+    EXPECT_EQ(batch.duplicateOf[1], -1);
+    EXPECT_EQ(batch.pattern(1).get(4, 0), 3);
+
+    patternMatrix pm = batch.toPatternMatrix(1);
+    EXPECT_EQ(pm.id, 352000584);
+    EXPECT_EQ(pm.toString(), batch.pattern(1).toString());
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+}
+
+// Every 928 pattern should get the same results from the batch kernels as it does from patternMatrix
+TEST(PatternBatchTest, Patterns928) {
+    patternBatch batch;
+    batch.reserve(EMBEDDED_928.size());
+    for (const embedded928Pattern &embedded : EMBEDDED_928) batch.add(embedded.id, embedded.pattern);
+    batch.classify();
+    batch.classifySubCases();
+    batch.checkOrthonormality();
+    for (size_t i = 0; i < batch.size(); i++) {
+        patternMatrix pm = patternMatrix(batch.ids[i], pattern928(batch.ids[i]).pattern.toString());
+        pm.matchOnCases();
+        EXPECT_EQ(batch.caseMatches[i], pm.caseMatch) << "Pattern " << batch.ids[i];
+        pm.determineSubCase();
+        EXPECT_EQ(batch.subCaseMatches[i], pm.subCaseMatch) << "Pattern " << batch.ids[i];
+        EXPECT_EQ(batch.hasFlag(i, patternBatch::NORMALIZED), pm.isNormalized()) << "Pattern " << batch.ids[i];
+        EXPECT_EQ(batch.hasFlag(i, patternBatch::ORTHOGONAL), pm.isOrthogonal()) << "Pattern " << batch.ids[i];
+    }
+    // The 928 patterns are already deduped
+    EXPECT_EQ(batch.dedup(), EMBEDDED_928.size());
+}
+
+TEST(PatternBatchTest, Dedup) {
+    patternBatch batch;
+    packedMatrix p759 = pattern928(759).pattern;
+    batch.add(759, p759);
+    batch.add(1, p759.transposed());
+    batch.add(2, p759.swapped23().swappedRows(0, 4));
+    batch.add(832, pattern928(832).pattern);
+    batch.add(867, pattern928(867).pattern);
+    // Same as the patternDeduper test -> 352000584 is a duplicate of 759
+    batch.add(352000584, "[1,1,3,3,0,0][1,1,3,3,0,0][0,0,0,0,2,2][0,0,0,0,2,2][3,3,3,3,0,0][3,3,3,3,0,0]", true);
+    EXPECT_EQ(batch.dedup(), 3);
+    EXPECT_EQ(batch.duplicateOf[0], -1);
+    EXPECT_EQ(batch.duplicateOf[1], 0);
+    EXPECT_EQ(batch.duplicateOf[2], 0);
+    EXPECT_EQ(batch.duplicateOf[3], -1);
+    EXPECT_EQ(batch.duplicateOf[4], -1);
+    EXPECT_EQ(batch.duplicateOf[5], 0);
+    EXPECT_FALSE(batch.hasFlag(0, patternBatch::DUPLICATE));
+    EXPECT_TRUE(batch.hasFlag(5, patternBatch::DUPLICATE));
+}
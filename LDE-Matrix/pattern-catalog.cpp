@@ -0,0 +1,36 @@
+#include "pattern-catalog.hpp"
+
+#include <format>
+#include <stdexcept>
+
+#include "subcase-rules.hpp"
+#include "data/embedded-patterns.hpp"
+
+// The patterns come already lined up with their case from patterns928-aligned.txt
+//  so only the subcase and the alignment are worked out here
+patternCatalog::patternCatalog() {
+    const caseRegistry &cases = caseRegistry::instance();
+    const subCaseTable &subCases = subCaseTable::instance();
+    patterns.reserve(PATTERNS);
+    for (const embedded928Pattern &embedded : EMBEDDED_928) {
+        catalogPattern entry;
+        entry.id = embedded.id;
+        entry.pattern = embedded.aligned;
+        entry.caseMatch = embedded.caseMatch;
+        entry.sum = embedded.sum;
+        subCases.match(entry.caseMatch, entry.pattern, entry.subCaseMatch);
+        const caseOrbitEntry *orbit = cases.lookup(entry.pattern.caseView().mBits);
+        if (entry.caseMatch != -1 && orbit != nullptr) entry.caseAlign = orbit->alignment;
+        patterns.push_back(entry);
+    }
+}
+
+const patternCatalog& patternCatalog::instance() {
+    static const patternCatalog catalog;
+    return catalog;
+}
+
+const catalogPattern& patternCatalog::operator[](int id) const {
+    if (id < 1 || id > PATTERNS) throw std::out_of_range(std::format("No 928 pattern {}", id));
+    return patterns[id - 1];
+}
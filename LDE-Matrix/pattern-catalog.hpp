@@ -0,0 +1,41 @@
+#ifndef PATTERN_CATALOG_HPP
+#define PATTERN_CATALOG_HPP
+
+#include <vector>
+
+#include "case-registry.hpp"
+#include "packed-matrix.hpp"
+
+// One of the 928 patterns, already rearranged so its case view lines up with its case
+struct catalogPattern {
+    int id = 0;
+    packedMatrix pattern;
+    int caseMatch = -1;
+    char subCaseMatch = '-';
+    int sum = 0;  // Sum of the entries, the bucket the deduper puts it in
+    caseAlignment caseAlign;  // How pattern lines up with caseMatch
+};
+
+// The 928 patterns, built once for the whole process and never changed after that
+//  patternMatrix(n) used to parse, rearrange and work out the subcase of pattern n every time it was asked for one,
+//  now it's a copy of the entry here, which starts from the packed patterns in embedded-patterns.hpp
+class patternCatalog {
+    public:
+        static constexpr int PATTERNS = 928;
+
+        static const patternCatalog& instance();
+
+        // Patterns are numbered from 1 like patterns928.txt, anything else throws std::out_of_range
+        const catalogPattern& operator[](int id) const;
+        std::vector<catalogPattern>::const_iterator begin() const { return patterns.begin(); }
+        std::vector<catalogPattern>::const_iterator end() const { return patterns.end(); }
+
+        patternCatalog(const patternCatalog &) = delete;
+        patternCatalog& operator=(const patternCatalog &) = delete;
+
+    private:
+        patternCatalog();
+        std::vector<catalogPattern> patterns;  // Pattern id is at id - 1
+};
+
+#endif // PATTERN_CATALOG_HPP
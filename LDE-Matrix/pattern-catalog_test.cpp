@@ -0,0 +1,61 @@
+#include "pattern-catalog.hpp"
+#include "pattern-matrix.hpp"
+#include "data/embedded-patterns.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <tuple>
+
+TEST(PatternCatalogTest, EveryPatternIsAligned) {
+    const patternCatalog &catalog = patternCatalog::instance();
+    const caseRegistry &cases = caseRegistry::instance();
+    int id = 1;
+    for (const catalogPattern &entry : catalog) {
+        EXPECT_EQ(entry.id, id++);
+        EXPECT_EQ(entry.sum, entry.pattern.sum());
+        EXPECT_EQ(entry.pattern.orbitCanonical(), pattern928(entry.id).canonical) << "Pattern " << entry.id;
+        if (entry.caseMatch > 0) {
+            EXPECT_EQ(entry.pattern.caseView(), cases.packed(entry.caseMatch)) << "Pattern " << entry.id;
+            EXPECT_EQ(entry.caseAlign.apply(entry.pattern).caseView(), cases.packed(entry.caseMatch)) << "Pattern " << entry.id;
+        }
+    }
+    EXPECT_EQ(id, patternCatalog::PATTERNS + 1);
+    EXPECT_THROW(catalog[0], std::out_of_range);
+    EXPECT_THROW(catalog[patternCatalog::PATTERNS + 1], std::out_of_range);
+}
+
+// patterns928-aligned.txt has to agree with rearranging patterns928.txt the way patternMatrix does
+TEST(PatternCatalogTest, AlignedFileMatchesTheRearrangement) {
+    for (const embedded928Pattern &embedded : EMBEDDED_928) {
+        patternMatrix pm = patternMatrix(embedded.id, embedded.pattern.toString());
+        pm.singleCaseRearrangement = true;
+        pm.rearrangeMatrix();
+        pm.loadFromString(pm.getFirstCaseRearrangement());
+        pm.determineSubCase();
+        const catalogPattern &entry = patternCatalog::instance()[embedded.id];
+        EXPECT_EQ(entry.pattern, pm.p.toPacked()) << "Pattern " << embedded.id;
+        EXPECT_EQ(entry.caseMatch, pm.caseMatch) << "Pattern " << embedded.id;
+        EXPECT_EQ(entry.subCaseMatch, pm.subCaseMatch) << "Pattern " << embedded.id;
+    }
+    // Sorted for the deduper buckets
+    for (size_t i = 1; i < EMBEDDED_928_BY_CASE_SUM.size(); i++) {
+        const embedded928Pattern &a = pattern928(EMBEDDED_928_BY_CASE_SUM[i - 1]);
+        const embedded928Pattern &b = pattern928(EMBEDDED_928_BY_CASE_SUM[i]);
+        EXPECT_LT(std::make_tuple(a.caseMatch, a.sum, a.id), std::make_tuple(b.caseMatch, b.sum, b.id));
+    }
+}
+
+TEST(PatternCatalogTest, PatternMatrixCopiesTheCatalog) {
+    for (int id = 1; id <= patternCatalog::PATTERNS; id++) {
+        const catalogPattern &entry = patternCatalog::instance()[id];
+        patternMatrix pm = patternMatrix(id);
+        EXPECT_EQ(pm.p.toPacked(), entry.pattern);
+        EXPECT_EQ(pm.originalMatrix, entry.pattern.toString());
+        EXPECT_EQ(pm.caseMatch, entry.caseMatch);
+        EXPECT_EQ(pm.subCaseMatch, entry.subCaseMatch);
+        EXPECT_EQ(pm.caseRearrangements.size(), (entry.caseMatch > 0) ? 1 : 0);
+        // Working the subcase out again gives the same answer
+        pm.determineSubCase();
+        EXPECT_EQ(pm.subCaseMatch, entry.subCaseMatch) << "Pattern " << id;
+    }
+}
@@ -0,0 +1,39 @@
+#include "pattern-core.hpp"
+
+#include <bit>
+
+int patternCore::matchOnCases() {
+    caseMatch = -1;
+    const caseRegistry &cases = caseRegistry::instance();
+    const caseOrbitEntry *entry = cases.lookup(p.caseView().mBits);
+    if (entry == nullptr) return caseMatch;
+    int caseId = cases[entry->caseIndex].id;
+    if (caseId == 2 && !case2Paired(p)) return caseMatch;
+    caseMatch = caseId;
+    caseAlign = entry->alignment;
+    return caseMatch;
+}
+
+bool patternCore::case2Paired(const packedMatrix &pattern) {
+    packedMatrix patternT = pattern.transposed();
+    int rc1 = -1;
+    int rc2 = -1;
+    for (int j = 0; j < packedMatrix::ROWS; j++) {
+        if (std::popcount(pattern.rowN(j)) == 4) {
+            if (rc1 == -1) rc1 = j;
+            else rc2 = j;
+        }
+    }
+    for (int j = 0; j < packedMatrix::COLS; j++) {
+        if (std::popcount(patternT.rowN(j)) == 4) {
+            if (rc1 == -1) rc1 = j;
+            else rc2 = j;
+        }
+    }
+    if (rc1 == -1 || rc2 == -1) return false;
+    packedMatrix::pairTable rowPairs;
+    packedMatrix::pairTable colPairs;
+    pattern.rowPairCounts(rowPairs);
+    patternT.rowPairCounts(colPairs);
+    return rowPairs[rc1][rc2] == 6 || colPairs[rc1][rc2] == 6;
+}
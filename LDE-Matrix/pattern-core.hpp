@@ -0,0 +1,46 @@
+#ifndef PATTERN_CORE_HPP
+#define PATTERN_CORE_HPP
+
+#include <iostream>
+#include <string>
+
+#include "case-registry.hpp"
+#include "packed-matrix.hpp"
+
+// The slice of a patternMatrix that the generators and the deduper actually use
+//  It's built straight from the packed bits -> no string round trip, no zmatrix views, no LDE / possible value tables
+//  Everything past the pattern itself is worked out when it's asked for
+//  Build a patternMatrix from it (patternMatrix(const patternCore &)) once a pattern is worth keeping
+class patternCore {
+    public:
+        patternCore() = default;
+        explicit patternCore(int patternNumber, const packedMatrix &pattern) : id(patternNumber), p(pattern) {}
+
+        int id = 0;
+        int caseMatch = -1;
+        caseAlignment caseAlign;  // How the pattern lines up with caseMatch, set by matchOnCases
+
+        const packedMatrix& pattern() const { return p; }
+
+        // Same rules as patternMatrix::matchOnCases, returns caseMatch
+        int matchOnCases();
+        bool isNormalized() const { return p.isNormalized(); }
+        bool isOrthogonal() const { return p.isOrthogonal(); }
+        bool isOrthonormal() const { return p.isOrthonormal(); }
+        // Key shared by every pattern that patternMatrix::isDuplicate would match with this one
+        packedMatrix dedupKey() const { return p.orbitCanonical(); }
+        // Old encoding, the same string as patternMatrix::toString
+        std::string toString() const { return p.toString(); }
+
+        // Case 2 requires that the rows / columns with the 4 case entries are fully paired
+        //  This follows patternMatrix::matchOnCases exactly, including the row and column indexes sharing rc1 / rc2
+        static bool case2Paired(const packedMatrix &pattern);
+
+        // New encoding, the same as printing a patternMatrix with the default flags
+        friend std::ostream& operator<<(std::ostream &os, const patternCore &pc) { return os << pc.p.swapped12(); }
+
+    private:
+        packedMatrix p;
+};
+
+#endif // PATTERN_CORE_HPP
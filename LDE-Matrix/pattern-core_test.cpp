@@ -0,0 +1,55 @@
+#include "pattern-core.hpp"
+#include "pattern-batch.hpp"
+#include "pattern-matrix.hpp"
+#include "data/embedded-patterns.hpp"
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+// Every 928 pattern should get the same answers from patternCore as it does from patternMatrix
+TEST(PatternCoreTest, Patterns928) {
+    const caseRegistry &cases = caseRegistry::instance();
+    for (const embedded928Pattern &embedded : EMBEDDED_928) {
+        int id = embedded.id;
+        patternMatrix pm = patternMatrix(id, embedded.pattern.toString());
+        pm.matchOnCases();
+        patternCore pc(id, pm.p.toPacked());
+        EXPECT_EQ(pc.matchOnCases(), pm.caseMatch) << "Pattern " << id;
+        EXPECT_EQ(pc.isNormalized(), pm.isNormalized()) << "Pattern " << id;
+        EXPECT_EQ(pc.isOrthogonal(), pm.isOrthogonal()) << "Pattern " << id;
+        EXPECT_EQ(pc.toString(), pm.toString()) << "Pattern " << id;
+        if (pc.caseMatch == -1) continue;
+        EXPECT_EQ(pc.caseAlign.apply(pc.pattern()).caseView(), cases.packed(pc.caseMatch)) << "Pattern " << id;
+    }
+}
+
+TEST(PatternCoreTest, NoCase) {
+    // 5 entries in the case view can't match any case
+    patternCore pc(7, patternBatch::parse("[2,2,2,0,0,0][2,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
+    EXPECT_EQ(pc.matchOnCases(), -1);
+    EXPECT_EQ(pc.caseMatch, -1);
+
+    // Case 2 entries that aren't fully paired
+    packedMatrix unpaired = patternBatch::parse("[2,2,0,0,0,0][2,3,0,0,0,0][2,2,0,0,0,0][2,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]");
+    patternMatrix pm = patternMatrix(1, unpaired.toString());
+    pm.matchOnCases();
+    EXPECT_EQ(patternCore(1, unpaired).matchOnCases(), pm.caseMatch);
+}
+
+TEST(PatternCoreTest, ToPatternMatrix) {
+    std::string p759 = pattern928(759).pattern.toString();
+    patternCore pc(759, patternBatch::parse(p759));
+    pc.matchOnCases();
+    patternMatrix pm = patternMatrix(pc);
+    patternMatrix expected = patternMatrix(759, p759);
+    EXPECT_EQ(pm.id, 759);
+    EXPECT_EQ(pm.caseMatch, pc.caseMatch);
+    EXPECT_EQ(pm.toString(), expected.toString());
+
+    // Printing uses the new encoding like patternMatrix does
+    std::ostringstream core;
+    std::ostringstream full;
+    core << pc;
+    full << expected;
+    EXPECT_EQ(core.str(), full.str());
+}
@@ -4,10 +4,11 @@
 #include <sstream>
 
 #include "case-matrix.hpp"
+#include "pattern-core.hpp"
 #include "pattern-matrix.hpp"
 #include "pattern-deduper.hpp"
 #include "zmatrix.hpp"
-#include "data/patterns928.hpp"
+#include "data/embedded-patterns.hpp"
 
 patternDeduper::patternDeduper() {
     loadPatterns();
@@ -15,12 +16,14 @@ patternDeduper::patternDeduper() {
 
 void patternDeduper::loadPatterns() {
     // TODO: Add additional buckets by taking row / column pair counts and using those as a key
-    for (auto const& [caseNumber, sumMap] : CASE_SUM_MAP_PATTERNS_928) {
-        for (auto const& [sum, idMap] : sumMap) {
-            for (auto const& [id, pattern] : idMap) {
-                caseSumPatternMap[caseNumber][sum][++nextID] = patternMatrix(id, pattern);
-            }
-        }
+    //  The 928 patterns go in already lined up with their case, in case / sum / id order
+    for (int id : EMBEDDED_928_BY_CASE_SUM) {
+        const embedded928Pattern &embedded = pattern928(id);
+        patternMatrix pm;
+        pm.id = id;
+        pm.loadFromPacked(embedded.aligned);
+        dedupKeyIDs.try_emplace(embedded.canonical, id);
+        caseSumPatternMap[embedded.caseMatch][embedded.sum][++nextID] = pm;
     }
 }
 
@@ -28,16 +31,16 @@ bool patternDeduper::isDuplicate(patternMatrix pattern, int &duplicateID, bool a
     duplicateID = 0;
     pattern.matchOnCases();
     //std::cout << "Pattern " << pattern.id << " matches case " << pattern.caseMatch << std::endl;
-    for (auto const& [id, pm] : caseSumPatternMap[pattern.caseMatch][pattern.p.zSum]) {
+    for (auto const& [id, pm] : caseSumPatternMap[pattern.caseMatch][pattern.p.getSum()]) {
         //std::cout << "Comparing to pattern " << id << std::endl;
         if (pattern.isDuplicate(pm)) {
                 duplicateID = pm.id;
                 return true;
         }
     }
-    // The swap23.zSum maybe be different, so we need to check that as well
-    if (pattern.swap23.zSum != pattern.p.zSum) {
-        for (auto const& [id, pm] : caseSumPatternMap[pattern.caseMatch][pattern.swap23.zSum]) {
+    // The swap23 sum maybe be different, so we need to check that as well
+    if (pattern.swap23().getSum() != pattern.p.getSum()) {
+        for (auto const& [id, pm] : caseSumPatternMap[pattern.caseMatch][pattern.swap23().getSum()]) {
             //std::cout << "Comparing to pattern " << id << std::endl;
             if (pattern.isDuplicate(pm)) {
                     duplicateID = pm.id;
@@ -46,11 +49,21 @@ bool patternDeduper::isDuplicate(patternMatrix pattern, int &duplicateID, bool a
         }
     }
     if (addUniquePatterns) {
-        caseSumPatternMap[pattern.caseMatch][pattern.p.zSum][++nextID] = pattern;
+        caseSumPatternMap[pattern.caseMatch][pattern.p.getSum()][++nextID] = pattern;
+        dedupKeyIDs.try_emplace(pattern.p.toPacked().orbitCanonical(), pattern.id);
     }
     return false;
 }
 
+bool patternDeduper::isDuplicate(const patternCore &pattern, int &duplicateID, bool addUniquePatterns) {
+    auto it = dedupKeyIDs.find(pattern.dedupKey());
+    if (it != dedupKeyIDs.end()) {
+        duplicateID = it->second;
+        return true;
+    }
+    return isDuplicate(patternMatrix(pattern), duplicateID, addUniquePatterns);
+}
+
 int patternDeduper::getUniqueCaseCount(int caseNumber) {
     int uniqueCount = 0;
     for (auto const& [sum, idMap] : caseSumPatternMap[caseNumber]) {
@@ -9,14 +9,18 @@
 #include <sstream>
 
 #include "case-matrix.hpp"
+#include "packed-matrix.hpp"
+#include "pattern-core.hpp"
 #include "pattern-matrix.hpp"
 #include "zmatrix.hpp"
-#include "data/patterns928.hpp"
 
 class patternDeduper {
     public:
         patternDeduper();
         bool isDuplicate(patternMatrix, int &, bool);
+        // A pattern that is an exact rearrangement / transpose / 2-3 swap of a known pattern is answered from its dedup key
+        //  Anything else falls back to the patternMatrix version so the results don't change
+        bool isDuplicate(const patternCore &, int &, bool);
         int getUniqueCaseCount(int);
 
     private:
@@ -26,6 +30,8 @@ class patternDeduper {
         //      this is because pattern IDs might not be unique across sets
         std::unordered_map <int, std::unordered_map <int, std::unordered_map <int, patternMatrix>>> caseSumPatternMap;
         int nextID = 0;
+        // patternCore::dedupKey -> pattern ID, for every pattern in caseSumPatternMap
+        std::unordered_map<packedMatrix, int> dedupKeyIDs;
 };
 
 #endif // PATTERN_DEDUPER_HPP
\ No newline at end of file
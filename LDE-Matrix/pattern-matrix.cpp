@@ -4,16 +4,24 @@
 #include <sstream>
 #include <map>
 #include <unordered_map>
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <utility>
 
 #include "case-matrix.hpp"
+#include "case-rearranger.hpp"
+#include "pattern-catalog.hpp"
 #include "pattern-matrix.hpp"
+#include "pattern-parser.hpp"
+#include "row-table.hpp"
+#include "work-pool.hpp"
+#include "subcase-rules.hpp"
 #include "zmatrix.hpp"
-#include "data/patterns928.hpp"
 
 
 patternMatrix::patternMatrix() {
     init();
-    updatePairCounts();
 }
 
 void patternMatrix::init() {
@@ -21,14 +29,10 @@ void patternMatrix::init() {
     id = 0;
     caseMatch = -1;
     subCaseMatch = '-';
-    pNewEncoding = zmatrix(rows, cols, maxValue);
     p = zmatrix(rows, cols, maxValue);
-    pT = zmatrix(cols, rows, maxValue);
-    swap23 = zmatrix(rows, cols, maxValue);
-    swap23T = zmatrix(cols, rows, maxValue);
-    cV = zmatrix(rows, cols, 1);
-    cVT = zmatrix(cols, rows, 1);
-    pGroupings = zmatrix(rows, cols, 36);
+    invalidateViews();
+    groupingsBuilt = false;
+    groupingsNumbered = false;
     entryLDEs.resize(rows);
     for (int i = 0; i < rows; i++) {
         entryLDEs[i].resize(cols);
@@ -39,21 +43,22 @@ void patternMatrix::init() {
         possibleValues[i].resize(cols);
     }
     rowToRowSet.resize(rows);
-    loadCases();
 }
 
-// TODO - Refactor so a rearrangement is not needed which means updating the 928 data
+// The rearrangement and subcase are worked out once for each pattern in the patternCatalog
 patternMatrix::patternMatrix(int pattern928Number) {
     init();
+    const catalogPattern &entry = patternCatalog::instance()[pattern928Number];
     id = pattern928Number;
     id928 = pattern928Number;
     singleCaseRearrangement = true;
-    loadFromString(PATTERNS_928[pattern928Number]);
-    rearrangeMatrix();
-    loadFromString(getFirstCaseRearrangement());
+    loadFromPacked(entry.pattern);
+    caseMatch = entry.caseMatch;
+    subCaseMatch = entry.subCaseMatch;
+    caseAlign = entry.caseAlign;
+    // rearrangeMatrix used to leave the one rearrangement it found here
+    if (caseMatch > 0) caseRearrangements.push_back(entry.pattern);
     rearrangedToMatchCase = true;
-    // This could be removed if the p928 patters are updated to match the case style and labelled by case / subcase
-    determineSubCase();
 }
 
 
@@ -68,383 +73,152 @@ patternMatrix::patternMatrix(int pNum, std::string matrix) {
 patternMatrix::patternMatrix(int pNum, std::string matrix, bool newEncoding) {
     init();
     id = pNum;
-    if (newEncoding) {
-        for(int i = 0; i < matrix.size(); i++) {
-            if (matrix[i] == '0') matrix[i] = '0';
-            else if (matrix[i] == '1') matrix[i] = '2';
-            else if (matrix[i] == '2') matrix[i] = '1';
-            else if (matrix[i] == '3') matrix[i] = '3';
-        }
-    }
-    loadFromString(matrix);
+    loadFromPacked(patternParser::parse(matrix, newEncoding));
 }
 
-void patternMatrix::loadFromString(std::string m) {
-    if (m.size() == 0) throw std::runtime_error("Empty pattern string");
-    std::stringstream ms(m);
-    std::string r;
-    int group = 1;  // Used to track groupings; initially, all entries are in their own group
-    int row = 0;
-    while(std::getline(ms, r, ']')) {
-        if(row == rows) throw std::runtime_error("Too many rows in pattern string");
-        std::stringstream rs(r);
-        std::string v;
-        int mv;
-        int col = 0;
-        while(std::getline(rs, v, ',')) {
-            if(col == cols) throw std::runtime_error("Too many columns in pattern string");
-            if(v[0] == '[') v.erase(0,1);
-            
-            // This set represents the original patterns we got from the creators
-            if(v == "0 0") mv = 0;
-            else if (v == "0 1") mv = 1;
-            else if (v == "1 0") mv = 2;
-            else if (v == "1 1") mv = 3;
-            // This set represents our representation of the patterns
-            else if(v == "0") mv = 0;
-            else if (v == "1") mv = 1;
-            else if (v == "2") mv = 2;
-            else if (v == "3") mv = 3;
-            else {
-                std::ostringstream vErr;
-                vErr << "Invalid value in pattern string: " << v ;
-                throw std::runtime_error(vErr.str());
-            }
-            pNewEncoding.z[row][col] = (mv == 1) ? 2 : (mv == 2) ? 1 : mv;
+// Only the patterns that survive the patternCore checks pay for a full patternMatrix
+patternMatrix::patternMatrix(const patternCore &core) {
+    init();
+    id = core.id;
+    loadFromPacked(core.pattern());
+    caseMatch = core.caseMatch;
+    if (caseMatch != -1) caseAlign = core.caseAlign;
+}
+
+void patternMatrix::loadFromString(std::string_view m) {
+    loadFromPacked(patternParser::parse(m));
+}
+
+void patternMatrix::loadFromPacked(const packedMatrix &pattern) {
+    for (int row = 0; row < rows; row++) {
+        for (int col = 0; col < cols; col++) {
+            int mv = pattern.get(row, col);
             p.z[row][col] = mv;
-            pT.z[col][row] = mv;
             // Since we know the pattern, the possible values are just the pattern values
             //  This will change after LDE reduction
             possibleValues[row][col].clear();
             possibleValues[row][col].push_back(mv);
-            swap23.z[row][col] = (mv == 2) ? 3 : (mv == 3) ? 2 : mv;
-            swap23T.z[col][row] = (mv == 2) ? 3 : (mv == 3) ? 2 : mv;
-            cV.z[row][col] = mv / 2;
-            cVT.z[col][row] = mv / 2;
-            pGroupings.z[row][col] = group;
-            group++;
-            col++;
-        }
-        if(col != cols) {
-            std::ostringstream colErr;
-            colErr << "Too few columns in pattern string: " << col << " instead of " << cols;
-            throw std::runtime_error(colErr.str());
         }
-        row++;
-    }
-    if(row != rows) {
-        std::ostringstream rowErr;
-        rowErr << "Too few rows in pattern string: " << row << " instead of " << rows;
-        throw std::runtime_error(rowErr.str());
-    } 
-    p.updateMetadata();
-    pT.updateMetadata();
-    cV.updateMetadata();
-    cVT.updateMetadata();
-    swap23.updateMetadata();
-    swap23T.updateMetadata();
-    pGroupings.updateMetadata();  // This probably isn't necessary but it's good to be consistent
+    }
+    // The metadata and the other views are only worked out when something asks for them
+    p.invalidateMetadata();
+    invalidateViews();
+    // Initially, all entries are in their own group
+    groupingsBuilt = false;
+    groupingsNumbered = true;
     // Now we know we have a valid matrix string so let's save it
     originalMatrix = toString();
-    updatePairCounts();
-}
-
-// I need to refactor this to, instead, use the zmatrix pair values
-void patternMatrix::updatePairCounts(){
-    rowPairCountsTotals.clear();
-    rowPairCountsTotals.resize(rows+1);
-    colPairCountsTotals.clear();
-    colPairCountsTotals.resize(cols+1);
-    // Reset the pair counts
-    rowPairCounts.clear();
-    rowPairCounts.resize(rows);
-    for (int i = 0; i < rows; i++) {
-        rowPairCounts[i].resize(rows);
-    }
-    colPairCounts.clear();
-    colPairCounts.resize(cols);
-    for (int i = 0; i < cols; i++) {
-        colPairCounts[i].resize(cols);
-    }
-    // Now to update the pair counts
+}
+
+void patternMatrix::invalidateViews() {
+    viewsValid = 0;
+}
+
+const zmatrix& patternMatrix::pNewEncoding() const { return view(NEW_ENCODING_VIEW, pNewEncodingView); }
+const zmatrix& patternMatrix::pT() const { return view(TRANSPOSE_VIEW, pTView); }
+const zmatrix& patternMatrix::swap23() const { return view(SWAP23_VIEW, swap23View); }
+const zmatrix& patternMatrix::swap23T() const { return view(SWAP23T_VIEW, swap23TView); }
+const zmatrix& patternMatrix::cV() const { return view(CASE_VIEW, cVView); }
+const zmatrix& patternMatrix::cVT() const { return view(CASE_T_VIEW, cVTView); }
+
+// Every view is one pass over p with the values mapped and / or transposed
+//  Bulk loads that only look at p never pay for any of them
+const zmatrix& patternMatrix::view(viewBit bit, zmatrix &cached) const {
+    if (viewsValid & bit) return cached;
+    bool transpose = (bit == TRANSPOSE_VIEW || bit == SWAP23T_VIEW || bit == CASE_T_VIEW);
+    bool caseStyle = (bit == CASE_VIEW || bit == CASE_T_VIEW);
+    int viewMax = caseStyle ? 1 : maxValue;
+    cached = transpose ? zmatrix(cols, rows, viewMax) : zmatrix(rows, cols, viewMax);
     for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < rows; j++) {
-            rowPairCounts[i][j] = 0;
-            colPairCounts[i][j] = 0;
-            if (i == j) {
-                rowPairCounts[i][j] = 6;
-                colPairCounts[i][j] = 6;
-                continue;
-            }
-            for (int k = 0; k < cols; k++) {
-                if (p.z[i][k] == p.z[j][k]) rowPairCounts[i][j]++;
-                if (p.z[k][i] == p.z[k][j]) colPairCounts[i][j]++;
-            }
+        for (int j = 0; j < cols; j++) {
+            int v = p.z[i][j];
+            if (bit == NEW_ENCODING_VIEW) v = (v == 1) ? 2 : (v == 2) ? 1 : v;
+            else if (bit == SWAP23_VIEW || bit == SWAP23T_VIEW) v = (v == 2) ? 3 : (v == 3) ? 2 : v;
+            else if (caseStyle) v = v / 2;
+            if (transpose) cached.z[j][i] = v;
+            else cached.z[i][j] = v;
         }
     }
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < rows; j++) {
-            rowPairCountsTotals[rowPairCounts[i][j]]++;
-            colPairCountsTotals[colPairCounts[i][j]]++;
+    cached.invalidateMetadata();
+    viewsValid |= bit;
+    return cached;
+}
+
+zmatrix& patternMatrix::pGroupings() {
+    if (!groupingsBuilt) {
+        groupings = zmatrix(rows, cols, 36);
+        if (groupingsNumbered) {
+            int group = 1;
+            for (int i = 0; i < rows; i++) {
+                for (int j = 0; j < cols; j++) groupings.z[i][j] = group++;
+            }
         }
+        groupings.invalidateMetadata();
+        groupingsBuilt = true;
     }
+    return groupings;
 }
 
+// The case view is looked up in the registry's table of case rearrangements instead of being compared with every case
+//  The rearrangements of different cases never overlap so a pattern can't match more than 1 case
 void patternMatrix::matchOnCases() {
     caseMatch = -1;
-    for (int i = 0; i < cases.size(); i++) {
-        //std::cout << "Matching on case " << cases[i].id << std::endl;
-        if (matchesCase(i)) {
-            if (caseMatch != -1) {
-                std::ostringstream caseErr;
-                caseErr << "Pattern " << id << " matches more than 1 case: " << caseMatch << " and " << cases[i].id << std::endl;
-                throw std::runtime_error(caseErr.str());
+    const caseOrbitEntry *entry = cases.all().lookup(p.toPacked().caseView().mBits);
+    if (entry == nullptr) return;
+    switch (cases[entry->caseIndex].id)
+    {
+        case 2: {
+            // Case 2 requires that the rows / columns with the 4 case entries are fully paired
+            int rc1 = -1;
+            int rc2 = -1;
+            const auto &rowCounts = p.getRowCounts();
+            const auto &colCounts = p.getColCounts();
+            for (int j = 0; j < rows; j++) {
+                if (rowCounts[j][2] + rowCounts[j][3] == 4) {
+                    if (rc1 == -1) rc1 = j;
+                    else rc2 = j;
+                }
             }
-            switch (cases[i].id)
-            {
-                case 2: {
-                    // Case 2 requires that the rows / columns with the 4 case entries are fully paired
-                    int rc1 = -1;
-                    int rc2 = -1;
-                    for (int j = 0; j < rows; j++) {
-                        if (p.zRowCounts[j][2] + p.zRowCounts[j][3] == 4) {
-                            if (rc1 == -1) rc1 = j;
-                            else rc2 = j;
-                        }
-                    }
-                    for (int j = 0; j < cols; j++) {
-                        if (p.zColCounts[j][2] + p.zColCounts[j][3] == 4) {
-                            if (rc1 == -1) rc1 = j;
-                            else rc2 = j;
-                        }
-                    }
-                    // make sure rc1 and rc2 are set
-                    if (rowPairCounts[rc1][rc2] == 6) {
-                        //std::cout << "RowPairCounts: " << rc1 << " " << rc2 << " " << rowPairCounts[rc1][rc2] << std::endl;
-                        caseMatch = cases[i].id;
-                    } else if (colPairCounts[rc1][rc2] == 6) {
-                        //std::cout << "ColPairCounts: " << rc1 << " " << rc2 << " " << colPairCounts[rc1][rc2] << std::endl;
-                        caseMatch = cases[i].id;
-                    }
-                    break;
+            for (int j = 0; j < cols; j++) {
+                if (colCounts[j][2] + colCounts[j][3] == 4) {
+                    if (rc1 == -1) rc1 = j;
+                    else rc2 = j;
                 }
-                default:
-                    caseMatch = cases[i].id;
-                    break;
             }
+            // make sure rc1 and rc2 are set
+            if (p.getRowPairCounts()[rc1][rc2] == 6) {
+                //std::cout << "RowPairCounts: " << rc1 << " " << rc2 << " " << p.getRowPairCounts()[rc1][rc2] << std::endl;
+                caseMatch = cases[entry->caseIndex].id;
+            } else if (p.getColPairCounts()[rc1][rc2] == 6) {
+                //std::cout << "ColPairCounts: " << rc1 << " " << rc2 << " " << p.getColPairCounts()[rc1][rc2] << std::endl;
+                caseMatch = cases[entry->caseIndex].id;
+            }
+            break;
         }
+        default:
+            caseMatch = cases[entry->caseIndex].id;
+            break;
     }
+    if (caseMatch != -1) caseAlign = entry->alignment;
 }
 
+// Either the case view or its transpose is a rearrangement of the case matrix
 bool patternMatrix::matchesCase(int caseIndex) {
-    if (cV == cases[caseIndex].c) return true; // pattern matrix case style matches the case matrix
-    if (cVT == cases[caseIndex].c) return true; // transposed pattern matrix case style matches the case matrix
-    return false;
+    const caseOrbitEntry *entry = cases.all().lookup(p.toPacked().caseView().mBits);
+    return entry != nullptr && entry->caseIndex == caseIndex;
 }
 
 // This might need a refactor into the normal matchOnCases 
 //  however it does require the pattern to be rearranged to match the case (I think)
+//  The rules themselves live in SUBCASE_RULES
 bool patternMatrix::determineSubCase(){
     subCaseMatch = '-';
-    updatePairCounts();
-    switch (caseMatch)
-    {
-    case 1:
-        return case1SubCaseMatch();
-    case 2:
-        return case2SubCaseMatch();
-    case 3:
-        return case3SubCaseMatch();
-    case 4:
-        return case4SubCaseMatch();
-    case 5:
-        return case5SubCaseMatch();
-    case 6:
-        return case6SubCaseMatch();
-    case 7:
-        return case7SubCaseMatch();
-    case 8:
-        return case8SubCaseMatch();
-    default:
-        break;
-    }
-    return false;
-}
-
-bool patternMatrix::case1SubCaseMatch() {
-    // Case 1 doesn't have any subcases
-    return true;
-}
-
-bool patternMatrix::case2SubCaseMatch() {
-    // Case 2 doesn't have any subcases
-    return true;
-}
-
-bool patternMatrix::case3SubCaseMatch() {
-    return case3aSubCaseCheck() || case3bSubCaseCheck() || case3cSubCaseCheck();
-    /*
-    TODO - Either add this back or remove the the comment block
-    Keeping this, for now, as the case 3b check might be useful in the future but, for now, it's not.  
-    if (case3aSubCaseCheck()) {
-        return true;
-    }
-    if (case3bSubCaseCheck()) {
-        
-        std::cout << "Pattern " << id << " - Case 3b" << std::endl;
-        // Do additional check to make sure that the upper right [4x2] and lower left [2x4] are the same value
-        int col42sum = p.z[0][4] + p.z[0][5] + p.z[1][4] + p.z[1][5] + p.z[2][4] + p.z[2][5] + p.z[3][4] + p.z[3][5];
-        int row24sum = p.z[4][0] + p.z[5][0] + p.z[4][1] + p.z[5][1] + p.z[4][2] + p.z[5][2] + p.z[4][3] + p.z[5][3];
-        if (col42sum == 0 || col42sum == 8 || row24sum == 0 || row24sum == 8) {
-            return true;
-        }
-        std::cout << "Pattern " << id << " - Case 3b isn't paired correctly on the right 2 columns and bottom 2 rows" << std::endl;
-        // Reset the case match as this is an invalid state
-        caseMatch = -1;
-        subCaseMatch = '-';
-        return false;
-        
-    }
-    if (case3cSubCaseCheck()) {
-        return true;
-    }
-    // If we don't match a subcase, then we have an invalid case 3 pattern
-    caseMatch = -1;
-    return false;
-    */
-}
-
-bool patternMatrix::case3aSubCaseCheck() {
-    bool isCase3a = false;
-    // 3a: The four columns/rows with odd entries are fully paired
-    if ((rowPairCounts[0][1] == 6 && rowPairCounts[2][3] == 6) || 
-        (rowPairCounts[0][2] == 6 && rowPairCounts[1][3] == 6) ||
-        (rowPairCounts[0][3] == 6 && rowPairCounts[1][2] == 6)) {
-        subCaseMatch = 'a';
-        isCase3a = true;
-    }
-    if ((colPairCounts[0][1] == 6 && colPairCounts[2][3] == 6) || 
-        (colPairCounts[0][2] == 6 && colPairCounts[1][3] == 6) ||
-        (colPairCounts[0][3] == 6 && colPairCounts[1][2] == 6)
-        ) {
-        subCaseMatch = 'a';
-        isCase3a = true;
-    }
-    return isCase3a;
-}
-
-bool patternMatrix::case3bSubCaseCheck() {
-    bool isCase3b = false;
-    // 3b: In the first four rows/columns, four entries of every row/column are paired.
-    if ((rowPairCounts[0][1] == 4 && rowPairCounts[2][3] == 4) ||
-        (rowPairCounts[0][2] == 4 && rowPairCounts[1][3] == 4) ||
-        (rowPairCounts[0][3] == 4 && rowPairCounts[1][2] == 4)) {
-        subCaseMatch = 'b';
-        isCase3b = true;
-    }
-    if ((colPairCounts[0][1] == 4 && colPairCounts[2][3] == 4) || 
-        (colPairCounts[0][2] == 4 && colPairCounts[1][3] == 4) ||
-        (colPairCounts[0][3] == 4 && colPairCounts[1][2] == 4)) {
-        subCaseMatch = 'b';
-        isCase3b = true;
-    }
-    return isCase3b;
-}
-
-bool patternMatrix::case3cSubCaseCheck() {
-    bool isCase3c = false;
-    // 3c: there are only two paired numbers per row/column.
-    // 3c: there are only two paired numbers per row/column.
-    if ((rowPairCounts[0][1] == 2 && rowPairCounts[2][3] == 2) ||
-        (rowPairCounts[0][2] == 2 && rowPairCounts[1][3] == 2) ||
-        (rowPairCounts[0][3] == 2 && rowPairCounts[1][2] == 2)) {
-        subCaseMatch = 'c';
-        isCase3c = true;
-    }
-    if ((colPairCounts[0][1] == 2 && colPairCounts[2][3] == 2) ||
-        (colPairCounts[0][2] == 2 && colPairCounts[1][3] == 2) ||
-        (colPairCounts[0][3] == 2 && colPairCounts[1][2] == 2)) {
-        subCaseMatch = 'c';
-        isCase3c = true;
-    }
-    return isCase3c;
-}
-
-bool patternMatrix::case4SubCaseMatch() {
-    // 4a: has two fully paired columns if m11 = m12.
-    if ((colPairCounts[0][1] == 6 && colPairCounts[2][3] == 6) || (colPairCounts[0][2] == 6 && colPairCounts[1][3] == 6)) {
-        subCaseMatch = 'a';
-        return true;
-    }
-    // 4b: where m11 ̸ = m12
-    subCaseMatch = 'b';
-    return true;
-}
-
-bool patternMatrix::case5SubCaseMatch() {
-    // 5a: Either columns (1,2) and (3,4) are fully paired if m11 = m12 and 
-    //     m13 = m14, where xT12xT34 is correct T sequence, or rows (1,2) and (3,4) are
-    //     fully paired if m11 = m21 and m31 = m41, where T12xT34x reduce k to k-1.
-    if ((rowPairCounts[0][1] == 6 && rowPairCounts[2][3] == 6) || (rowPairCounts[0][2] == 6 && rowPairCounts[1][3] == 6)) {
-        subCaseMatch = 'a';
-        return true;
-    }
-    if ((colPairCounts[0][1] == 6 && colPairCounts[2][3] == 6) || (colPairCounts[0][2] == 6 && colPairCounts[1][3] == 6)) {
-        subCaseMatch = 'a';
-        return true;
-    }
-    // 5b: m11 = m12 and m13 ̸ = m14
-    //     I'm adding the case where m33 = m34 and m31 != m32 as this block can be moved into place
-    //       This addition might not be necessary
-    if((p.z[0][0] == p.z[0][1] && p.z[0][2] != p.z[0][3]) || (p.z[2][2] == p.z[2][3] && p.z[2][0] != p.z[2][1])) {
-        subCaseMatch = 'b';
-        return true;
-    }
-    // I don't think this should happen
-    return false;
-}
-
-bool patternMatrix::case6SubCaseMatch() {
-    // 6a: Rows (1,2) and (3,4) are paired
-    if (rowPairCounts[0][1] == 6 && rowPairCounts[2][3] == 6) {
-        subCaseMatch = 'a';
-        return true;
-    }
-    // 6b: columns (1,2), (3,4), and (5,6) are fully paired
-    if (colPairCounts[0][1] == 6 && colPairCounts[2][3] == 6 && colPairCounts[4][5] == 6) {
-        subCaseMatch = 'b';
-        return true;
-    }
-    // 6c: In the first four rows, only two paired entries between sets of 2 rows ([1,2 and 3,4] or [1,3 and 2,4] or [1,4 and 2,3])
-    if ((rowPairCounts[0][1] == 2 && rowPairCounts[2][3] == 2) || 
-        (rowPairCounts[0][2] == 2 && rowPairCounts[1][3] == 2) ||
-        (rowPairCounts[0][3] == 2 && rowPairCounts[1][2] == 2)) {
-        subCaseMatch = 'c';
-        return true;
-    }
-    // I don't think this should happen
-    return false;
-}
-
-bool patternMatrix::case7SubCaseMatch() {
-    // Maybe N/A??  The single pattern corresponds to I ⊗ H?
-    return true;
-}
-
-bool patternMatrix::case8SubCaseMatch() {
-    // 8a: V11, V12 have the same parity or V11, V21 have the same parity
-    // 8b: V11, V12 have different parity and V11, V21 have different parity
-    // Assume subcase 'a' and change to 'b' if the parity is different
-    subCaseMatch = 'a';
-    if (p.z[0][0] % 2 != p.z[0][1] % 2 && p.z[0][0] % 2 != p.z[1][0] % 2) {
-        subCaseMatch = 'b';
-    }
-    return true;
+    return subCaseTable::instance().match(caseMatch, p.toPacked(), subCaseMatch);
 }
 
 std::string patternMatrix::getFirstCaseRearrangement() {
     if (caseRearrangements.size() == 0) return toString();
-    return caseRearrangements.begin()->first;
+    return caseRearrangements.front().toString();
 }
 
 bool patternMatrix::isDuplicate(patternMatrix other) {
@@ -469,15 +243,15 @@ bool patternMatrix::isDuplicate(patternMatrix other) {
 }
 
 bool patternMatrix::isTranspose(patternMatrix other) {
-    return pT == other.p;
+    return pT() == other.p;
 }
 
 bool patternMatrix::is23Swap(patternMatrix other) {
-    return swap23 == other.p;
+    return swap23() == other.p;
 }
 
 bool patternMatrix::is23SwapT(patternMatrix other) {
-    return swap23T == other.p;
+    return swap23T() == other.p;
 }
 
 void patternMatrix::printDebug(std::ostream& os) {
@@ -486,13 +260,13 @@ void patternMatrix::printDebug(std::ostream& os) {
     std::cout << "Pattern Matrix Debug:" << std::endl;
     p.printDebug(os);
     std::cout << "Transposed Pattern Matrix Debug:" << std::endl;
-    pT.printDebug(os);
+    pT().printDebug(os);
     std::cout << "Swapped 2s and 3s Pattern Matrix Debug:" << std::endl;
-    swap23.printDebug(os);
+    swap23().printDebug(os);
     std::cout << "Case Style Pattern Matrix Debug:" << std::endl;
-    cV.printDebug(os);
+    cV().printDebug(os);
     std::cout << "Transposed Case Style Pattern Matrix Debug:" << std::endl;
-    cVT.printDebug(os);
+    cVT().printDebug(os);
 }
 
 void patternMatrix::printLDEs(std::ostream& os){
@@ -550,38 +324,42 @@ void patternMatrix::printPairCounts(std::ostream& os) {
 }
 
 void patternMatrix::printRowPairCounts(std::ostream& os) {
+    const auto &rowPairs = p.getRowPairCounts();
+    const auto &totals = p.getRowPairCountsTotals();
     os << "Row Pair Counts:" << std::endl;
     for (int i = 0; i < rows; i++) {
         os << "[";
         for (int j = 0; j < rows; j++) {
-            os << p.rowPairCounts[i][j];
+            os << rowPairs[i][j];
             if (j != rows-1) os << ","; // Don't print a comma after the last element
         }
         os << "]";
         if (multilineOutput) os << std::endl;
     }
     os << "Row Pair Counts Totals:" << std::endl;
-    for (int i = 0; i < p.rowPairCountsTotals.size(); i++) {
-        os << p.rowPairCountsTotals[i];
+    for (int i = 0; i < totals.size(); i++) {
+        os << totals[i];
         if (i != rows) os << ","; // Don't print a comma after the last element
     }
     if (multilineOutput) os << std::endl;
 }
 
 void patternMatrix::printColPairCounts(std::ostream& os) {
+    const auto &colPairs = p.getColPairCounts();
+    const auto &totals = p.getColPairCountsTotals();
     os << "Column Pair Counts:" << std::endl;
     for (int i = 0; i < cols; i++) {
         os << "[";
         for (int j = 0; j < cols; j++) {
-            os << p.colPairCounts[i][j];
+            os << colPairs[i][j];
             if (j != cols-1) os << ","; // Don't print a comma after the last element
         }
         os << "]";
         if (multilineOutput) os << std::endl;
     }
     os << "Column Pair Counts Totals:" << std::endl;
-    for (int i = 0; i < p.colPairCountsTotals.size(); i++) {
-        os << p.colPairCountsTotals[i];
+    for (int i = 0; i < totals.size(); i++) {
+        os << totals[i];
         if (i != cols) os << ","; // Don't print a comma after the last element
     }
     if (multilineOutput) os << std::endl;
@@ -648,61 +426,98 @@ bool patternMatrix::possibleValuesLeadToAllPatterns(){
     return true;
 }
 
+void patternMatrix::allPatternsToSink(patternSink &sink, bool leaders) {
+    *debugOutput << "All possible values lead to all patterns" << std::endl;
+    patternSymmetry everything = leaders ? patternSymmetry(possibleValues) : patternSymmetry();
+    // Each 928 pattern counts as a node and a leaf of a flat tree
+    startBudget(1);
+    for (const catalogPattern &entry : patternCatalog::instance()) {
+        if (outOfBudget(generationStats)) break;
+        generationStats.nodes++;
+        generationStats.leaves++;
+        generationStats.covered += 1.0 / patternCatalog::PATTERNS;
+        const packedMatrix &pattern = entry.pattern;
+        generationStats.patterns++;
+        // Every 928 pattern is its own orbit of the full group, its leader stands in for it
+        if (leaders) sink.add(everything.leader(pattern), everything.orbitSize(pattern));
+        else sink.add(pattern, 1);
+    }
+    finishBudget();
+}
+
+void patternMatrix::startBudget(int workers) {
+    budget = generatorBudget.unlimited() ? nullptr : std::make_shared<budgetTracker>(generatorBudget, workers);
+}
+
+void patternMatrix::finishBudget() {
+    generationStats.stop = budget ? budget->stopReason() : searchStop::NONE;
+    budget = nullptr;
+}
+
 void patternMatrix::generateAllPossibleValuePatterns() {
+    allPossibleValuePatterns.clear();
+    possibleValueOrbitSizes.clear();
+    patternMapSink sink(allPossibleValuePatterns, symmetryBreaking ? &possibleValueOrbitSizes : nullptr);
+    generateAllPossibleValuePatterns(sink);
+}
+
+void patternMatrix::generateAllPossibleValuePatterns(patternSink &sink) {
+    generationStats = generatorStats();
     if (possibleValuesLeadToAllPatterns()) {
-        *debugOutput << "All possible values lead to all patterns" << std::endl;
-        for (int i = 1; i <= 928; i++) {
-            // Load all of the patterns into the allPossibleValuePatterns map
-            allPossibleValuePatterns[patternMatrix(i).toString()] = true;
-        }
+        allPatternsToSink(sink, symmetryBreaking);
         return;
     }
     // Need to iterate through all possible values and generate a unique pattern for each combination
-    //  This pattern will be stored in allPossibleValuePatterns
+    //  Each pattern is sent to the sink as soon as it's found
     // This will be very similar to generating all possible patterns, so we can use that as a base
-    allPossibleValuePatterns.clear();
-    zmatrix z = zmatrix(rows, cols, maxValue);
-    recursiveAllPossibleValueSet(0, z);
+    parallelPossibleValueSearch(false, sink);
 }
 
-void patternMatrix::recursiveAllPossibleValueSet(int position, zmatrix z) {
+void patternMatrix::recursiveAllPossibleValueSet(int position, zmatrix z, double share, patternSink &sink, generatorStats &stats) {
     if (position == rows*cols) return;
+    double childShare = share / possibleValues[position / cols][position % cols].size();
     for (int i = 0; i < possibleValues[position / cols][position % cols].size(); i++) {
+        if (outOfBudget(stats)) return;
+        stats.nodes++;
         z.z[position / cols][position % cols] = possibleValues[position / cols][position % cols][i];
         if (position == (rows * cols) - 1) {
-            std::ostringstream os;
-            os << z;
-            patternMatrix pm = patternMatrix(1, os.str());
-            pm.matchOnCases();
-            if (pm.caseMatch > 0 && pm.isOrthogonal() && pm.isNormalized()) {
+            stats.leaves++;
+            stats.covered += childShare;
+            packedMatrix packed = z.toPacked();
+            patternCore pc(1, packed);
+            uint64_t orbitSize = 1;
+            if (pc.isOrthonormal() && pc.matchOnCases() > 0 && (!symmetryBreaking || symmetryRules.isLeader(packed, orbitSize))) {
+                stats.patterns++;
                 if (printDebugInfo) {
-                    *debugOutput << "Standard Version - Case: " << pm.caseMatch << " Valid Pattern:" << pm << " Count: " << allPossibleValuePatterns.size()+1 << std::endl;
+                    *debugOutput << "Standard Version - Case: " << pc.caseMatch << " Valid Pattern:" << pc << " Count: " << stats.patterns << std::endl;
                 }
-                allPossibleValuePatterns[pm.toString()] = true;
+                sink.add(packed, orbitSize);
             }
         }
-        recursiveAllPossibleValueSet(position + 1, z);
+        recursiveAllPossibleValueSet(position + 1, z, childShare, sink, stats);
     }
 }
 
 void patternMatrix::optimizedGenerateAllPossibleValuePatterns() {
+    allPossibleValuePatterns.clear();
+    possibleValueOrbitSizes.clear();
+    patternMapSink sink(allPossibleValuePatterns, symmetryBreaking ? &possibleValueOrbitSizes : nullptr);
+    optimizedGenerateAllPossibleValuePatterns(sink);
+}
+
+void patternMatrix::optimizedGenerateAllPossibleValuePatterns(patternSink &sink) {
+    generationStats = generatorStats();
     if (possibleValuesLeadToAllPatterns()) {
-        *debugOutput << "All possible values lead to all patterns" << std::endl;
-        for (int i = 1; i <= 928; i++) {
-            // Load all of the patterns into the allPossibleValuePatterns map
-            allPossibleValuePatterns[patternMatrix(i).toString()] = true;
-        }
+        allPatternsToSink(sink, symmetryBreaking);
         return;
     }
     // Need to iterate through all possible values and generate a unique pattern for each combination
-    //  This pattern will be stored in allPossibleValuePatterns
+    //  Each pattern is sent to the sink as soon as it's found
     // This will be very similar to generating all possible patterns, so we can use that as a base
-    allPossibleValuePatterns.clear();
-    zmatrix z = zmatrix(rows, cols, maxValue);
-    optimizedAllPossibleValuePatterns(0, z);
+    parallelPossibleValueSearch(true, sink);
 }
 
-void patternMatrix::optimizedAllPossibleValuePatterns(int position, zmatrix z) {
+void patternMatrix::optimizedAllPossibleValuePatterns(int position, zmatrix z, searchState state, double share, patternSink &sink, generatorStats &stats) {
     // pick rows / columns with fewest possible values (2 preferred)
     // check normality on a per row / row or column / column
     //check if row is normalized, if not, it's not a valid set
@@ -710,13 +525,21 @@ void patternMatrix::optimizedAllPossibleValuePatterns(int position, zmatrix z) {
     if (position == rows*cols) return;
     int curRow = position / cols;
     int curColumn = position % cols;
-    for (int i = 0; i < possibleValues[curRow][curColumn].size(); i++) {    
+    int choices = possibleValues[curRow][curColumn].size();
+    double childShare = share / choices;
+    for (int i = 0; i < choices; i++) {
+        if (outOfBudget(stats)) return;
+        stats.nodes++;
         z.z[curRow][curColumn] = possibleValues[curRow][curColumn][i];
         if (position != 0 && curColumn == 0) {
             // here, we are at position 6,12,18,24,30,36 which means that we are at the start of a row
             //  we need to check the normality of the prior row
             //  if the prior row is not normalized, then we can skip this set
-            if(!isRowNormalized(curRow - 1, z)) return;
+            // Skipping the set also covers the rest of this node's children
+            if(!isRowNormalized(curRow - 1, z)) {
+                stats.covered += childShare * (choices - i);
+                return;
+            }
             // if we have enough rows, we can check for orthogonality between rows
             if (curRow >= 2) {
                 // If curRow == 2, then rows 0, 1 have been set and we can check the orthogonality of them
@@ -724,35 +547,182 @@ void patternMatrix::optimizedAllPossibleValuePatterns(int position, zmatrix z) {
                 //  r1 orthogonal to r2 and r3 orthogonal to r2 => r1 orthogonal to r3
                 //  I don't think it is and will check later
                 for (int j = 0; j < curRow - 1; j++) {
-                    if(!areRowsOrthogonal(curRow - 1, j, z)) return;
+                    if(!areRowsOrthogonal(curRow - 1, j, z)) {
+                        stats.covered += childShare * (choices - i);
+                        return;
+                    }
                 }
             }
         }
+        // The columns are checked after every entry, a column or column pair that the rows below can't fix cuts the branch right away
+        //  With symmetryBreaking so is the order of rows / columns that have the same possible values
+        searchState next = state;
+        if (!keepEntry(curRow, curColumn, z, next, stats)) {
+            stats.covered += childShare;
+            continue;
+        }
         if (position == (rows * cols) - 1) {
-            std::ostringstream os;
-            os << z;
-            patternMatrix pm = patternMatrix(1, os.str());
-            pm.matchOnCases();
-            if (pm.caseMatch > 0 && pm.isOrthogonal() && pm.isNormalized()) {
+            stats.leaves++;
+            stats.covered += childShare;
+            packedMatrix packed = z.toPacked();
+            patternCore pc(1, packed);
+            if (pc.matchOnCases() > 0 && pc.isOrthonormal()) {
+                // Every pattern in the orbit is just as valid so only the leader is kept
+                uint64_t orbitSize = 1;
+                if (symmetryBreaking && !symmetryRules.isLeader(packed, orbitSize)) continue;
+                stats.patterns++;
                 if (printDebugInfo) {
-                    *debugOutput << "Optimized Version - Case: " << pm.caseMatch << " Valid Pattern: " << pm << " Count: " << allPossibleValuePatterns.size()+1 << std::endl;
+                    *debugOutput << "Optimized Version - Case: " << pc.caseMatch << " Valid Pattern: " << pc << " Count: " << stats.patterns << std::endl;
                 }
-                allPossibleValuePatterns[pm.toString()] = true;
+                sink.add(packed, orbitSize);
             } else {
                 if (printDebugInfo) {
-                    *debugOutput << "Optimized Version - Case: " << pm.caseMatch << " Invalid Pattern: " << pm << std::endl;
+                    *debugOutput << "Optimized Version - Case: " << pc.caseMatch << " Invalid Pattern: " << pc << std::endl;
                 }
             }
         }
-        optimizedAllPossibleValuePatterns(position + 1, z);
+        optimizedAllPossibleValuePatterns(position + 1, z, next, childShare, sink, stats);
     }
 }
 
+bool patternMatrix::keepEntry(int row, int col, const zmatrix &z, searchState &state, generatorStats &stats) {
+    columnConstraints::add(state.columns, col, z.z[row][col], z.z[row]);
+    if (!columnRules.canFinish(state.columns, row, col)) {
+        stats.columnPrunedBranches++;
+        stats.columnPrunedLeaves = generatorStats::saturatingAdd(stats.columnPrunedLeaves, columnRules.leavesAfter(row, col));
+        return false;
+    }
+    if (symmetryBreaking && !symmetryRules.add(state.symmetry, row, col, z.z)) {
+        stats.symmetryPrunedBranches++;
+        stats.symmetryPrunedLeaves = generatorStats::saturatingAdd(stats.symmetryPrunedLeaves, columnRules.leavesAfter(row, col));
+        return false;
+    }
+    return true;
+}
+
+// Every way of filling in the entries before splitPosition
+//  With prune set, the prefixes are cut by the same row and column checks the optimized search uses
+//  The column checks run first so the column counts in stats match a single threaded run
+void patternMatrix::possibleValuePrefixes(int position, int splitPosition, zmatrix &z, searchState state, double share, bool prune, std::vector<searchPrefix> &prefixes, generatorStats &stats) {
+    if (position == splitPosition) {
+        prefixes.push_back({z, state, share});
+        return;
+    }
+    int curRow = position / cols;
+    int curColumn = position % cols;
+    double childShare = share / possibleValues[curRow][curColumn].size();
+    for (int i = 0; i < possibleValues[curRow][curColumn].size(); i++) {
+        if (outOfBudget(stats)) return;
+        stats.nodes++;
+        z.z[curRow][curColumn] = possibleValues[curRow][curColumn][i];
+        searchState next = state;
+        bool keep = !prune || keepEntry(curRow, curColumn, z, next, stats);
+        if (keep && prune && curColumn == cols - 1) {
+            keep = isRowNormalized(curRow, z);
+            for (int j = 0; j < curRow && keep; j++) keep = areRowsOrthogonal(curRow, j, z);
+        }
+        if (!keep) {
+            stats.covered += childShare;
+            continue;
+        }
+        possibleValuePrefixes(position + 1, splitPosition, z, next, childShare, prune, prefixes, stats);
+    }
+}
+
+namespace {
+    // One worker's patterns, handed to the shared sink a batch at a time
+    //  The workers only take turns with the sink once a batch and the others keep searching while one of them flushes
+    class batchedSink : public patternSink {
+        public:
+            static constexpr size_t batch = 256;
+            batchedSink(patternSink &sink, std::mutex &lock) : sink(sink), lock(lock) { pending.reserve(batch); }
+            void add(const packedMatrix &pattern, uint64_t orbitSize) override {
+                pending.emplace_back(pattern, orbitSize);
+                if (pending.size() == batch) flush();
+            }
+            void flush() {
+                if (pending.empty()) return;
+                std::lock_guard<std::mutex> guard(lock);
+                for (const auto &[pattern, orbitSize] : pending) sink.add(pattern, orbitSize);
+                pending.clear();
+            }
+
+        private:
+            patternSink &sink;
+            std::mutex &lock;
+            std::vector<std::pair<packedMatrix, uint64_t>> pending;
+    };
+
+    // A batchedSink for every worker of a workPool, all in front of the same sink
+    class workerSinks {
+        public:
+            workerSinks(patternSink &sink, int workers) {
+                sinks.reserve(workers);
+                for (int i = 0; i < workers; i++) sinks.emplace_back(sink, lock);
+            }
+            batchedSink& operator[](int worker) { return sinks[worker]; }
+            // Whatever the workers still hold once the pool is done
+            void flush() {
+                for (auto &workerSink : sinks) workerSink.flush();
+            }
+
+        private:
+            std::mutex lock;
+            std::vector<batchedSink> sinks;
+    };
+}
+
+void patternMatrix::parallelPossibleValueSearch(bool optimized, patternSink &sink) {
+    generationStats = generatorStats();
+    if (optimized) columnRules = columnConstraints(possibleValues);
+    symmetryRules = symmetryBreaking ? patternSymmetry(possibleValues) : patternSymmetry();
+    searchState start = {columnConstraints::state(), symmetryRules.start()};
+    // The debug output has to come out in order so it stays on this thread
+    workPool pool(printDebugInfo ? 1 : generatorThreads);
+    zmatrix z = zmatrix(rows, cols, maxValue);
+    if (pool.size() == 1) {
+        startBudget(1);
+        if (optimized) optimizedAllPossibleValuePatterns(0, z, start, 1.0, sink, generationStats);
+        else recursiveAllPossibleValueSet(0, z, 1.0, sink, generationStats);
+        finishBudget();
+        return;
+    }
+    // One row is usually plenty of tasks, a second one is added when it isn't
+    //  The budget only starts once the split is picked so a pass that gets thrown away isn't charged
+    std::vector<searchPrefix> prefixes;
+    int splitPosition = 0;
+    for (int splitRows = 1; splitRows <= 2 && int(prefixes.size()) < 4 * pool.size(); splitRows++) {
+        prefixes.clear();
+        generationStats = generatorStats();
+        splitPosition = splitRows * cols;
+        possibleValuePrefixes(0, splitPosition, z, start, 1.0, optimized, prefixes, generationStats);
+    }
+    startBudget(pool.size());
+    if (budget) budget->charge(generationStats);
+    workerSinks shared(sink, pool.size());
+    std::vector<generatorStats> stats(pool.size());
+    pool.run(prefixes.size(), [&](int task, int worker) {
+        const searchPrefix &prefix = prefixes[task];
+        if (optimized) optimizedAllPossibleValuePatterns(splitPosition, prefix.z, prefix.state, prefix.share, shared[worker], stats[worker]);
+        else recursiveAllPossibleValueSet(splitPosition, prefix.z, prefix.share, shared[worker], stats[worker]);
+    });
+    shared.flush();
+    for (auto &workerStats : stats) generationStats.add(workerStats);
+    finishBudget();
+}
+
 void patternMatrix::generateRowSet(int pvRow, int rsPos, std::vector<int> newRow, int pos) {
-    if (pos == 6) {
+    if (pos == cols) {
         // Check if the row is normalized
         if (isRowNormalized(newRow)) {
             possiblePatternRowSets[rsPos].push_back(newRow);
+            uint64_t n = 0;
+            uint64_t m = 0;
+            for (int i = 0; i < newRow.size(); i++) {
+                n |= uint64_t(newRow[i] >> 1) << i;
+                m |= uint64_t(newRow[i] & 1) << i;
+            }
+            rowSetCodes[rsPos].push_back(rowTable::code(n, m));
             if (printDebugInfo) {
                 *debugOutput << "Row Set: " << rsPos << " Row: " << possiblePatternRowSets[rsPos].size() << " [";
                 for (int i = 0; i < newRow.size(); i++) {
@@ -773,15 +743,23 @@ void patternMatrix::generateRowSet(int pvRow, int rsPos, std::vector<int> newRow
 
 // This version will create sets of rows that are normalized, check orthogonality, and then generate patterns
 void patternMatrix::opt2GenerateAllPossibleValuePatterns() {
+    allPossibleValuePatterns.clear();
+    possibleValueOrbitSizes.clear();
+    patternMapSink sink(allPossibleValuePatterns, symmetryBreaking ? &possibleValueOrbitSizes : nullptr);
+    opt2GenerateAllPossibleValuePatterns(sink);
+}
+
+void patternMatrix::opt2GenerateAllPossibleValuePatterns(patternSink &sink) {
+    generationStats = generatorStats();
     if (possibleValuesLeadToAllPatterns()) {
-        *debugOutput << "All possible values lead to all patterns" << std::endl;
-        for (int i = 1; i <= 928; i++) {
-            // Load all of the patterns into the allPossibleValuePatterns map
-            allPossibleValuePatterns[patternMatrix(i).toString()] = true;
-        }
+        allPatternsToSink(sink, symmetryBreaking);
         return;
     }
-    allPossibleValuePatterns.clear();
+    symmetryRules = symmetryBreaking ? patternSymmetry(possibleValues) : patternSymmetry();
+    possiblePatternRowSets.clear();
+    rowSetCodes.clear();
+    rowSetStringToIntID.clear();
+    rowSetOrthogonality.clear();
     if (printDebugInfo) {
         *debugOutput << "Normalized Rows:" << std::endl;
     }
@@ -792,8 +770,9 @@ void patternMatrix::opt2GenerateAllPossibleValuePatterns() {
         if (rowSetStringToIntID.find(key) == rowSetStringToIntID.end()) {
             rowSetStringToIntID[key] = setNum;
             possiblePatternRowSets.push_back(std::vector<std::vector<int>>());
+            rowSetCodes.push_back(std::vector<int>());
             // Now, we need to create rows and check normality
-            generateRowSet(i, setNum, std::vector<int>(6), 0);
+            generateRowSet(i, setNum, std::vector<int>(cols), 0);
             setNum++;
         } 
         rowToRowSet[i] = rowSetStringToIntID[key];
@@ -805,26 +784,26 @@ void patternMatrix::opt2GenerateAllPossibleValuePatterns() {
     if (printDebugInfo) {
         *debugOutput << "Orthogonality of Row Sets:" << std::endl;
     }
+    // Every row in a set gets a bitset per row set of the rows there it's orthogonal to
+    //  The bits come straight out of the rowTable sets so nothing is checked twice
     // To try to add some clarity, rsi = row set i, rsj = row set j, ri = row i from rsi, rj = row j from rsj
+    const rowTable &table = rowTable::instance();
+    rowSetOrthogonality.resize(possiblePatternRowSets.size());
+    for (int rsi = 0; rsi < possiblePatternRowSets.size(); rsi++) {
+        rowSetOrthogonality[rsi].resize(possiblePatternRowSets[rsi].size(), std::vector<rowTable::rowSet>(possiblePatternRowSets.size()));
+    }
     for (int rsi = 0; rsi < possiblePatternRowSets.size(); rsi++) {
         for (int rsj = rsi; rsj < possiblePatternRowSets.size(); rsj++) {
             for (int ri = 0; ri < possiblePatternRowSets[rsi].size(); ri++) {
+                const rowTable::rowSet &orthogonalToRi = table.orthogonalTo(table.index(rowSetCodes[rsi][ri]));
                 for (int rj = 0; rj < possiblePatternRowSets[rsj].size(); rj++) {
-                    // skip if the comparison has already been done
-                    if (rsj < rsi && rj < ri) continue;
-                    std::string lhs = std::to_string(rsi) + "-" + std::to_string(ri);
-                    std::string rhs = std::to_string(rsj) + "-" + std::to_string(rj);
-                    std::string orthoKey1 = lhs + ":" + rhs;
-                    std::string orthoKey2 = rhs + ":" + lhs;
-                    // This will make look ups easier in the future
-                    if (lhs == rhs) {
-                        rowSetOrthogonality[orthoKey1] = true;
-                        continue;
+                    int j = table.index(rowSetCodes[rsj][rj]);
+                    bool isOrthogonal = (orthogonalToRi[j / 64] >> (j % 64)) & 1;
+                    if (isOrthogonal) {
+                        rowSetOrthogonality[rsi][ri][rsj][rj / 64] |= uint64_t(1) << (rj % 64);
+                        rowSetOrthogonality[rsj][rj][rsi][ri / 64] |= uint64_t(1) << (ri % 64);
                     }
-                    bool isOrthogonal = areRowsOrthogonal(possiblePatternRowSets[rsi][ri], possiblePatternRowSets[rsj][rj]);
-                    rowSetOrthogonality[orthoKey1] = isOrthogonal;
-                    rowSetOrthogonality[orthoKey2] = isOrthogonal;
-                    if (printDebugInfo) {
+                    if (printDebugInfo && !(rsi == rsj && ri == rj)) {
                         *debugOutput << "Row Set: " << rsi << " Row: " << ri << " [";
                         for (int i = 0; i < possiblePatternRowSets[rsi][ri].size(); i++) {
                             *debugOutput << possiblePatternRowSets[rsi][ri][i];
@@ -848,55 +827,128 @@ void patternMatrix::opt2GenerateAllPossibleValuePatterns() {
     if (printDebugInfo) {
         *debugOutput << "Generating Patterns:" << std::endl;
     }
-    recursiveRowSetPatternGeneration(0, std::vector<std::string>(6));
+    std::vector<int> rowSelections(rows);
+    packedMatrix selected;
+    // The debug output has to come out in order so it stays on this thread
+    workPool pool(printDebugInfo ? 1 : generatorThreads);
+    if (pool.size() == 1) {
+        startBudget(1);
+        recursiveRowSetPatternGeneration(0, rowSelections, selected, 1.0, sink, generationStats);
+        finishBudget();
+        return;
+    }
+    // One row is usually plenty of tasks, a second one is added when it isn't
+    //  The budget only starts once the split is picked so a pass that gets thrown away isn't charged
+    std::vector<std::vector<int>> prefixes;
+    std::vector<double> prefixShares;
+    int splitRow = 0;
+    for (int splitRows = 1; splitRows <= 2 && int(prefixes.size()) < 4 * pool.size(); splitRows++) {
+        prefixes.clear();
+        prefixShares.clear();
+        generationStats = generatorStats();
+        splitRow = splitRows;
+        rowSetPrefixes(0, splitRow, rowSelections, 1.0, prefixes, prefixShares, generationStats);
+    }
+    startBudget(pool.size());
+    if (budget) budget->charge(generationStats);
+    workerSinks shared(sink, pool.size());
+    std::vector<generatorStats> stats(pool.size());
+    pool.run(prefixes.size(), [&](int task, int worker) {
+        std::vector<int> taskSelections = prefixes[task];
+        packedMatrix taskSelected;
+        for (int j = 0; j < splitRow; j++) taskSelected.setRowCode(j, rowSetCodes[rowToRowSet[j]][taskSelections[j]]);
+        recursiveRowSetPatternGeneration(splitRow, taskSelections, taskSelected, prefixShares[task], shared[worker], stats[worker]);
+    });
+    shared.flush();
+    for (auto &workerStats : stats) generationStats.add(workerStats);
+    finishBudget();
+}
+
+// The rows in curRow's set that are orthogonal to every row picked so far
+rowTable::rowSet patternMatrix::rowSetCandidates(int curRow, const std::vector<int> &rowSelections) {
+    int rowSet = rowToRowSet[curRow];
+    int setSize = possiblePatternRowSets[rowSet].size();
+    rowTable::rowSet candidates{};
+    for (int w = 0; w * 64 < setSize; w++) {
+        candidates[w] = (setSize - w * 64 >= 64) ? ~uint64_t(0) : (uint64_t(1) << (setSize - w * 64)) - 1;
+    }
+    for (int j = 0; j < curRow; j++) {
+        const rowTable::rowSet &orthogonal = rowSetOrthogonality[rowToRowSet[j]][rowSelections[j]][rowSet];
+        for (int w = 0; w < rowTable::WORDS; w++) candidates[w] &= orthogonal[w];
+    }
+    return candidates;
+}
+
+// Every selection of the rows before splitRow that the search would go down
+void patternMatrix::rowSetPrefixes(int curRow, int splitRow, std::vector<int> &rowSelections, double share, std::vector<std::vector<int>> &prefixes, std::vector<double> &prefixShares, generatorStats &stats) {
+    if (curRow == splitRow) {
+        prefixes.push_back(rowSelections);
+        prefixShares.push_back(share);
+        return;
+    }
+    rowTable::rowSet candidates = rowSetCandidates(curRow, rowSelections);
+    int choices = 0;
+    for (uint64_t word : candidates) choices += std::popcount(word);
+    if (choices == 0) stats.covered += share;
+    for (int w = 0; w < rowTable::WORDS; w++) {
+        for (uint64_t bits = candidates[w]; bits != 0; bits &= bits - 1) {
+            if (outOfBudget(stats)) return;
+            stats.nodes++;
+            rowSelections[curRow] = w * 64 + std::countr_zero(bits);
+            rowSetPrefixes(curRow + 1, splitRow, rowSelections, share / choices, prefixes, prefixShares, stats);
+        }
+    }
 }
 
-void patternMatrix::recursiveRowSetPatternGeneration(int curRow, std::vector<std::string> rowSelections) {
+void patternMatrix::recursiveRowSetPatternGeneration(int curRow, std::vector<int> &rowSelections, packedMatrix &selected, double share, patternSink &sink, generatorStats &stats) {
     if (curRow == rows) return;
-    for (int i = 0; i < possiblePatternRowSets[rowToRowSet[curRow]].size(); i++) {
-        rowSelections[curRow] = std::to_string(rowToRowSet[curRow]) + "-" + std::to_string(i);
-        // Check orthogonality of the current row selection
-        bool validRowSelection = true;
-        for (int j = 0; j < curRow; j++) {
-            if (!rowSetOrthogonality[rowSelections[curRow] + ":" + rowSelections[j]]) {
-                validRowSelection = false;
-                break;
-            }
-        }
-        if (!validRowSelection) continue;
-        if (curRow == rows - 1) {
-            // We have a valid set of rows, now we need to generate the pattern
-            std::ostringstream os;
-            zmatrix z = zmatrix(rows, cols, maxValue);
-            for (int j = 0; j < rowSelections.size(); j++) {
-                std::string rs = rowSelections[j];
-                int rowSet = std::stoi(rs.substr(0, rs.find("-")));
-                int rowSelection = std::stoi(rs.substr(rs.find("-")+1));
-                for (int k = 0; k < possiblePatternRowSets[rowSet][rowSelection].size(); k++) {
-                    z.z[j][k] = possiblePatternRowSets[rowSet][rowSelection][k];
-                }
+    int rowSet = rowToRowSet[curRow];
+    rowTable::rowSet candidates = rowSetCandidates(curRow, rowSelections);
+    // Only the rows that are orthogonal to the ones above are children, no rows left covers the whole branch
+    int choices = 0;
+    for (uint64_t word : candidates) choices += std::popcount(word);
+    if (choices == 0) stats.covered += share;
+    for (int w = 0; w < rowTable::WORDS; w++) {
+        for (uint64_t bits = candidates[w]; bits != 0; bits &= bits - 1) {
+            if (outOfBudget(stats)) return;
+            stats.nodes++;
+            int i = w * 64 + std::countr_zero(bits);
+            rowSelections[curRow] = i;
+            selected.setRowCode(curRow, rowSetCodes[rowSet][i]);
+            // Rows with the same possible values are in the same row set, the leader never has one below the one before it
+            if (symmetryBreaking && !symmetryRules.rowInOrder(selected, curRow)) {
+                stats.symmetryPrunedBranches++;
+                stats.covered += share / choices;
+                continue;
             }
-            os << z;
-            patternMatrix pm = patternMatrix(1, os.str());
-            pm.matchOnCases();
-            int cM = pm.caseMatch;
-            bool isOrtho = pm.isOrthogonal();
-            bool isNorm = pm.isNormalized();
-            if (cM > 0 && isOrtho && isNorm) {
-                if (printDebugInfo) {
-                    *debugOutput << "Valid Pattern: " << pm << " Case Match: " << cM << " Count: " << allPossibleValuePatterns.size()+1 << " [Opt2]" << std::endl;
-                }
-                allPossibleValuePatterns[pm.toString()] = true;
-            } else {
-                if (printDebugInfo) {
-                    *debugOutput << "Invalid Pattern: " << pm << " Case Match: " << cM;
-                    *debugOutput << " Is " << (isOrtho ? "Orthogonal" : "Not Orthogonal");
-                    *debugOutput << " Is " << (isNorm ? "Normalized" : "Not Normalized");
-                    *debugOutput << " [Opt2]" << std::endl;
+            if (curRow == rows - 1) {
+                // We have a valid set of rows, now we need to generate the pattern
+                stats.leaves++;
+                stats.covered += share / choices;
+                patternCore pc(1, selected);
+                int cM = pc.matchOnCases();
+                bool isOrtho = pc.isOrthogonal();
+                bool isNorm = pc.isNormalized();
+                // Every pattern in the orbit is just as valid so only the leader is kept
+                uint64_t orbitSize = 1;
+                if (cM > 0 && isOrtho && isNorm && symmetryBreaking && !symmetryRules.isLeader(selected, orbitSize)) continue;
+                if (cM > 0 && isOrtho && isNorm) {
+                    stats.patterns++;
+                    if (printDebugInfo) {
+                        *debugOutput << "Valid Pattern: " << pc << " Case Match: " << cM << " Count: " << stats.patterns << " [Opt2]" << std::endl;
+                    }
+                    sink.add(selected, orbitSize);
+                } else {
+                    if (printDebugInfo) {
+                        *debugOutput << "Invalid Pattern: " << pc << " Case Match: " << cM;
+                        *debugOutput << " Is " << (isOrtho ? "Orthogonal" : "Not Orthogonal");
+                        *debugOutput << " Is " << (isNorm ? "Normalized" : "Not Normalized");
+                        *debugOutput << " [Opt2]" << std::endl;
+                    }
                 }
             }
+            recursiveRowSetPatternGeneration(curRow + 1, rowSelections, selected, share / choices, sink, stats);
         }
-        recursiveRowSetPatternGeneration(curRow + 1, rowSelections);
     }
 }
 
@@ -922,7 +974,7 @@ std::ostream& operator<<(std::ostream& os,const patternMatrix &pm) {
             temp.multilineOutput = true;
             os << temp;
         } else {
-            zmatrix temp = pm.pNewEncoding;
+            zmatrix temp = pm.pNewEncoding();
             temp.multilineOutput = true;
             os << temp;
         }
@@ -931,7 +983,7 @@ std::ostream& operator<<(std::ostream& os,const patternMatrix &pm) {
         if (pm.printOldEncoding) {
             os << pm.p;
         } else {
-            os << pm.pNewEncoding;
+            os << pm.pNewEncoding();
         }
     }
     return os;
@@ -960,23 +1012,25 @@ void patternMatrix::leftTGateMultiply(int pRow, int qRow) {
     //  This means adding rows p, q and replacing both with the result
     //  This might be different when p > q
     int result;
+    zmatrix &groups = pGroupings();
     for (int i = 0; i < p.z[pRow].size(); i++) {
         result = patternElementAddition(p.z[pRow][i], p.z[qRow][i]);
         p.z[pRow][i] = result;
         p.z[qRow][i] = result;
-        pNewEncoding.z[pRow][i] = (result == 1) ? 2 : (result == 2) ? 1 : result;
-        pNewEncoding.z[qRow][i] = (result == 1) ? 2 : (result == 2) ? 1 : result;
         // Update the LDE
         entryLDEs[pRow][i]++;
         entryLDEs[qRow][i]++;
         // Groupings - Going to use the lower group number of the two
         //  It might not matter but might also make it easier for humans to read
-        if (pGroupings.z[pRow][i] > pGroupings.z[qRow][i]) {
-            pGroupings.z[pRow][i] = pGroupings.z[qRow][i];
+        if (groups.z[pRow][i] > groups.z[qRow][i]) {
+            groups.z[pRow][i] = groups.z[qRow][i];
         } else {
-            pGroupings.z[qRow][i] = pGroupings.z[pRow][i];
+            groups.z[qRow][i] = groups.z[pRow][i];
         }
     }
+    p.invalidateMetadata();
+    groups.invalidateMetadata();
+    invalidateViews();
     
 }
 
@@ -990,23 +1044,25 @@ void patternMatrix::rightTGateMultiply(int pCol, int qCol) {
     //  This means adding column p, q and replacing both with the result
     //  This might be different when p > q
     int result;
+    zmatrix &groups = pGroupings();
     for (int i = 0; i < p.z.size(); i++) {
         result = patternElementAddition(p.z[i][pCol], p.z[i][qCol]);
         p.z[i][pCol] = result;
         p.z[i][qCol] = result;
-        pNewEncoding.z[i][pCol] = (result == 1) ? 2 : (result == 2) ? 1 : result;
-        pNewEncoding.z[i][qCol] = (result == 1) ? 2 : (result == 2) ? 1 : result;
         // Update the LDE
         entryLDEs[i][pCol]++;
         entryLDEs[i][qCol]++;
         // Groupings - Going to use the lower group number of the two
         //  It might not matter but might also make it easier for humans to read
-        if (pGroupings.z[i][pCol] <= pGroupings.z[i][qCol]) {
-            pGroupings.z[i][pCol] = pGroupings.z[i][qCol];
+        if (groups.z[i][pCol] <= groups.z[i][qCol]) {
+            groups.z[i][pCol] = groups.z[i][qCol];
         } else {
-            pGroupings.z[i][qCol] = pGroupings.z[i][pCol];
+            groups.z[i][qCol] = groups.z[i][pCol];
         }
     }
+    p.invalidateMetadata();
+    groups.invalidateMetadata();
+    invalidateViews();
 }
 
 
@@ -1065,12 +1121,12 @@ bool patternMatrix::optimalTGatesCase1() {
     // Case 1 has to go back to the origin, so one of options must have 2 case pairs 
     //  and we can skip a loop for the case pairs
     for (int pairs= 6; pairs > 0; pairs = pairs - 2) {
-        if (p.getColPairValuesCount(0, 1, caseValues) == 2 && p.colPairCounts[0][1] == pairs) {
+        if (p.getColPairValuesCount(0, 1, caseValues) == 2 && p.getColPairCounts()[0][1] == pairs) {
             std::vector<std::string> tGateOps;
             tGateOperationSets.push_back({"xT12"});
             optimalsFound = true;
         }
-        if (p.getRowPairValuesCount(0, 1, caseValues) == 2 && p.rowPairCounts[0][1] == pairs) {
+        if (p.getRowPairValuesCount(0, 1, caseValues) == 2 && p.getRowPairCounts()[0][1] == pairs) {
             std::vector<std::string> tGateOps;
             tGateOperationSets.push_back({"T12x"});
             optimalsFound = true;
@@ -1082,7 +1138,7 @@ bool patternMatrix::optimalTGatesCase1() {
 
 bool patternMatrix::optimalTGatesCase2() {
     /* 2: IF the first two columns must be fully paired
-    if (p.colPairCounts[0][1] != 6) {
+    if (p.getColPairCounts()[0][1] != 6) {
         return false;
     }
     */
@@ -1099,7 +1155,7 @@ bool patternMatrix::optimalTGatesCase3() {
         // The maximum overall pairings can only be +2 from the case pairings
         for (int pairs= cpairs + 2; pairs >= cpairs; pairs = pairs - 2) {
             if ((p.getColPairValuesCount(0, 1, caseValues) == cpairs || p.getColPairValuesCount(2, 3, caseValues) == cpairs) &&
-                (p.colPairCounts[0][1] == pairs || p.colPairCounts[2][3] == pairs)) {
+                (p.getColPairCounts()[0][1] == pairs || p.getColPairCounts()[2][3] == pairs)) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("xT12");
                 tGateOps.push_back("xT34");
@@ -1107,7 +1163,7 @@ bool patternMatrix::optimalTGatesCase3() {
                 optimalsFound = true;
             }
             if ((p.getColPairValuesCount(0, 2, caseValues) == cpairs || p.getColPairValuesCount(1, 3, caseValues) == cpairs) &&
-                (p.colPairCounts[0][2] == pairs || p.colPairCounts[1][3] == pairs)) {
+                (p.getColPairCounts()[0][2] == pairs || p.getColPairCounts()[1][3] == pairs)) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("xT13");
                 tGateOps.push_back("xT24");
@@ -1115,7 +1171,7 @@ bool patternMatrix::optimalTGatesCase3() {
                 optimalsFound = true;
             }
             if ((p.getColPairValuesCount(0, 3, caseValues) == cpairs || p.getColPairValuesCount(1, 2, caseValues) == cpairs) &&
-                (p.colPairCounts[0][3] == pairs || p.colPairCounts[1][2] == pairs)) {
+                (p.getColPairCounts()[0][3] == pairs || p.getColPairCounts()[1][2] == pairs)) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("xT14");
                 tGateOps.push_back("xT23");
@@ -1124,7 +1180,7 @@ bool patternMatrix::optimalTGatesCase3() {
             }
             // Next check for fully paired rows
             if ((p.getRowPairValuesCount(0, 1, caseValues) == cpairs || p.getRowPairValuesCount(2, 3, caseValues) == cpairs) &&
-                (p.rowPairCounts[0][1] == pairs || p.rowPairCounts[2][3] == pairs)) {
+                (p.getRowPairCounts()[0][1] == pairs || p.getRowPairCounts()[2][3] == pairs)) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("T12x");
                 tGateOps.push_back("T34x");
@@ -1132,14 +1188,14 @@ bool patternMatrix::optimalTGatesCase3() {
                 optimalsFound = true;
             }
             if ((p.getRowPairValuesCount(0, 2, caseValues) == cpairs || p.getRowPairValuesCount(1, 3, caseValues) == cpairs) &&
-                (p.rowPairCounts[0][2] == pairs || p.rowPairCounts[1][3] == pairs)) {
+                (p.getRowPairCounts()[0][2] == pairs || p.getRowPairCounts()[1][3] == pairs)) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("T13x");
                 tGateOps.push_back("T24x");
                 tGateOperationSets.push_back(tGateOps);
             }
             if ((p.getRowPairValuesCount(0, 3, caseValues) == cpairs || p.getRowPairValuesCount(1, 2, caseValues) == cpairs) &&
-                (p.rowPairCounts[0][3] == pairs || p.rowPairCounts[2][3] == pairs)) {
+                (p.getRowPairCounts()[0][3] == pairs || p.getRowPairCounts()[2][3] == pairs)) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("T14x");
                 tGateOps.push_back("T23x");
@@ -1180,25 +1236,25 @@ bool patternMatrix::optimalTGatesCase5() {
     for (int cpairs = 2; cpairs >= 0; cpairs = cpairs-2) {
         // The maximum overall pairings can only be +4 from the case pairings
         for (int pairs= cpairs + 4; pairs >= cpairs; pairs = pairs - 2) {
-            if (p.getColPairValuesCount(0, 1, caseValues) == cpairs && p.colPairCounts[0][1] == pairs) {
+            if (p.getColPairValuesCount(0, 1, caseValues) == cpairs && p.getColPairCounts()[0][1] == pairs) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("xT12");
                 tGateOperationSets.push_back(tGateOps);
                 optimalsFound = true;
             }
-            if (p.getColPairValuesCount(2, 3, caseValues) == cpairs && p.colPairCounts[2][3] == pairs) {
+            if (p.getColPairValuesCount(2, 3, caseValues) == cpairs && p.getColPairCounts()[2][3] == pairs) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("xT34");
                 tGateOperationSets.push_back(tGateOps);
                 optimalsFound = true;
             }
-            if (p.getRowPairValuesCount(0, 1, caseValues) == cpairs && p.rowPairCounts[0][1] == pairs) {
+            if (p.getRowPairValuesCount(0, 1, caseValues) == cpairs && p.getRowPairCounts()[0][1] == pairs) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("T12x");
                 tGateOperationSets.push_back(tGateOps);
                 optimalsFound = true;
             }
-            if (p.getRowPairValuesCount(2, 3, caseValues) == cpairs && p.rowPairCounts[2][3] == pairs) {
+            if (p.getRowPairValuesCount(2, 3, caseValues) == cpairs && p.getRowPairCounts()[2][3] == pairs) {
                 std::vector<std::string> tGateOps;
                 tGateOps.push_back("T34x");
                 tGateOperationSets.push_back(tGateOps);
@@ -1228,15 +1284,15 @@ bool patternMatrix::optimalTGatesCase7() {
     std::vector<int> caseValues = {2,3};
     int rc1 = 0;
     int rc2 = 1;
-    if (p.colPairCounts[2][3] > p.colPairCounts[0][1] || p.rowPairCounts[2][3] > p.rowPairCounts[0][1]) {
+    if (p.getColPairCounts()[2][3] > p.getColPairCounts()[0][1] || p.getRowPairCounts()[2][3] > p.getRowPairCounts()[0][1]) {
         rc1 = 2;
         rc2 = 3;
     }
-    if (p.colPairCounts[4][5] > p.colPairCounts[rc1][rc2] || p.rowPairCounts[4][5] > p.rowPairCounts[rc1][rc2]) {
+    if (p.getColPairCounts()[4][5] > p.getColPairCounts()[rc1][rc2] || p.getRowPairCounts()[4][5] > p.getRowPairCounts()[rc1][rc2]) {
         rc1 = 4;
         rc2 = 5;
     }
-    if (p.colPairCounts[rc1][rc2] > p.rowPairCounts[rc1][rc2]) {
+    if (p.getColPairCounts()[rc1][rc2] > p.getRowPairCounts()[rc1][rc2]) {
         rightTGateMultiply(rc1+1, rc2+1);
         return true;
     }
@@ -1626,20 +1682,6 @@ int patternMatrix::patternElementAddition(int a, int b) {
     return -1;  // This should never happen
 }
 
-void patternMatrix::loadCases() {
-    // Loading from a file is another way to do this but, with only 8 of them and only being used for the patterns, this is fine
-    // Case 0 is the root case and is all 0s
-    cases.push_back(caseMatrix(0, "[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
-    cases.push_back(caseMatrix(1, "[1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
-    cases.push_back(caseMatrix(2, "[1,1,0,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
-    cases.push_back(caseMatrix(3, "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,1,1,0,0][1,1,1,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
-    cases.push_back(caseMatrix(4, "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
-    cases.push_back(caseMatrix(5, "[1,1,0,0,0,0][1,1,0,0,0,0][0,0,1,1,0,0][0,0,1,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"));
-    cases.push_back(caseMatrix(6, "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,0,0,1,1][1,1,0,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"));
-    cases.push_back(caseMatrix(7, "[1,1,0,0,0,0][1,1,0,0,0,0][0,0,1,1,0,0][0,0,1,1,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"));
-    cases.push_back(caseMatrix(8, "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,0,0,1,1][1,1,0,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"));
-}
-
 // TODO - Refactor this to output either the new or old encoding
 //  it might be betteer to have a function for toStringOldEncoding and toStringNewEncoding
 std::string patternMatrix::toString() {
@@ -1648,12 +1690,6 @@ std::string patternMatrix::toString() {
     return os.str();
 }
 
-struct rearrangedPattern
-{
-   std::vector<std::vector<int>> rearrangedMatrix;
-   bool done;
-};
-
 // TODO - This might not need a return value so remove?
 bool patternMatrix::rearrangeMatrix() {
     // Clear out the previous rearraangements
@@ -1672,65 +1708,11 @@ bool patternMatrix::rearrangeMatrix() {
     if (caseMatch == 0) {
         return false;
     }
-    
-    //  We also need to try both the pattern and the transposed pattern
-    if (cV == cases[caseMatch].c) {
-        rearrangeColumns(p, cV, 0);
-    }
-    if (cVT == cases[caseMatch].c) {
-        rearrangeColumns(pT, cVT, 0);
-    }
-    return true;
-}
-
-void patternMatrix::rearrangeColumns(zmatrix patternVersion, zmatrix caseVersion, int curCol) {
-    if (singleCaseRearrangement && caseRearrangements.size() > 0) return;
-    for (int i = curCol; i < cols; i++) {
-        // If the column is all 0s, then we don't need to do anything
-        if (cases[caseMatch].c.zColCounts[curCol][1] == 0) {
-            curCol++;
-            continue;
-        }
-        // swap columns
-        if (cases[caseMatch].c.zColCounts[curCol][1] == caseVersion.zColCounts[i][1]) {
-            zmatrix myPattern = patternVersion;
-            zmatrix myCase = caseVersion;
-            if (curCol != i) {
-                myPattern.swapColumns(curCol, i);
-                myCase.swapColumns(curCol, i);
-            }
-            rearrangeColumns(myPattern, myCase, curCol+1);
-        }
-    }
-    if (curCol == cols && caseVersion.zColCounts == cases[caseMatch].c.zColCounts) {
-        rearrangeRows(patternVersion, caseVersion, 0);
-    }
-}
 
-void patternMatrix::rearrangeRows(zmatrix patternVersion, zmatrix caseVersion, int curRow) {
-    if (singleCaseRearrangement && caseRearrangements.size() > 0) return;
-    for (int i = curRow; i < rows; i++) {
-        // If the row is all 0s, then we don't need to do anything
-        if (cases[caseMatch].c.zRowCounts[curRow][1] == 0) {
-            curRow++;
-            continue;
-        }
-        // swap rows
-        if (cases[caseMatch].c.zRowCounts[curRow][1] == caseVersion.zRowCounts[i][1]) {
-            zmatrix myPattern = patternVersion;
-            zmatrix myCase = caseVersion;
-            if (curRow != i) {
-                myPattern.swapRows(curRow, i);
-                myCase.swapRows(curRow, i);
-            }
-            rearrangeRows(myPattern, myCase, curRow+1);
-        }
-    }
-    if (curRow == rows && caseVersion.strictMatch(cases[caseMatch].c)) {
-        std::ostringstream os;
-        os << patternVersion;
-        caseRearrangements[os.str()] = true;
-    }
+    // The pattern and the transposed pattern are both tried
+    caseRearranger rearranger(cases.all().packed(caseMatch));
+    caseRearrangements = rearranger.alignments(p.toPacked(), singleCaseRearrangement ? 1 : 0);
+    return true;
 }
 
 
@@ -1757,229 +1739,150 @@ void patternMatrix::rearrangeRows(zmatrix patternVersion, zmatrix caseVersion, i
 */
 
 bool patternMatrix::isSymmetric() {
-    return p == pT;
+    return p == pT();
 }
 
-bool patternMatrix::isNormalized() {
-    bool isNormal = true;
-    for (int i = 0; i < p.z.size(); i++) {
-        int m4Row = 0;
-        int m2Row = 0;
-        int m4Col = 0;
-        int m2Col = 0;
-        for (int j = 0; j < p.z.size(); j++) {
-            if (p.z[i][j] > 3) {
-                std::ostringstream os;
-                os << "Invalid value in pattern matrix: " << p.z[i][j];
-                throw std::runtime_error(os.str());
-            
-            }
-            int mij = p.z[i][j] / 2 + 2 * (p.z[i][j] % 2);  //mij = Nij + 2*Mij (row)
-            int mji = p.z[j][i] / 2 + 2 * (p.z[j][i] % 2);  //mji = Nji + 2*Mji (column)
-            // Rule i. ∑ mij = 0 (mod4); row check
-            m4Row += mij;
-            // Rule i. ∑ mji = 0 (mod4); column check
-            m4Col += mji;
-            // Rule ii. mij = 3 has to be paired if exists (row check)
-            if (mij == 3) m2Row++;
-            // Rule ii. mij = 3 has to be paired if exists (col check)
-            if (mji == 3) m2Col++;
+// The checks themselves are the packedMatrix bit plane kernels and the rowTable lookups, these only add the debug output
+//  The sums and counts it prints are only worked out for the rows and columns that fail
+static int normalizationSum(uint64_t n, uint64_t m) { return std::popcount(n) + 2 * std::popcount(m); }
+static int dotProduct(uint64_t n1, uint64_t m1, uint64_t n2, uint64_t m2) {
+    return std::popcount(n1 & n2) + 2 * (std::popcount(n1 & m2) + std::popcount(m1 & n2)) + 4 * std::popcount(m1 & m2);
+}
+static int mixedPairs(uint64_t n1, uint64_t m1, uint64_t n2, uint64_t m2) {
+    return std::popcount((n1 | m1) & (n2 | m2) & ((n1 ^ n2) | (m1 ^ m2)));
+}
+
+// N and M slices of a single row, the same split packedMatrix uses
+static void rowPlanes(const std::vector<int> &row, uint64_t &n, uint64_t &m, const char *context) {
+    n = 0;
+    m = 0;
+    for (int j = 0; j < row.size(); j++) {
+        if (row[j] < 0 || row[j] > 3) {
+            std::ostringstream os;
+            os << "Invalid value in " << context << ": " << row[j];
+            throw std::runtime_error(os.str());
         }
-        if (m4Row % 4 != 0 || m2Row % 2 != 0) {
-            if (printDebugInfo) {
+        n |= uint64_t(row[j] >> 1) << j;
+        m |= uint64_t(row[j] & 1) << j;
+    }
+}
+
+bool patternMatrix::isNormalized() {
+    packedMatrix pm = p.toPacked();
+    int rowFailures = pm.rowNormalizationFailures();
+    int colFailures = pm.colNormalizationFailures();
+    if (printDebugInfo && (rowFailures | colFailures) != 0) {
+        packedMatrix t = pm.transposed();
+        for (int i = 0; i < packedMatrix::ROWS; i++) {
+            if (rowFailures & (1 << i)) {
+                int m4Row = normalizationSum(pm.rowN(i), pm.rowM(i));
+                int m2Row = std::popcount(pm.rowN(i) & pm.rowM(i));
                 *debugOutput << "Row " << i+1 << " is not normalized" << std::endl;
                 *debugOutput << "  Rule i. ∑ mij = " << m4Row << "; mod4: " << m4Row % 4 << std::endl;
                 *debugOutput << "  Rule ii. mij = 3 has to be paired if exists; count: " << m2Row << "; mod2: " << m2Row % 2 << std::endl;
             }
-            isNormal = false;
-        }
-        if (m4Col % 4 != 0 || m2Col % 2 != 0) {
-            if (printDebugInfo) {
+            if (colFailures & (1 << i)) {
+                int m4Col = normalizationSum(t.rowN(i), t.rowM(i));
+                int m2Col = std::popcount(t.rowN(i) & t.rowM(i));
                 *debugOutput << "Column " << i+1 << " is not normalized" << std::endl;
                 *debugOutput << "  Rule i. ∑ mji = " << m4Col << "; mod4: " << m4Col % 4 << std::endl;
                 *debugOutput << "  Rule ii. mij = 3 has to be paired if exists; count: " << m2Col << "; mod2: " << m2Col % 2 << std::endl;
             }
-            isNormal = false;
         }
     }
-    return isNormal;
+    return (rowFailures | colFailures) == 0;
 }
 
 bool patternMatrix::isOrthogonal() {
-    bool isOrthogonal = true;
-    // Orthogonality Checks
-    for (int i = 0; i < p.z.size(); i++) {
-        for (int j = i + 1; j < p.z.size(); j++) {
-            int m2RowDotProd = 0;
-            int m2RowPairs = 0;
-            int m2ColDotProd = 0;
-            int m2ColPairs = 0;
-            for (int k = 0; k < p.z.size(); k++) {
-                /*
-                */
-                int mik = p.z[i][k] / 2 + 2 * (p.z[i][k] % 2);  //mij = Nij + 2*Mij (row A)
-                int mjk = p.z[j][k] / 2 + 2 * (p.z[j][k] % 2);  //mkj = Nkj + 2*Mkj (row B)
-                int mki = p.z[k][i] / 2 + 2 * (p.z[k][i] % 2);  //mji = Nji + 2*Mji (column A)
-                int mkj = p.z[k][j] / 2 + 2 * (p.z[k][j] % 2);  //mjk = Njk + 2*Mjk (column B)
-                // iii. ri · rj = 0 (mod2) when i  ̸= k
-                // row A * row B
-                m2RowDotProd += mik * mjk;
-                // col A * col B
-                m2ColDotProd += mki * mkj;
-                // iv. the count of (1, 2), (1, 3), and (2, 3) pairs in  ri and rj should be even
-                if (mik != 0 && mjk != 0 && mik != mjk) m2RowPairs++;
-                if (mki != 0 && mkj != 0 && mki != mkj) m2ColPairs++;
-            }
-            if (m2RowDotProd % 2 != 0 || m2RowPairs % 2 != 0 ) {
-                if (printDebugInfo) {
+    packedMatrix pm = p.toPacked();
+    uint64_t rowFailures = pm.rowOrthogonalityFailures();
+    uint64_t colFailures = pm.colOrthogonalityFailures();
+    if (printDebugInfo && (rowFailures | colFailures) != 0) {
+        packedMatrix t = pm.transposed();
+        for (int i = 0; i < packedMatrix::ROWS; i++) {
+            for (int j = i + 1; j < packedMatrix::ROWS; j++) {
+                uint64_t pair = uint64_t(1) << (i * packedMatrix::COLS + j);
+                if (rowFailures & pair) {
+                    int m2RowDotProd = dotProduct(pm.rowN(i), pm.rowM(i), pm.rowN(j), pm.rowM(j));
+                    int m2RowPairs = mixedPairs(pm.rowN(i), pm.rowM(i), pm.rowN(j), pm.rowM(j));
                     *debugOutput << "Rows " << i+1 << " and " << j+1 << " are not orthogonal" << std::endl;
                     *debugOutput << "  Dot Product = " << m2RowDotProd << "; mod2 = " << m2RowDotProd % 2 << std::endl;
                     *debugOutput << "  (1, 2), (1, 3), and (2, 3) pairs should be even; count = " << m2RowPairs << "; mod2 = " << m2RowPairs % 2 << std::endl;
                 }
-                isOrthogonal = false;
-            }
-            if (m2ColDotProd % 2 != 0 || m2ColPairs % 2 != 0) {
-                if (printDebugInfo) {
+                if (colFailures & pair) {
+                    int m2ColDotProd = dotProduct(t.rowN(i), t.rowM(i), t.rowN(j), t.rowM(j));
+                    int m2ColPairs = mixedPairs(t.rowN(i), t.rowM(i), t.rowN(j), t.rowM(j));
                     *debugOutput << "Columns " << i+1 << " and " << j+1 << " are not orthogonal" << std::endl;
                     *debugOutput << "  Dot Product = " << m2ColDotProd << "; mod2 = " << m2ColDotProd % 2 << std::endl;
                     *debugOutput << "  (1, 2), (1, 3), and (2, 3) pairs should be even; count = " << m2ColPairs << "; mod2 = " << m2ColPairs % 2 << std::endl;
                 }
-                isOrthogonal = false;
             }
         }
     }
-    return isOrthogonal;
+    return (rowFailures | colFailures) == 0;
 }
 
-bool patternMatrix::isRowNormalized(int row, zmatrix z) {
-    // This should probably just call isRowNormalized(std::vector<int> row) and pass in z.z[row]
-    // but this might not be used once we get the new sets optimization in place for possible values
-    bool isNormal = true;
-    int m4Row = 0;
-    int m2Row = 0;
-    for (int j = 0; j < z.z[row].size(); j++) {
-        if (z.z[row][j] > 3) {
-            std::ostringstream os;
-            os << "Invalid value in pattern matrix: " << p.z[row][j];
-            throw std::runtime_error(os.str());
-        
-        }
-        int mij = z.z[row][j] / 2 + 2 * (z.z[row][j] % 2);  //mij = Nij + 2*Mij (row)
-        // Rule i. ∑ mij = 0 (mod4); row check
-        m4Row += mij;
-        // Rule ii. mij = 3 has to be paired if exists (row check)
-        if (mij == 3) m2Row++;
-    }
-    if (m4Row % 4 != 0 || m2Row % 2 != 0) {
-        if (printDebugInfo) {
-            *debugOutput << "Row " << row + 1 << " is not normalized: [";
-            for (int j = 0; j < z.z[row].size(); j++) {
-                int v = z.z[row][j];
-                v = (v == 1) ? 2 : (v == 2) ? 1 : v;
-                *debugOutput << v;
-                if (j < z.z[row].size() - 1) *debugOutput << ",";
-            }
-            *debugOutput << "]" << std::endl;
-            //std::cout << "  Rule i. ∑ mij = " << m4Row << "; mod4: " << m4Row % 4 << std::endl;
-            //std::cout << "  Rule ii. mij = 3 has to be paired if exists; count: " << m2Row << "; mod2: " << m2Row % 2 << std::endl;
+bool patternMatrix::isRowNormalized(int row, const zmatrix &z) {
+    uint64_t n, m;
+    rowPlanes(z.z[row], n, m, "pattern matrix");
+    if (rowTable::instance().isNormalized(rowTable::code(n, m))) return true;
+    if (printDebugInfo) {
+        *debugOutput << "Row " << row + 1 << " is not normalized: [";
+        for (int j = 0; j < z.z[row].size(); j++) {
+            int v = z.z[row][j];
+            v = (v == 1) ? 2 : (v == 2) ? 1 : v;
+            *debugOutput << v;
+            if (j < z.z[row].size() - 1) *debugOutput << ",";
         }
-        isNormal = false;
+        *debugOutput << "]" << std::endl;
     }
-    return isNormal;
+    return false;
 }
 
-bool patternMatrix::isRowNormalized(std::vector<int> row) {
-    bool isNormal = true;
-    int m4Row = 0;
-    int m2Row = 0;
-    for (int j = 0; j < row.size(); j++) {
-        if (row[j] > 3) {
-            std::ostringstream os;
-            os << "Invalid value in isRowNormalized check: " << row[j];
-            throw std::runtime_error(os.str());
-        
+bool patternMatrix::isRowNormalized(const std::vector<int> &row) {
+    uint64_t n, m;
+    rowPlanes(row, n, m, "isRowNormalized check");
+    if (rowTable::instance().isNormalized(rowTable::code(n, m))) return true;
+    if (printDebugInfo) {
+        *debugOutput << "Row is not normalized: [";
+        for (int j = 0; j < row.size(); j++) {
+            int v = row[j];
+            v = (v == 1) ? 2 : (v == 2) ? 1 : v;
+            *debugOutput << v;
+            if (j < row.size() - 1) *debugOutput << ",";
         }
-        int mij = row[j] / 2 + 2 * (row[j] % 2);  //mij = Nij + 2*Mij (row)
-        // Rule i. ∑ mij = 0 (mod4); row check
-        m4Row += mij;
-        // Rule ii. mij = 3 has to be paired if exists (row check)
-        if (mij == 3) m2Row++;
-    }
-    if (m4Row % 4 != 0 || m2Row % 2 != 0) {
-        if (printDebugInfo) {
-            *debugOutput << "Row is not normalized: [";
-            for (int j = 0; j < row.size(); j++) {
-                int v = row[j];
+        *debugOutput << "]" << std::endl;
+    }
+    return false;
+}
+
+bool patternMatrix::areRowsOrthogonal(int row1, int row2, const zmatrix &z) {
+    uint64_t n1, m1, n2, m2;
+    rowPlanes(z.z[row1], n1, m1, "pattern matrix");
+    rowPlanes(z.z[row2], n2, m2, "pattern matrix");
+    if (rowTable::instance().areOrthogonal(rowTable::code(n1, m1), rowTable::code(n2, m2))) return true;
+    if (printDebugInfo) {
+        int highRow = row1;
+        if (row2 > row1) highRow = row2;
+        *debugOutput << "Rows " << row1+1 << " and " << row2+1 << " are not orthogonal:  ";
+        for (int k = 0; k <= highRow; k++) {
+            *debugOutput << "Row " << k+1 << ": [";
+            for (int n = 0; n < z.z[k].size(); n++) {
+                int v = z.z[k][n];
                 v = (v == 1) ? 2 : (v == 2) ? 1 : v;
                 *debugOutput << v;
-                if (j < row.size() - 1) *debugOutput << ",";
-            }
-            *debugOutput << "]" << std::endl;
-            //std::cout << "  Rule i. ∑ mij = " << m4Row << "; mod4: " << m4Row % 4 << std::endl;
-            //std::cout << "  Rule ii. mij = 3 has to be paired if exists; count: " << m2Row << "; mod2: " << m2Row % 2 << std::endl;
-        }
-        isNormal = false;
-    }
-    return isNormal;
-}
-
-bool patternMatrix::areRowsOrthogonal(int row1, int row2, zmatrix z) {
-    bool isOrthogonal = true;
-    int m2RowDotProd = 0;
-    int m2RowPairs = 0;
-    for (int k = 0; k < z.z[row1].size(); k++) {
-        /*
-        */
-        int mik = z.z[row1][k] / 2 + 2 * (z.z[row1][k] % 2);  //mij = Nij + 2*Mij (row A)
-        int mjk = z.z[row2][k] / 2 + 2 * (z.z[row2][k] % 2);  //mkj = Nkj + 2*Mkj (row B)
-        // iii. ri · rj = 0 (mod2) when i  ̸= k
-        // row A * row B
-        m2RowDotProd += mik * mjk;
-        // iv. the count of (1, 2), (1, 3), and (2, 3) pairs in  ri and rj should be even
-        if (mik != 0 && mjk != 0 && mik != mjk) m2RowPairs++;
-    }
-    if (m2RowDotProd % 2 != 0 || m2RowPairs % 2 != 0 ) {
-        if (printDebugInfo) {
-            int highRow = row1;
-            if (row2 > row1) highRow = row2;
-            *debugOutput << "Rows " << row1+1 << " and " << row2+1 << " are not orthogonal:  "; 
-            for (int k = 0; k <= highRow; k++) {
-                *debugOutput << "Row " << k+1 << ": [";
-                for (int n = 0; n < z.z[k].size(); n++) {
-                    int v = z.z[k][n];
-                    v = (v == 1) ? 2 : (v == 2) ? 1 : v;
-                    *debugOutput << v;
-                    //std::cout << z.z[k][n];
-                    if (n < z.z[k].size() - 1) *debugOutput << ",";
-                }
-                *debugOutput << "]  ";
+                if (n < z.z[k].size() - 1) *debugOutput << ",";
             }
-            *debugOutput << std::endl;
-            //std::cout << "  Dot Product = " << m2RowDotProd << "; mod2 = " << m2RowDotProd % 2 << std::endl;
-            //std::cout << "  (1, 2), (1, 3), and (2, 3) pairs should be even; count = " << m2RowPairs << "; mod2 = " << m2RowPairs % 2 << std::endl;
+            *debugOutput << "]  ";
         }
-        isOrthogonal = false;
-    }
-    return isOrthogonal;
-}
-
-bool patternMatrix::areRowsOrthogonal(std::vector<int> row1, std::vector<int> row2) {
-    bool isOrthogonal = true;
-    int m2RowDotProd = 0;
-    int m2RowPairs = 0;
-    for (int k = 0; k < row1.size(); k++) {
-        /*
-        */
-        int mik = row1[k] / 2 + 2 * (row1[k] % 2);  //mij = Nij + 2*Mij (row A)
-        int mjk = row2[k] / 2 + 2 * (row2[k] % 2);  //mkj = Nkj + 2*Mkj (row B)
-        // iii. ri · rj = 0 (mod2) when i  ̸= k
-        // row A * row B
-        m2RowDotProd += mik * mjk;
-        // iv. the count of (1, 2), (1, 3), and (2, 3) pairs in  ri and rj should be even
-        if (mik != 0 && mjk != 0 && mik != mjk) m2RowPairs++;
-    }
-    if (m2RowDotProd % 2 != 0 || m2RowPairs % 2 != 0 ) {
-        isOrthogonal = false;
-    }
-    return isOrthogonal;
+        *debugOutput << std::endl;
+    }
+    return false;
+}
+
+bool patternMatrix::areRowsOrthogonal(const std::vector<int> &row1, const std::vector<int> &row2) {
+    uint64_t n1, m1, n2, m2;
+    rowPlanes(row1, n1, m1, "areRowsOrthogonal check");
+    rowPlanes(row2, n2, m2, "areRowsOrthogonal check");
+    return rowTable::instance().areOrthogonal(rowTable::code(n1, m1), rowTable::code(n2, m2));
 }
\ No newline at end of file
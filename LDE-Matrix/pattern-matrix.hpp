@@ -1,9 +1,12 @@
 #ifndef PATTERN_MATRIX_HPP
 #define PATTERN_MATRIX_HPP
 
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include <format>
 #include <iostream>
 #include <string>
@@ -11,6 +14,13 @@
 #include <sstream>
 
 #include "case-matrix.hpp"
+#include "case-registry.hpp"
+#include "column-constraints.hpp"
+#include "pattern-core.hpp"
+#include "pattern-sink.hpp"
+#include "pattern-symmetry.hpp"
+#include "row-table.hpp"
+#include "search-budget.hpp"
 #include "zmatrix.hpp"
 
 class patternMatrix {
@@ -19,40 +29,55 @@ class patternMatrix {
         patternMatrix(int pattern928Number);  // This will load a 928 pattern by number
         patternMatrix(int patternNumber, std::string matrix);
         patternMatrix(int pNum, std::string matrix, bool newEncoding);
+        explicit patternMatrix(const patternCore &core);  // Keeps the case match of the core
         int id;  // Primary identifier for the pattern
         // These identifiers start at 1 and increase with 0 meaning it's not in the file
         int id2704 = 0;  // Identifier for the 2704 pattern
         int id928 = 0;   // Identifier for the 928 pattern
         int id785 = 0;   // Identifier for the 785 pattern
-        // Cases that the pattern could match
-        std::vector<caseMatrix> cases;
+        // Cases that the pattern could match, every pattern shares the same read-only set
+        caseList cases;
         int caseMatch;
         char subCaseMatch;
+        caseAlignment caseAlign;  // How the pattern lines up with caseMatch, set by matchOnCases
         bool rearrangedToMatchCase = false;
         // These are the flags for the pattern matrix
         bool printDebugInfo = false;  // WIP: This is for printing debug information
         std::ostream* debugOutput;  // WIP...does this work???
         bool singleCaseRearrangement = false;  // This is stop the case rearrangement code after a single solution is found
+        generatorStats generationStats;  // Counts from the last *GenerateAllPossibleValuePatterns run
+        // The generators only keep the leader of each orbit of patternSymmetry, its orbit size goes in possibleValueOrbitSizes
+        //  The optimized search cuts entries that break the leader's order, opt2 cuts rows and the standard search only checks its leaves
+        bool symmetryBreaking = false;
+        // Threads for the *GenerateAllPossibleValuePatterns searches, 0 uses every core and debug output always uses 1
+        //  Runs that already go wide over patterns should leave this at 1 so the machine isn't oversubscribed
+        int generatorThreads = 1;
+        // Limits for the *GenerateAllPossibleValuePatterns searches, a search that runs out keeps what it found and sets generationStats.stop
+        searchBudget generatorBudget;
         // << operator flags
         bool printID = false;
         bool printCaseMatch = false;
         bool printAllIDs = false;
         bool multilineOutput = false;
         bool printOldEncoding = false;
-        // TODO refactor to split new vs old encoding
-        zmatrix pNewEncoding;  // This is the pattern matrix with the new encoding - 2y + x
-        // These are the matrices that are used for comparison
         zmatrix p; // This is the pattern matrix
-        zmatrix pT;  // This is the transposed pattern matrix
-        zmatrix swap23;  // This is the pattern matrix with 2s swapped for 3s and 3s swapped for 2s
-        zmatrix swap23T;  // This is the transposed pattern matrix with 2s swapped for 3s and 3s swapped for 2s
-        zmatrix cV;  // This is the pattern matrix changed to match the case style, 0s for 0,1 and 1s for 2,3
-        zmatrix cVT;  // This is the transposed pattern matrix changed to match the case style, 0s for 0,1 and 1s for 2,3
-        zmatrix pGroupings;  // This is the pattern matrix with the groupings applied
+        // These are the matrices that are used for comparison
+        //  They are all built from p the first time they're asked for and kept until p changes
+        // TODO refactor to split new vs old encoding
+        const zmatrix& pNewEncoding() const;  // This is the pattern matrix with the new encoding - 2y + x
+        const zmatrix& pT() const;  // This is the transposed pattern matrix
+        const zmatrix& swap23() const;  // This is the pattern matrix with 2s swapped for 3s and 3s swapped for 2s
+        const zmatrix& swap23T() const;  // This is the transposed pattern matrix with 2s swapped for 3s and 3s swapped for 2s
+        const zmatrix& cV() const;  // This is the pattern matrix changed to match the case style, 0s for 0,1 and 1s for 2,3
+        const zmatrix& cVT() const;  // This is the transposed pattern matrix changed to match the case style, 0s for 0,1 and 1s for 2,3
+        zmatrix& pGroupings();  // This is the pattern matrix with the groupings applied
+        // Call this after changing p so the views above are rebuilt
+        void invalidateViews();
         std::vector<std::vector<std::vector<int>>> possibleValues;  // After LDE reduction, these are the possible values for the pattern
         std::vector<std::vector<std::vector<int>>> possiblePatternRowSets;  // This holds sets of normalized possible rows for a new pattern
         std::unordered_map<std::string, int> rowSetStringToIntID;  // This maps the row set string to an integer ID
-        std::unordered_map<std::string, bool> rowSetOrthogonality;  // This maps a row set combination string to a boolean value for orthogonality
+        std::vector<std::vector<int>> rowSetCodes;  // The same rows as rowTable codes
+        std::vector<std::vector<std::vector<rowTable::rowSet>>> rowSetOrthogonality;  // [rsi][ri][rsj] -> bitset of the rows in row set rsj that are orthogonal to row ri of row set rsi
         std::vector<int> rowToRowSet;  // This maps a row to a row set
         // TODO: Add a A, B set of matrices for the pattern where: A+Bsqrt(2) = pattern
         //   and use these for normality and orthogonality checking
@@ -60,14 +85,10 @@ class patternMatrix {
         // TODO: Use this to check all the rules that Ming shared such as normality, orthogonality, 3 pair counts, 2/1 pair counts, etc.
         //    See line 160 in the Latex document
         std::string originalMatrix; // This is the original matrix string
-        std::unordered_map<std::string, bool> caseRearrangements; // This is a map of all the possible case rearrangements
+        std::vector<packedMatrix> caseRearrangements; // The distinct case rearrangements in the order they were found
         std::unordered_map<std::string, bool> allPossibleValuePatterns; // This is a map of all the possible case rearrangements
-        std::vector<std::vector<int>> rowPairCounts;  // This is the row pair counts for the pattern
-        std::vector<std::vector<int>> colPairCounts;  // This is the col pair counts for the pattern
-        // The following totals are counts of the pair counts
-        //  i=0 -> number of rows/cols with no pairs, i=2 -> number of rows/cols with 2 pairs, i=4 -> number of rows/cols with 4 pairs, i=6 -> number of rows/cols with 6 pairs
-        std::vector<int> rowPairCountsTotals;  // This contains the totals of the row pair counts for the pattern 
-        std::vector<int> colPairCountsTotals;  // This contains the totals of the col pair counts for the pattern
+        std::unordered_map<std::string, uint64_t> possibleValueOrbitSizes;  // Pattern -> orbit size for allPossibleValuePatterns when symmetryBreaking is set
+        // The pair counts are p's, read them with p.getRowPairCounts() / p.getColPairCounts()
         // LDE Tracking
         int LDE = 0;  // This is the LDE of the pattern
         // This tracks an entry by entry LDE change based on T-Gate operations and factorization
@@ -79,23 +100,12 @@ class patternMatrix {
         //  This will follow the format of the T-Gate operations and what is listed in the papers
         std::vector<std::vector<std::string>> tGateOperationSets;
 
-        void loadFromString(std::string m);
-        void updatePairCounts();
+        void loadFromString(std::string_view m);  // Any layout patternParser reads
+        void loadFromPacked(const packedMatrix &pattern);
         // Case Matching Functions
         void matchOnCases();
         bool matchesCase(int caseIndex);
         bool determineSubCase();
-        bool case1SubCaseMatch();
-        bool case2SubCaseMatch();
-        bool case3SubCaseMatch();
-        bool case3aSubCaseCheck();
-        bool case3bSubCaseCheck();
-        bool case3cSubCaseCheck();
-        bool case4SubCaseMatch();
-        bool case5SubCaseMatch();
-        bool case6SubCaseMatch();
-        bool case7SubCaseMatch();
-        bool case8SubCaseMatch();
         std::string getFirstCaseRearrangement();
 
         // Duplicate Pattern Checks
@@ -121,13 +131,48 @@ class patternMatrix {
         // Get the possible values
         std::string getMaxOfPossibleValues();
         bool possibleValuesLeadToAllPatterns();
+        // The generators send every valid pattern to a sink as it's found
+        //  The versions without one fill allPossibleValuePatterns, and possibleValueOrbitSizes with symmetryBreaking
         void generateAllPossibleValuePatterns();
+        void generateAllPossibleValuePatterns(patternSink &sink);
         void optimizedGenerateAllPossibleValuePatterns();
+        void optimizedGenerateAllPossibleValuePatterns(patternSink &sink);
         void generateRowSet(int pvRow, int rsPos, std::vector<int> newRow, int pos);
         void opt2GenerateAllPossibleValuePatterns();
-        void recursiveRowSetPatternGeneration(int curRow, std::vector<std::string> rowSelections);
-        void recursiveAllPossibleValueSet(int position, zmatrix z);
-        void optimizedAllPossibleValuePatterns(int position, zmatrix z);
+        void opt2GenerateAllPossibleValuePatterns(patternSink &sink);
+        // share is the part of the whole tree under the node the search is at, it goes into generationStats.covered
+        void recursiveRowSetPatternGeneration(int curRow, std::vector<int> &rowSelections, packedMatrix &selected, double share, patternSink &sink, generatorStats &stats);
+        void recursiveAllPossibleValueSet(int position, zmatrix z, double share, patternSink &sink, generatorStats &stats);
+        // Everything the optimized search carries down a branch besides the pattern
+        struct searchState {
+            columnConstraints::state columns;
+            patternSymmetry::state symmetry;
+        };
+        void optimizedAllPossibleValuePatterns(int position, zmatrix z, searchState state, double share, patternSink &sink, generatorStats &stats);
+        // The searches are split into tasks at the first 1 or 2 rows and run on a workPool
+        //  The workers hand their patterns to the sink in batches and keep their own stats, which are added up at the end
+        void parallelPossibleValueSearch(bool optimized, patternSink &sink);
+        // Sends the 928 patterns when the possible values allow anything, or the leader of each one's orbit
+        void allPatternsToSink(patternSink &sink, bool leaders);
+        struct searchPrefix {
+            zmatrix z;
+            searchState state;
+            double share;
+        };
+        void possibleValuePrefixes(int position, int splitPosition, zmatrix &z, searchState state, double share, bool prune, std::vector<searchPrefix> &prefixes, generatorStats &stats);
+        // The optimized search checks an entry against the column rules and then the symmetry order
+        //  false when the branch is cut, the cut is counted in stats
+        bool keepEntry(int row, int col, const zmatrix &z, searchState &state, generatorStats &stats);
+        columnConstraints columnRules;  // Built from possibleValues for each optimized search
+        patternSymmetry symmetryRules;  // Same, only the identity unless symmetryBreaking is set
+        // Keeps a search inside generatorBudget, only set while a budgeted search runs
+        std::shared_ptr<budgetTracker> budget;
+        void startBudget(int workers);
+        void finishBudget();
+        // Call before trying a node, true once the search has to stop
+        bool outOfBudget(generatorStats &stats) { return budget && budget->spend(stats); }
+        rowTable::rowSet rowSetCandidates(int curRow, const std::vector<int> &rowSelections);
+        void rowSetPrefixes(int curRow, int splitRow, std::vector<int> &rowSelections, double share, std::vector<std::vector<int>> &prefixes, std::vector<double> &prefixShares, generatorStats &stats);
         // T-Gate Multiplication Functions
         void leftTGateMultiply(int p, int q);
         void rightTGateMultiply(int p, int q);
@@ -159,17 +204,16 @@ class patternMatrix {
         void doLDEReduction();
         // These could be private but are public for testing
         bool rearrangeMatrix();
-        void rearrangeColumns(zmatrix patternVersion, zmatrix caseVersion, int currentColumn);
-        void rearrangeRows(zmatrix patternVersion, zmatrix caseVersion, int currentRow);
         std::string toString();
         // TODO: Add a csv output for the pattern matrix
         bool isSymmetric();
         bool isNormalized();
         bool isOrthogonal();
-        bool isRowNormalized(int row, zmatrix z);
-        bool isRowNormalized(std::vector<int> row);
-        bool areRowsOrthogonal(int row1, int row2, zmatrix z);
-        bool areRowsOrthogonal(std::vector<int> row1, std::vector<int> row2);
+        // Single row checks are lookups in the shared rowTable
+        bool isRowNormalized(int row, const zmatrix &z);
+        bool isRowNormalized(const std::vector<int> &row);
+        bool areRowsOrthogonal(int row1, int row2, const zmatrix &z);
+        bool areRowsOrthogonal(const std::vector<int> &row1, const std::vector<int> &row2);
         // bool isColNormalized(int col, zmatrix z); // Removed until it's needed
         // bool areColsOrthogonal(int col1, int col2, zmatrix z); // Removed until it's needed
 
@@ -178,11 +222,26 @@ class patternMatrix {
     
     private:
         void init();
-        void loadCases();
-        // These need to be refactored to only use 1 value as the matrix will always be a square matrix
-        int rows = 6;
-        int cols = 6;
-        int maxValue = 3;
+        // Patterns are always 6x6 with values 0-3 so these come from the packed layout
+        static constexpr int rows = packedMatrix::ROWS;
+        static constexpr int cols = packedMatrix::COLS;
+        static constexpr int maxValue = packedMatrix::MAX_VALUE;
+
+        // Cached views of p, a view is only valid while its bit is set in viewsValid
+        enum viewBit { NEW_ENCODING_VIEW = 1, TRANSPOSE_VIEW = 2, SWAP23_VIEW = 4, SWAP23T_VIEW = 8, CASE_VIEW = 16, CASE_T_VIEW = 32 };
+        const zmatrix& view(viewBit bit, zmatrix &cached) const;
+        mutable int viewsValid = 0;
+        mutable zmatrix pNewEncodingView;
+        mutable zmatrix pTView;
+        mutable zmatrix swap23View;
+        mutable zmatrix swap23TView;
+        mutable zmatrix cVView;
+        mutable zmatrix cVTView;
+        // Groupings are changed by the T-Gate operations so they aren't a view of p
+        //  They start out as every entry in its own group once a pattern is loaded and are only filled in when used
+        zmatrix groupings;
+        bool groupingsBuilt = false;
+        bool groupingsNumbered = false;
 };
 
 #endif // PATTERN_MATRIX_HPP
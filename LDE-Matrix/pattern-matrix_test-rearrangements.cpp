@@ -2,135 +2,138 @@
 #include "zmatrix.hpp"
 
 #include <gtest/gtest.h>
+#include <set>
 
-// TODO - Rearrangement Refactor + Test Overhaul
-// This is a larger test set for the rearrangement of patterns
-//  It can take a LONG time to run so it's not recommended to run this test set every time
-//  It's recommended to run this test set when the rearrangement code is being updated
-//  The base pattern matrix test does some of the easier tests for this and skips the long ones
-// Long term, this should be refactored to be more efficient and to check that the correct number of
-//  rearrangements are found
-
+// The full rearrangement set for a pattern from every case
+//  The counts are how many distinct rearrangements rearrangeMatrix finds, the search has always found these
 // These are a base test set which are guaranteed to be valid
-std::map <int, std::vector<std::string>> CASE_TO_VALID_PATTERN_MAP = {
+std::map <int, std::vector<std::pair<std::string, size_t>>> CASE_TO_VALID_PATTERN_MAP = {
     {
         -1,  // The case where the pattern is not a valid pattern
         {
-            "[0,0,0,0,0,2][0,0,0,0,2,0][0,0,0,2,0,0][0,0,2,0,0,0][0,2,0,0,0,0][2,0,0,0,0,0]",
-            "[2,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[2,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[3,1,1,1,1,1][3,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1]",
+            {"[0,0,0,0,0,2][0,0,0,0,2,0][0,0,0,2,0,0][0,0,2,0,0,0][0,2,0,0,0,0][2,0,0,0,0,0]", 0},
+            {"[2,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 0},
+            {"[2,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 0},
+            {"[3,1,1,1,1,1][3,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1]", 0},
+            // Case 2 entries that aren't fully paired
+            {"[2,3,0,0,0,0][3,2,0,0,0,0][2,2,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 0},
         }
     },
     {
         0,
         {
-            "[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1]",
+            {"[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 0},
+            {"[1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 0},
+            {"[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 0},
+            {"[1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1][1,1,1,1,1,1]", 0},
         }
     },
     {
         1, // "[1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"
         {
-            "[2,2,0,0,0,0][2,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[2,3,0,0,0,0][3,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[3,3,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[0,0,0,0,0,0][0,0,3,3,0,0][0,0,0,0,0,0][0,0,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[0,0,0,0,0,0][0,0,0,0,0,0][0,2,0,0,2,0][0,0,0,0,0,0][0,2,0,0,2,0][0,0,0,0,0,0]",
+            {"[2,2,0,0,0,0][2,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[2,3,0,0,0,0][3,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 2},
+            {"[3,3,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[0,0,0,0,0,0][0,0,3,3,0,0][0,0,0,0,0,0][0,0,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[0,0,0,0,0,0][0,0,0,0,0,0][0,2,0,0,2,0][0,0,0,0,0,0][0,2,0,0,2,0][0,0,0,0,0,0]", 1},
         }
     },
     {
         2, // "[1,1,0,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"
         {
-            "[2,2,0,0,0,0][2,2,0,0,0,0][2,2,0,0,0,0][2,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[2,3,0,0,0,0][3,2,0,0,0,0][2,2,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[3,3,0,0,0,0][3,3,0,0,0,0][3,3,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[0,0,3,0,0,3][0,0,0,0,0,0][0,0,2,0,0,2][0,0,0,0,0,0][0,0,3,0,0,3][0,0,2,0,0,2]",
+            {"[2,2,0,0,0,0][2,2,0,0,0,0][2,2,0,0,0,0][2,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[3,3,0,0,0,0][3,3,0,0,0,0][3,3,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[0,0,3,0,0,3][0,0,0,0,0,0][0,0,2,0,0,2][0,0,0,0,0,0][0,0,3,0,0,3][0,0,2,0,0,2]", 6},
             // transpose cases
-            "[2,2,2,2,0,0][2,2,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[0,0,0,0,0,0][0,0,0,0,0,0][2,0,3,0,2,3][0,0,0,0,0,0][2,0,3,0,2,3][0,0,0,0,0,0]",
+            {"[2,2,2,2,0,0][2,2,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[0,0,0,0,0,0][0,0,0,0,0,0][2,0,3,0,2,3][0,0,0,0,0,0][2,0,3,0,2,3][0,0,0,0,0,0]", 6},
         }
     },
     {
         3, // "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,1,1,0,0][1,1,1,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"
         {
-            "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[2,3,2,3,0,0][2,2,2,2,0,0][3,3,3,3,0,0][3,2,3,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[3,3,3,3,0,0][3,3,3,3,0,0][3,3,3,3,0,0][3,3,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[2,0,3,2,0,3][0,0,0,0,0,0][0,0,0,0,0,0][3,0,3,2,0,2][2,0,2,2,0,2][3,0,3,3,0,3]",
-            "[2,3,0,0,2,3][0,0,0,0,0,0][3,3,0,0,2,2][0,0,0,0,0,0][2,2,0,0,2,2][3,3,0,0,3,3]",
+            {"[2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][2,2,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[2,3,2,3,0,0][2,2,2,2,0,0][3,3,3,3,0,0][3,2,3,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 144},
+            {"[3,3,3,3,0,0][3,3,3,3,0,0][3,3,3,3,0,0][3,3,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[2,0,3,2,0,3][0,0,0,0,0,0][0,0,0,0,0,0][3,0,3,2,0,2][2,0,2,2,0,2][3,0,3,3,0,3]", 576},
+            {"[2,3,0,0,2,3][0,0,0,0,0,0][3,3,0,0,2,2][0,0,0,0,0,0][2,2,0,0,2,2][3,3,0,0,3,3]", 576},
         }
     },
     {
         4,  // "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"
         {
-            "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,0,0][2,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[2,3,2,3,0,0][3,2,2,3,0,0][2,2,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[3,3,3,3,0,0][3,3,3,3,0,0][3,3,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[2,3,0,0,2,2][3,2,0,0,0,0][0,0,0,0,0,0][3,2,0,0,0,0][0,0,0,0,0,0][2,2,0,0,3,2]",
-            "[2,0,3,0,3,2][2,0,3,0,0,0][0,0,0,0,0,0][2,0,3,0,0,0][0,0,0,0,0,0][3,0,2,0,2,2]",
+            {"[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,0,0][2,2,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[2,3,2,3,0,0][3,2,2,3,0,0][2,2,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 8},
+            {"[3,3,3,3,0,0][3,3,3,3,0,0][3,3,0,0,0,0][3,3,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[2,3,0,0,2,2][3,2,0,0,0,0][0,0,0,0,0,0][3,2,0,0,0,0][0,0,0,0,0,0][2,2,0,0,3,2]", 16},
+            {"[2,0,3,0,3,2][2,0,3,0,0,0][0,0,0,0,0,0][2,0,3,0,0,0][0,0,0,0,0,0][3,0,2,0,2,2]", 16},
         }
     },
     {
         5, // "[1,1,0,0,0,0][1,1,0,0,0,0][0,0,1,1,0,0][0,0,1,1,0,0][0,0,0,0,0,0][0,0,0,0,0,0]"
         {
-            "[2,2,0,0,0,0][2,2,0,0,0,0][0,0,2,2,0,0][0,0,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[3,3,0,0,0,0][3,3,0,0,0,0][0,0,3,3,0,0][0,0,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[2,3,0,0,0,0][0,0,3,2,0,0][0,0,0,0,0,0][3,2,0,0,0,0][0,0,0,0,0,0][0,0,2,3,0,0]",
-            "[0,0,0,0,2,3][0,0,0,0,0,0][0,0,0,0,3,2][3,2,0,0,0,0][2,3,0,0,0,0][0,0,0,0,0,0]",
+            {"[2,2,0,0,0,0][2,2,0,0,0,0][0,0,2,2,0,0][0,0,2,2,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[3,3,0,0,0,0][3,3,0,0,0,0][0,0,3,3,0,0][0,0,3,3,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[2,3,0,0,0,0][0,0,3,2,0,0][0,0,0,0,0,0][3,2,0,0,0,0][0,0,0,0,0,0][0,0,2,3,0,0]", 4},
+            {"[0,0,0,0,2,3][0,0,0,0,0,0][0,0,0,0,3,2][3,2,0,0,0,0][2,3,0,0,0,0][0,0,0,0,0,0]", 4},
         }
     },
     {
         6, // "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,0,0,1,1][1,1,0,0,1,1][0,0,0,0,0,0][0,0,0,0,0,0]"
         {
-            "[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[3,3,3,3,0,0][3,3,3,3,0,0][3,3,0,0,3,3][3,3,0,0,3,3][0,0,0,0,0,0][0,0,0,0,0,0]",
-            "[3,2,3,0,0,3][2,3,0,3,3,0][0,0,0,0,0,0][3,2,0,3,3,0][0,0,0,0,0,0][3,2,3,0,0,3]",
+            {"[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[3,3,3,3,0,0][3,3,3,3,0,0][3,3,0,0,3,3][3,3,0,0,3,3][0,0,0,0,0,0][0,0,0,0,0,0]", 1},
+            {"[3,2,3,0,0,3][2,3,0,3,3,0][0,0,0,0,0,0][3,2,0,3,3,0][0,0,0,0,0,0][3,2,3,0,0,3]", 8},
         }
     },
     {
-        // Case 7 takes ~2 minutes per pattern to run so only one pattern is included for now
         7, // "[1,1,0,0,0,0][1,1,0,0,0,0][0,0,1,1,0,0][0,0,1,1,0,0][0,0,0,0,1,1][0,0,0,0,1,1]"
         {
-            //"[2,2,0,0,0,0][2,2,0,0,0,0][0,0,2,2,0,0][0,0,2,2,0,0][0,0,0,0,2,2][0,0,0,0,2,2]",
-            //"[3,3,0,0,0,0][3,3,0,0,0,0][0,0,3,3,0,0][0,0,3,3,0,0][0,0,0,0,3,3][0,0,0,0,3,3]",
-            "[2,3,0,0,0,0][0,0,0,0,3,2][0,0,3,3,0,0][3,3,0,0,0,0][0,0,2,3,0,0][0,0,0,0,3,2]",
+            {"[2,2,0,0,0,0][2,2,0,0,0,0][0,0,2,2,0,0][0,0,2,2,0,0][0,0,0,0,2,2][0,0,0,0,2,2]", 1},
+            {"[3,3,0,0,0,0][3,3,0,0,0,0][0,0,3,3,0,0][0,0,3,3,0,0][0,0,0,0,3,3][0,0,0,0,3,3]", 1},
+            {"[2,3,0,0,0,0][0,0,0,0,3,2][0,0,3,3,0,0][3,3,0,0,0,0][0,0,2,3,0,0][0,0,0,0,3,2]", 192},
         }
     },
     {
-        // Case 8 takes ~2 minutes per pattern to run so only one pattern is included for now
         8, // "[1,1,1,1,0,0][1,1,1,1,0,0][1,1,0,0,1,1][1,1,0,0,1,1][0,0,1,1,1,1][0,0,1,1,1,1]"
         {
-            //"[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,2,2,2,2][0,0,2,2,2,2]",
-            //"[3,3,3,3,0,0][3,3,3,3,0,0][3,3,0,0,3,3][3,3,0,0,3,3][0,0,3,3,3,3][0,0,3,3,3,3]",
-            //"[3,3,0,0,3,2][3,2,3,3,0,0][0,0,2,3,3,3][3,2,3,2,0,0][0,0,3,3,2,3][2,3,0,0,3,3]",
-            "[3,3,0,0,3,2][0,0,2,3,3,3][2,3,0,0,3,3][3,2,3,2,0,0][0,0,3,3,2,3][3,2,3,3,0,0]",
+            {"[2,2,2,2,0,0][2,2,2,2,0,0][2,2,0,0,2,2][2,2,0,0,2,2][0,0,2,2,2,2][0,0,2,2,2,2]", 1},
+            {"[3,3,3,3,0,0][3,3,3,3,0,0][3,3,0,0,3,3][3,3,0,0,3,3][0,0,3,3,3,3][0,0,3,3,3,3]", 1},
+            {"[3,3,0,0,3,2][3,2,3,3,0,0][0,0,2,3,3,3][3,2,3,2,0,0][0,0,3,3,2,3][2,3,0,0,3,3]", 768},
+            {"[3,3,0,0,3,2][0,0,2,3,3,3][2,3,0,0,3,3][3,2,3,2,0,0][0,0,3,3,2,3][3,2,3,3,0,0]", 768},
         }
     },
 };
 
-// TODO - Rearrangement Refactor + Test Overhaul
 TEST(PatternMatrixTest,PatternMatrixRearrangeMatrix) {
+    const caseRegistry &cases = caseRegistry::instance();
     for (auto const& [caseNumber, patterns] : CASE_TO_VALID_PATTERN_MAP) {
-        if (caseNumber == -1 || caseNumber == 0) {
-            continue;
-        }
-        std::cout << "Case: " << caseNumber << std::endl;
-        for (auto const& pattern : patterns) {
+        for (auto const& [pattern, expected] : patterns) {
             patternMatrix pm = patternMatrix(1, pattern);
-            EXPECT_TRUE(pm.rearrangeMatrix());
-            std::cout << "Pattern: " << pattern << " has " << pm.caseRearrangements.size() << " rearrangements" << std::endl;
-            bool print = true;
-            for (auto const& pair : pm.caseRearrangements) {
-                if (!print) {
-                    break;
-                }
-                auto key = pair.first;
-                std::cout << key << std::endl;
-                print = false;
+            // Nothing to rearrange without a case and case 0 is left alone
+            if (caseNumber == -1 || caseNumber == 0) {
+                EXPECT_FALSE(pm.rearrangeMatrix()) << "Pattern: " << pattern;
+                EXPECT_EQ(pm.caseMatch, caseNumber) << "Pattern: " << pattern;
+                continue;
             }
+            EXPECT_TRUE(pm.rearrangeMatrix()) << "Pattern: " << pattern;
+            EXPECT_EQ(pm.caseMatch, caseNumber) << "Pattern: " << pattern;
+            EXPECT_EQ(pm.caseRearrangements.size(), expected) << "Pattern: " << pattern;
+            packedMatrix original = pm.p.toPacked();
+            std::set<packedMatrix> distinct;
+            for (const packedMatrix &rearranged : pm.caseRearrangements) {
+                EXPECT_EQ(rearranged.caseView(), cases.packed(caseNumber)) << "Pattern: " << pattern << " Rearrangement: " << rearranged;
+                EXPECT_EQ(rearranged.orbitCanonical(), original.orbitCanonical()) << "Pattern: " << pattern << " Rearrangement: " << rearranged;
+                distinct.insert(rearranged);
+            }
+            EXPECT_EQ(distinct.size(), pm.caseRearrangements.size()) << "Pattern: " << pattern;
+
+            // A single rearrangement is the first of the full set
+            patternMatrix single = patternMatrix(1, pattern);
+            single.singleCaseRearrangement = true;
+            EXPECT_TRUE(single.rearrangeMatrix());
+            ASSERT_EQ(single.caseRearrangements.size(), 1) << "Pattern: " << pattern;
+            EXPECT_EQ(single.caseRearrangements[0], pm.caseRearrangements[0]) << "Pattern: " << pattern;
         }
     }
 }
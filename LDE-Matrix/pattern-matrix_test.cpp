@@ -3,6 +3,7 @@
 #include "test-utils.hpp"
 
 #include <gtest/gtest.h>
+#include <set>
 
 std::string TOO_FEW_ROWS = "[0 0,0 0,0 0,0 0,0 0,0 0]";
 std::string TOO_FEW_COLUMNS = "[0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0]";
@@ -283,13 +284,13 @@ TEST(PatternMatrixTest, PatternDefaultMatrixConstructor) {
     EXPECT_EQ(pm.printCaseMatch, false);
     EXPECT_EQ(pm.printAllIDs, false);
     EXPECT_EQ(pm.p, pmz);
-    EXPECT_EQ(pm.pT, pmz);
-    EXPECT_EQ(pm.swap23, pmz);
-    EXPECT_EQ(pm.swap23T, pmz);
-    EXPECT_EQ(pm.cV, cz);
-    EXPECT_EQ(pm.cVT, cz);
+    EXPECT_EQ(pm.pT(), pmz);
+    EXPECT_EQ(pm.swap23(), pmz);
+    EXPECT_EQ(pm.swap23T(), pmz);
+    EXPECT_EQ(pm.cV(), cz);
+    EXPECT_EQ(pm.cVT(), cz);
     EXPECT_EQ(pm.originalMatrix, "[0,0,0,0,0][0,0,0,0,0][0,0,0,0,0][0,0,0,0,0][0,0,0,0,0][0,0,0,0,0]");
-    EXPECT_EQ(pm.pGroupings, groupings);
+    EXPECT_EQ(pm.pGroupings(), groupings);
 }
 
 TEST(PatternMatrixTest, PatternMatrixLoadFromString) {
@@ -301,6 +302,10 @@ TEST(PatternMatrixTest, PatternMatrixLoadFromString) {
     // TODO - add more tests to validate the pattern matrix is populated correctly for these cases
     EXPECT_NO_THROW(pm.loadFromString(VALID_BINARY_PATTERN));
     EXPECT_NO_THROW(pm.loadFromString(VALID_NUMERICAL_PATTERN));
+    // Loading only fills p, the pair counts wait until something reads them
+    EXPECT_FALSE(pm.p.hasPairCounts());
+    EXPECT_EQ(pm.p.getRowPairCounts()[0][0], 6);
+    EXPECT_TRUE(pm.p.hasPairCounts());
 }
 
 // TODO - Add a few more test cases and verify that the entire data structure is populated correctly
@@ -336,13 +341,13 @@ TEST(PatternMatrixTest,PatternMatrixStringConstructor) {
     EXPECT_EQ(pm.printCaseMatch, false);
     EXPECT_EQ(pm.printAllIDs, false);
     EXPECT_EQ(pm.originalMatrix, ALL_ZEROS_PATTERN);
-    EXPECT_EQ(pm.pGroupings, groupings);
+    EXPECT_EQ(pm.pGroupings(), groupings);
     EXPECT_TRUE(pm.p == pmz);
-    EXPECT_TRUE(pm.pT == pmz);
-    EXPECT_TRUE(pm.swap23 == pmz);
-    EXPECT_TRUE(pm.swap23T == pmz);
-    EXPECT_TRUE(pm.cV == cz);
-    EXPECT_TRUE(pm.cVT == cz);
+    EXPECT_TRUE(pm.pT() == pmz);
+    EXPECT_TRUE(pm.swap23() == pmz);
+    EXPECT_TRUE(pm.swap23T() == pmz);
+    EXPECT_TRUE(pm.cV() == cz);
+    EXPECT_TRUE(pm.cVT() == cz);
     // Make sure that the originalMatrix is converted properly
     patternMatrix pm2 = patternMatrix(1, VALID_BINARY_PATTERN);
     EXPECT_EQ(pm2.originalMatrix, VALID_BINARY_PATTERN_IN_NUMERICAL_FORM);
@@ -361,6 +366,31 @@ TEST(PatternMatrixTest,PatternMatrixNewEncodingConstructor) {
     EXPECT_EQ(pm.subCaseMatch, '-');
 }
 
+TEST(PatternMatrixTest,PatternMatrixViews) {
+    patternMatrix pm = patternMatrix(1, "[1,2,3,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]");
+    EXPECT_EQ(pm.pT().z[2][0], 3);
+    EXPECT_EQ(pm.swap23().z[0][2], 2);
+    EXPECT_EQ(pm.swap23T().z[1][0], 3);
+    EXPECT_EQ(pm.cV().z[0][1], 1);
+    EXPECT_EQ(pm.cVT().z[0][0], 0);
+    EXPECT_EQ(pm.pNewEncoding().z[0][0], 2);
+    EXPECT_EQ(pm.pGroupings().z[0][2], 3);
+
+    // The views follow p after a T-Gate changes it
+    pm.rightTGateMultiply(1,2);
+    EXPECT_EQ(pm.p.z[0][0], pm.p.z[0][1]);
+    EXPECT_EQ(pm.pT().z[0][0], pm.p.z[0][0]);
+    EXPECT_EQ(pm.pT().z[1][0], pm.p.z[0][1]);
+    EXPECT_EQ(pm.cV().z[0][0], pm.p.z[0][0] / 2);
+    EXPECT_EQ(pm.pGroupings().z[0][0], pm.pGroupings().z[0][1]);
+
+    // Loading a new pattern resets the groupings
+    pm.loadFromString("[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,1]");
+    EXPECT_EQ(pm.pGroupings().z[0][1], 2);
+    EXPECT_EQ(pm.pT().z[5][5], 1);
+    EXPECT_EQ(pm.pT().z[2][0], 0);
+}
+
 TEST(PatternMatrixTest,PatternMatrixIsTranspose) {
     patternMatrix pm1 = patternMatrix(1, "[1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]");
     patternMatrix pm2 = patternMatrix(1, "[1,0,0,0,0,0][1,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]");
@@ -464,6 +494,10 @@ TEST(PatternMatrixTest,PatternMatrixMatchOnCases) {
             patternMatrix pm = patternMatrix(1, pattern);
             pm.matchOnCases();
             EXPECT_TRUE(pm.caseMatch == caseNumber) << "Expected: " << caseNumber << " Got: " << pm.caseMatch << " with Pattern: " << pattern;
+            // The alignment lines the case view up with the case matrix
+            if (pm.caseMatch != -1) {
+                EXPECT_EQ(pm.caseAlign.apply(pm.p.toPacked()).caseView(), pm.cases.all().packed(pm.caseMatch)) << "Pattern: " << pattern;
+            }
         }
     }
 }
@@ -498,12 +532,11 @@ TEST(PatternMatrixTest,PatternMatrixRearrangeMatrixShort) {
             /*  Uncomment this to see the first rearrangement for each case
             std::cout << "Pattern: " << pattern << " has " << pm.caseRearrangements.size() << " rearrangements" << std::endl;
             bool print = true;
-            for (auto const& pair : pm.caseRearrangements) {
+            for (const packedMatrix &rearranged : pm.caseRearrangements) {
                 if (!print) {
                     break;
                 }
-                auto key = pair.first;
-                std::cout << key << std::endl;
+                std::cout << rearranged << std::endl;
                 print = false;
             }
             */
@@ -537,7 +570,7 @@ TEST(PatternMatrixTest,PatternMatrixLeftTGateMultiply) {
     pm1.printOldEncoding = true;
     std::cout << "Original Matrix: " << std::endl;
     std::cout << pm1 << std::endl;
-    patternMatrix pmR = patternMatrix(1, pm1.caseRearrangements.begin()->first);
+    patternMatrix pmR = patternMatrix(1, pm1.getFirstCaseRearrangement());
     pmR.multilineOutput = true;
     pmR.printOldEncoding = true;
     std::cout << "Rearranged Matrix: " << std::endl;
@@ -546,8 +579,8 @@ TEST(PatternMatrixTest,PatternMatrixLeftTGateMultiply) {
     std::cout << "leftTGateMultiply: " << std::endl;
     std::cout << pmR << std::endl;
     std::cout << "Groupings" << std::endl;
-    pmR.pGroupings.multilineOutput = true;
-    std::cout << pmR.pGroupings << std::endl;
+    pmR.pGroupings().multilineOutput = true;
+    std::cout << pmR.pGroupings() << std::endl;
     std::cout << "LDEs - NO FACTORING DONE" << std::endl;
     for (int i=0; i < 6; i++) {
         std::cout << "[";
@@ -568,7 +601,7 @@ TEST(PatternMatrixTest,PatternMatrixRightTGateMultiply) {
     pm1.printOldEncoding = true;
     std::cout << "Original Matrix: " << std::endl;
     std::cout << pm1 << std::endl;
-    patternMatrix pmR = patternMatrix(1, pm1.caseRearrangements.begin()->first);
+    patternMatrix pmR = patternMatrix(1, pm1.getFirstCaseRearrangement());
     pmR.multilineOutput = true;
     pmR.printOldEncoding = true;
     std::cout << "Rearranged Matrix: " << std::endl;
@@ -577,8 +610,8 @@ TEST(PatternMatrixTest,PatternMatrixRightTGateMultiply) {
     std::cout << "RightTGateMultiply: " << std::endl;
     std::cout << pmR << std::endl;
     std::cout << "Groupings" << std::endl;
-    pmR.pGroupings.multilineOutput = true;
-    std::cout << pmR.pGroupings << std::endl;
+    pmR.pGroupings().multilineOutput = true;
+    std::cout << pmR.pGroupings() << std::endl;
     std::cout << "LDEs - NO FACTORING DONE" << std::endl;
     for (int i=0; i < 6; i++) {
         std::cout << "[";
@@ -641,7 +674,228 @@ TEST(PatternMatrixTest,PatternMatrixIsOrthonormal) {
 }
 
 TEST(PatternMatrixTest,PatternMatrixGenerateAllPossibleValuePatterns) {
-    GTEST_SKIP() << "Not finished";
+    // Pattern 759 with a few extra values for the first 2 rows and the last column
+    patternMatrix pm = patternMatrix(759);
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) {
+            int v = pm.p.z[r][c];
+            pm.possibleValues[r][c] = {v};
+            if (r < 2 || c == 5) pm.possibleValues[r][c].push_back(v ^ 1);
+        }
+    }
+    std::set<std::string> generated[3];
+    for (int version = 0; version < 3; version++) {
+        pm.allPossibleValuePatterns.clear();
+        if (version == 0) pm.generateAllPossibleValuePatterns();
+        if (version == 1) pm.optimizedGenerateAllPossibleValuePatterns();
+        if (version == 2) pm.opt2GenerateAllPossibleValuePatterns();
+        for (auto const& [pattern, valid] : pm.allPossibleValuePatterns) generated[version].insert(pattern);
+    }
+    EXPECT_TRUE(generated[0].contains(pm.toString()));
+    EXPECT_GT(generated[0].size(), 1);
+    EXPECT_EQ(generated[1], generated[0]);
+    EXPECT_EQ(generated[2], generated[0]);
+
+    // Running opt2 again starts its row sets over
+    pm.allPossibleValuePatterns.clear();
+    pm.opt2GenerateAllPossibleValuePatterns();
+    EXPECT_EQ(pm.allPossibleValuePatterns.size(), generated[0].size());
+
+    // The same patterns stream out to any other sink, the map is left alone
+    for (int version = 0; version < 3; version++) {
+        for (int threads = 1; threads <= 2; threads++) {
+            pm.generatorThreads = threads;
+            std::set<std::string> streamed;
+            patternCallbackSink sink([&](const packedMatrix &pattern, uint64_t orbitSize) {
+                EXPECT_EQ(orbitSize, 1);
+                streamed.insert(pattern.toString());
+            });
+            if (version == 0) pm.generateAllPossibleValuePatterns(sink);
+            if (version == 1) pm.optimizedGenerateAllPossibleValuePatterns(sink);
+            if (version == 2) pm.opt2GenerateAllPossibleValuePatterns(sink);
+            EXPECT_EQ(streamed, generated[0]);
+            EXPECT_EQ(pm.generationStats.patterns, generated[0].size());
+            EXPECT_EQ(pm.allPossibleValuePatterns.size(), generated[0].size());
+        }
+    }
+    pm.generatorThreads = 0;
+
+    // Column pruning only cuts branches that can't finish, every leaf is either checked or counted as pruned
+    generatorStats stats[2];
+    for (int threads = 1; threads <= 2; threads++) {
+        pm.generatorThreads = threads;
+        pm.allPossibleValuePatterns.clear();
+        pm.optimizedGenerateAllPossibleValuePatterns();
+        EXPECT_EQ(pm.allPossibleValuePatterns.size(), generated[0].size());
+        stats[threads - 1] = pm.generationStats;
+    }
+    EXPECT_GT(stats[0].columnPrunedBranches, 0);
+    EXPECT_GT(stats[0].columnPrunedLeaves, 0);
+    EXPECT_LE(stats[0].leaves + stats[0].columnPrunedLeaves, uint64_t(1) << 16);
+    EXPECT_EQ(stats[1].leaves, stats[0].leaves);
+    EXPECT_EQ(stats[1].columnPrunedBranches, stats[0].columnPrunedBranches);
+    EXPECT_EQ(stats[1].columnPrunedLeaves, stats[0].columnPrunedLeaves);
+}
+
+TEST(PatternMatrixTest,PatternMatrixSymmetryBreaking) {
+    // Pattern 100 with every entry free to move inside its case value, 2048 patterns in all
+    patternMatrix pm = patternMatrix(100);
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) {
+            pm.possibleValues[r][c] = (pm.p.z[r][c] < 2) ? std::vector<int>{0, 1} : std::vector<int>{2, 3};
+        }
+    }
+    pm.optimizedGenerateAllPossibleValuePatterns();
+    std::unordered_map<std::string, bool> everything = pm.allPossibleValuePatterns;
+    ASSERT_GT(everything.size(), 1);
+
+    // Every pattern has exactly one leader and the orbit sizes add back up to all of them
+    patternSymmetry symmetry(pm.possibleValues);
+    std::map<std::string, uint64_t> leaders;
+    for (auto const& [pattern, valid] : everything) leaders[symmetry.leader(patternMatrix(0, pattern).p.toPacked()).toString()]++;
+    for (int threads = 1; threads <= 2; threads++) {
+        pm.symmetryBreaking = true;
+        pm.generatorThreads = threads;
+        pm.allPossibleValuePatterns.clear();
+        pm.optimizedGenerateAllPossibleValuePatterns();
+        EXPECT_EQ(pm.allPossibleValuePatterns.size(), leaders.size());
+        EXPECT_EQ(pm.possibleValueOrbitSizes.size(), leaders.size());
+        for (auto const& [leader, orbitSize] : leaders) EXPECT_EQ(pm.possibleValueOrbitSizes[leader], orbitSize) << leader;
+        EXPECT_GT(pm.generationStats.symmetryPrunedBranches, 0);
+        EXPECT_LT(pm.generationStats.leaves, everything.size());
+    }
+}
+
+TEST(PatternMatrixTest,PatternMatrixSymmetryBreakingEveryGenerator) {
+    // Pattern 759 with the first 2 rows free to move inside their case values, small enough for the standard search
+    patternMatrix pm = patternMatrix(759);
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) {
+            int v = pm.p.z[r][c];
+            pm.possibleValues[r][c] = (r >= 2) ? std::vector<int>{v} : (v < 2) ? std::vector<int>{0, 1} : std::vector<int>{2, 3};
+        }
+    }
+    pm.opt2GenerateAllPossibleValuePatterns();
+    std::unordered_map<std::string, bool> everything = pm.allPossibleValuePatterns;
+    patternSymmetry symmetry(pm.possibleValues);
+    ASSERT_GT(symmetry.groupSize(), 1);
+    std::map<std::string, uint64_t> leaders;
+    for (auto const& [pattern, valid] : everything) leaders[symmetry.leader(patternMatrix(0, pattern).p.toPacked()).toString()]++;
+    ASSERT_LT(leaders.size(), everything.size());
+
+    // All three keep the same leaders with the same orbit sizes
+    pm.symmetryBreaking = true;
+    for (int version = 0; version < 3; version++) {
+        for (int threads = 1; threads <= 2; threads++) {
+            pm.generatorThreads = threads;
+            if (version == 0) pm.generateAllPossibleValuePatterns();
+            if (version == 1) pm.optimizedGenerateAllPossibleValuePatterns();
+            if (version == 2) pm.opt2GenerateAllPossibleValuePatterns();
+            EXPECT_EQ(pm.allPossibleValuePatterns.size(), leaders.size()) << "Version " << version;
+            EXPECT_EQ(pm.possibleValueOrbitSizes.size(), leaders.size()) << "Version " << version;
+            for (auto const& [leader, orbitSize] : leaders) EXPECT_EQ(pm.possibleValueOrbitSizes[leader], orbitSize) << leader;
+            // opt2 cuts rows that are out of order before it gets to the leaves
+            if (version == 2) {
+                EXPECT_GT(pm.generationStats.symmetryPrunedBranches, 0);
+            }
+        }
+    }
+}
+
+TEST(PatternMatrixTest,PatternMatrixSearchBudget) {
+    // Same possible values as PatternMatrixGenerateAllPossibleValuePatterns
+    patternMatrix pm = patternMatrix(759);
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) {
+            int v = pm.p.z[r][c];
+            pm.possibleValues[r][c] = {v};
+            if (r < 2 || c == 5) pm.possibleValues[r][c].push_back(v ^ 1);
+        }
+    }
+    for (int version = 0; version < 3; version++) {
+        auto generate = [&](patternSink &sink) {
+            if (version == 0) pm.generateAllPossibleValuePatterns(sink);
+            if (version == 1) pm.optimizedGenerateAllPossibleValuePatterns(sink);
+            if (version == 2) pm.opt2GenerateAllPossibleValuePatterns(sink);
+        };
+        // Without a budget the whole tree is covered
+        std::set<std::string> everything;
+        generatorStats full[2];
+        for (int threads = 1; threads <= 2; threads++) {
+            pm.generatorThreads = threads;
+            pm.generatorBudget = searchBudget();
+            patternCallbackSink sink([&](const packedMatrix &pattern, uint64_t) { everything.insert(pattern.toString()); });
+            generate(sink);
+            full[threads - 1] = pm.generationStats;
+            EXPECT_EQ(pm.generationStats.stop, searchStop::NONE);
+            EXPECT_NEAR(pm.generationStats.covered, 1.0, 1e-9) << "Version: " << version << " Threads: " << threads;
+        }
+        ASSERT_GT(everything.size(), 1);
+        // The optimized search's prefixes check each row as soon as it's done rather than at the start of the next one
+        if (version != 1) {
+            EXPECT_EQ(full[1].nodes, full[0].nodes);
+        }
+
+        // With one thread the node and leaf limits are exact, the partial results are still valid patterns
+        pm.generatorThreads = 1;
+        for (int limit = 0; limit < 2; limit++) {
+            pm.generatorBudget = searchBudget();
+            if (limit == 0) pm.generatorBudget.maxNodes = full[0].nodes / 2;
+            if (limit == 1) pm.generatorBudget.maxLeaves = full[0].leaves / 2;
+            std::set<std::string> partial;
+            patternCallbackSink sink([&](const packedMatrix &pattern, uint64_t) { partial.insert(pattern.toString()); });
+            generate(sink);
+            EXPECT_EQ(pm.generationStats.stop, (limit == 0) ? searchStop::NODES : searchStop::LEAVES);
+            if (limit == 0) {
+                EXPECT_EQ(pm.generationStats.nodes, full[0].nodes / 2);
+            } else {
+                EXPECT_EQ(pm.generationStats.leaves, full[0].leaves / 2);
+            }
+            EXPECT_GT(pm.generationStats.covered, 0.0);
+            EXPECT_LT(pm.generationStats.covered, 1.0);
+            EXPECT_LT(partial.size(), everything.size());
+            for (auto const& pattern : partial) EXPECT_TRUE(everything.contains(pattern)) << pattern;
+        }
+
+        // Workers stop once the shared budget runs out
+        pm.generatorThreads = 2;
+        pm.generatorBudget = searchBudget();
+        pm.generatorBudget.maxNodes = full[0].nodes / 2;
+        patternCountSink counter;
+        generate(counter);
+        EXPECT_EQ(pm.generationStats.stop, searchStop::NODES);
+        EXPECT_LT(pm.generationStats.nodes, full[0].nodes);
+        EXPECT_LT(pm.generationStats.covered, 1.0);
+        EXPECT_EQ(counter.patterns, pm.generationStats.patterns);
+    }
+
+    // Every entry free inside its case value is 2^36 leaves for the standard search, the clock stops it
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) {
+            pm.possibleValues[r][c] = (pm.p.z[r][c] < 2) ? std::vector<int>{0, 1} : std::vector<int>{2, 3};
+        }
+    }
+    for (int threads = 1; threads <= 2; threads++) {
+        pm.generatorThreads = threads;
+        pm.generatorBudget = searchBudget();
+        pm.generatorBudget.maxTime = std::chrono::milliseconds(50);
+        patternCountSink counter;
+        pm.generateAllPossibleValuePatterns(counter);
+        EXPECT_EQ(pm.generationStats.stop, searchStop::TIME);
+        EXPECT_GT(pm.generationStats.nodes, 0);
+        EXPECT_LT(pm.generationStats.covered, 0.01);
+    }
+
+    // The 928 patterns count as leaves too
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) pm.possibleValues[r][c] = {0, 1, 2, 3};
+    }
+    pm.generatorBudget = searchBudget();
+    pm.generatorBudget.maxLeaves = 10;
+    pm.generateAllPossibleValuePatterns();
+    EXPECT_EQ(pm.allPossibleValuePatterns.size(), 10);
+    EXPECT_EQ(pm.generationStats.stop, searchStop::LEAVES);
+    EXPECT_NEAR(pm.generationStats.covered, 10.0 / 928, 1e-9);
 }
 
 TEST(PatternMatrixTest,PatternMatrixDoLDEReduction) {
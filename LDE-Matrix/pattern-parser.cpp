@@ -0,0 +1,90 @@
+#include "pattern-parser.hpp"
+
+#include <charconv>
+#include <format>
+#include <stdexcept>
+#include <string>
+
+static constexpr std::string_view SPACES = " \t\r";
+
+static std::string_view trim(std::string_view v) {
+    size_t first = v.find_first_not_of(SPACES);
+    if (first == std::string_view::npos) return {};
+    return v.substr(first, v.find_last_not_of(SPACES) - first + 1);
+}
+
+// A single value is either a number or one of the original "N M" pairs, -1 when it's neither
+static int tokenValue(std::string_view v) {
+    if (v.size() == 1 && v[0] >= '0' && v[0] <= '9') return v[0] - '0';
+    if (v.size() == 3 && v[1] == ' ' && (v[0] == '0' || v[0] == '1') && (v[2] == '0' || v[2] == '1')) return 2 * (v[0] - '0') + (v[2] - '0');
+    return -1;
+}
+
+static void setValue(std::string_view v, int row, int col, bool newEncoding, int maxValue, packedMatrix &pm) {
+    if (col == packedMatrix::COLS) throw std::runtime_error("Too many columns in pattern string");
+    int mv = tokenValue(v);
+    if (mv < 0 || mv > maxValue) {
+        throw std::runtime_error(std::format("Invalid value in {} string: {}", (maxValue == 1) ? "case" : "pattern", v));
+    }
+    if (newEncoding) mv = (mv == 1) ? 2 : (mv == 2) ? 1 : mv;
+    pm.set(row, col, mv);
+}
+
+// The text between [ and ] for a single row
+static void parseRow(std::string_view r, int row, bool newEncoding, int maxValue, packedMatrix &pm) {
+    if (row == packedMatrix::ROWS) throw std::runtime_error("Too many rows in pattern string");
+    int col = 0;
+    if (r.find(',') != std::string_view::npos) {
+        // Commas split the values so the pairs can keep their space
+        size_t start = 0;
+        while (true) {
+            size_t end = r.find(',', start);
+            setValue(trim(r.substr(start, end - start)), row, col++, newEncoding, maxValue, pm);
+            if (end == std::string_view::npos) break;
+            start = end + 1;
+        }
+    } else {
+        size_t start = r.find_first_not_of(SPACES);
+        while (start != std::string_view::npos) {
+            size_t end = r.find_first_of(SPACES, start);
+            setValue(r.substr(start, end - start), row, col++, newEncoding, maxValue, pm);
+            start = r.find_first_not_of(SPACES, end);
+        }
+    }
+    if (col != packedMatrix::COLS) {
+        throw std::runtime_error(std::format("Too few columns in pattern string: {} instead of {}", col, packedMatrix::COLS));
+    }
+}
+
+packedMatrix patternParser::parse(std::string_view text, bool newEncoding, int maxValue) {
+    if (text.size() == 0) throw std::runtime_error("Empty pattern string");
+    packedMatrix pm;
+    int row = 0;
+    size_t open = text.find('[');
+    while (open != std::string_view::npos) {
+        size_t next = text.find_first_of("[]", open + 1);
+        if (next == std::string_view::npos) break;
+        // Another [ first means this one only wraps rows
+        if (text[next] == ']') parseRow(text.substr(open + 1, next - open - 1), row++, newEncoding, maxValue, pm);
+        open = text.find('[', next);
+    }
+    if (row != packedMatrix::ROWS) {
+        throw std::runtime_error(std::format("Too few rows in pattern string: {} instead of {}", row, packedMatrix::ROWS));
+    }
+    return pm;
+}
+
+bool patternParser::parseLine(std::string_view line, int &id, packedMatrix &pattern, bool newEncoding) {
+    size_t start = line.find_first_not_of(SPACES);
+    if (start == std::string_view::npos || line[start] == '#') return false;
+    size_t open = line.find('[', start);
+    if (open == std::string_view::npos) open = start;
+    if (open > start) {
+        int leadingID;
+        auto [end, ec] = std::from_chars(line.data() + start, line.data() + open, leadingID);
+        if (ec == std::errc()) id = leadingID;
+    }
+    // The -detailed.txt lines go on with the patterns it was compared to after a ;
+    pattern = parse(line.substr(open, line.find(';', open) - open), newEncoding);
+    return true;
+}
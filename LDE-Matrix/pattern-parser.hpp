@@ -0,0 +1,29 @@
+#ifndef PATTERN_PARSER_HPP
+#define PATTERN_PARSER_HPP
+
+#include <string_view>
+
+#include "packed-matrix.hpp"
+
+// One parser for every layout the pattern and case files use
+//  "[0 0,0 1,...][...]"          -> the original N M pairs
+//  "[0,1,2,3,...][...]"          -> numbers, 2y + x in the new encoding
+//  "[[0 1 2 ...] [...]] LDE1only" -> space separated with extra brackets and a trailing tag
+//  "12 3 4 [0,1,...][...]"       -> id prefixed lines from deduping/
+//  "12 3 4 [...]; Transposed = [...]; Matches = ..." -> deduping/*-detailed.txt, only the first pattern is read
+// The text is read in place through a string_view so nothing is allocated unless it throws
+class patternParser {
+    public:
+        // Only the innermost brackets hold rows and anything outside of them is ignored
+        //  Values are split on commas, or on spaces when a row doesn't have any commas
+        //  newEncoding swaps 1s and 2s like the patternMatrix constructor does
+        //  maxValue is 1 for case matrices and 3 for patterns
+        static packedMatrix parse(std::string_view text, bool newEncoding = false, int maxValue = packedMatrix::MAX_VALUE);
+        // A full line from a pattern file
+        //  Returns false for blank lines and # comments
+        //  id is set from the first number before the first [ and left alone when there isn't one
+        //  Everything after the first ; is ignored
+        static bool parseLine(std::string_view line, int &id, packedMatrix &pattern, bool newEncoding = false);
+};
+
+#endif // PATTERN_PARSER_HPP
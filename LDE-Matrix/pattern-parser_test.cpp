@@ -0,0 +1,67 @@
+#include "pattern-parser.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+static const char *NUMBERS = "[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,3,3]";
+
+TEST(PatternParserTest, Layouts) {
+    packedMatrix numbers = patternParser::parse(NUMBERS);
+    EXPECT_EQ(numbers.get(3, 4), 1);
+    EXPECT_EQ(numbers.get(4, 4), 2);
+    EXPECT_EQ(numbers.get(5, 5), 3);
+    EXPECT_EQ(numbers.sum(), 14);
+
+    // Original N M pairs
+    EXPECT_EQ(patternParser::parse("[0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 0,0 0][0 0,0 0,0 0,0 0,0 1,0 1][0 0,0 0,0 0,0 1,1 0,1 0][0 0,0 0,0 0,0 1,1 1,1 1]"), numbers);
+    // New encoding swaps 1s and 2s
+    EXPECT_EQ(patternParser::parse("[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,2,2][0,0,0,2,1,1][0,0,0,2,3,3]", true), numbers);
+    // Extra brackets, spaces and a trailing tag
+    EXPECT_EQ(patternParser::parse("[[0 0 0 0 0 0] [0 0 0 0 0 0] [0 0 0 0 0 0] [0 0 0 0 1 1] [0 0 0 1 2 2] [0 0 0 1 3 3]] LDE1only"), numbers);
+    EXPECT_EQ(patternParser::parse("[[0,0,0,0,0,0],[0,0,0,0,0,0],[0,0,0,0,0,0],[0,0,0,0,1,1],[0,0,0,1,2,2],[0,0,0,1,3,3]]"), numbers);
+    // Spaces around the values are fine
+    EXPECT_EQ(patternParser::parse("[0, 0, 0, 0, 0, 0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,3, 3 ]"), numbers);
+}
+
+TEST(PatternParserTest, Lines) {
+    int id = 7;
+    packedMatrix p;
+    EXPECT_FALSE(patternParser::parseLine("", id, p));
+    EXPECT_FALSE(patternParser::parseLine("   ", id, p));
+    EXPECT_FALSE(patternParser::parseLine("# Using the new encoding: 2y + x", id, p));
+    EXPECT_EQ(id, 7);
+
+    // No id leaves it alone
+    EXPECT_TRUE(patternParser::parseLine(NUMBERS, id, p));
+    EXPECT_EQ(id, 7);
+    EXPECT_EQ(p, patternParser::parse(NUMBERS));
+
+    // deduping/ lines start with one or more ids, the first one is used
+    EXPECT_TRUE(patternParser::parseLine(std::string("352000584 ") + NUMBERS, id, p));
+    EXPECT_EQ(id, 352000584);
+    EXPECT_TRUE(patternParser::parseLine(std::string("3 2 2 ") + NUMBERS + "\r", id, p));
+    EXPECT_EQ(id, 3);
+    EXPECT_EQ(p, patternParser::parse(NUMBERS));
+
+    // -detailed.txt lines only use the pattern before the first ;
+    std::string transposed = "[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,1,1,1][0,0,0,1,2,3][0,0,0,1,2,3]";
+    EXPECT_TRUE(patternParser::parseLine(std::string("5 3 3 ") + NUMBERS + "; Transposed = " + transposed + "; Matches = 177 0 0 " + transposed, id, p));
+    EXPECT_EQ(id, 5);
+    EXPECT_EQ(p, patternParser::parse(NUMBERS));
+}
+
+TEST(PatternParserTest, Errors) {
+    EXPECT_THROW(patternParser::parse(""), std::runtime_error);
+    EXPECT_THROW(patternParser::parse("LDE1only"), std::runtime_error);
+    EXPECT_THROW(patternParser::parse("[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2]"), std::runtime_error);
+    EXPECT_THROW(patternParser::parse("[0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2][0,0,0,0,0,0]"), std::runtime_error);
+    EXPECT_THROW(patternParser::parse("[0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]"), std::runtime_error);
+    EXPECT_THROW(patternParser::parse("[0,0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]"), std::runtime_error);
+    EXPECT_THROW(patternParser::parse("[0,0,0,0,0,4][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]"), std::runtime_error);
+    EXPECT_THROW(patternParser::parse("[0,0,,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]"), std::runtime_error);
+    EXPECT_THROW(patternParser::parse("[0,0,x,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]"), std::runtime_error);
+    EXPECT_THROW(patternParser::parse("[0 2,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,1,1][0,0,0,1,2,2][0,0,0,1,2,2]"), std::runtime_error);
+    // Cases only hold 0s and 1s
+    EXPECT_NO_THROW(patternParser::parse("[1,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", false, 1));
+    EXPECT_THROW(patternParser::parse("[2,1,0,0,0,0][1,1,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0][0,0,0,0,0,0]", false, 1), std::runtime_error);
+}
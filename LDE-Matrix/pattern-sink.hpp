@@ -0,0 +1,75 @@
+#ifndef PATTERN_SINK_HPP
+#define PATTERN_SINK_HPP
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "packed-matrix.hpp"
+
+// Where the *GenerateAllPossibleValuePatterns searches send the valid patterns as they find them
+//  add is only ever called from one thread at a time, even when the search runs on a workPool
+//  A search on a workPool hands each worker's patterns over in batches, so they don't come in search order
+//  orbitSize is 1 unless the search only sends the leader of each orbit (patternMatrix::symmetryBreaking)
+class patternSink {
+    public:
+        virtual ~patternSink() = default;
+        virtual void add(const packedMatrix &pattern, uint64_t orbitSize) = 0;
+};
+
+// Keeps every pattern as a string, this is how allPossibleValuePatterns is filled
+//  The orbit sizes are only kept when there's a map for them
+class patternMapSink : public patternSink {
+    public:
+        explicit patternMapSink(std::unordered_map<std::string, bool> &patterns, std::unordered_map<std::string, uint64_t> *orbitSizes = nullptr)
+            : patterns(patterns), orbitSizes(orbitSizes) {}
+        void add(const packedMatrix &pattern, uint64_t orbitSize) override {
+            std::string key = pattern.toString();
+            patterns[key] = true;
+            if (orbitSizes != nullptr) (*orbitSizes)[key] = orbitSize;
+        }
+
+    private:
+        std::unordered_map<std::string, bool> &patterns;
+        std::unordered_map<std::string, uint64_t> *orbitSizes;
+};
+
+// Only counts, orbitPatterns adds up the orbit sizes so it's the same with or without symmetry breaking
+class patternCountSink : public patternSink {
+    public:
+        uint64_t patterns = 0;
+        uint64_t orbitPatterns = 0;
+        void add(const packedMatrix &, uint64_t orbitSize) override {
+            patterns++;
+            orbitPatterns += orbitSize;
+        }
+};
+
+// One pattern a line, the orbit size follows it when it isn't 1
+class patternStreamSink : public patternSink {
+    public:
+        explicit patternStreamSink(std::ostream &os) : os(os) {}
+        void add(const packedMatrix &pattern, uint64_t orbitSize) override {
+            os << pattern;
+            if (orbitSize != 1) os << " " << orbitSize;
+            os << "\n";
+        }
+
+    private:
+        std::ostream &os;
+};
+
+// Hands every pattern to a function
+class patternCallbackSink : public patternSink {
+    public:
+        explicit patternCallbackSink(std::function<void(const packedMatrix &, uint64_t)> callback) : callback(std::move(callback)) {}
+        void add(const packedMatrix &pattern, uint64_t orbitSize) override { callback(pattern, orbitSize); }
+
+    private:
+        std::function<void(const packedMatrix &, uint64_t)> callback;
+};
+
+#endif // PATTERN_SINK_HPP
@@ -0,0 +1,48 @@
+#include "pattern-sink.hpp"
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+
+static packedMatrix diagonal(int value) {
+    packedMatrix pm;
+    for (int i = 0; i < 6; i++) pm.set(i, i, value);
+    return pm;
+}
+
+TEST(PatternSinkTest, Map) {
+    std::unordered_map<std::string, bool> patterns;
+    patternMapSink plain(patterns);
+    plain.add(diagonal(2), 1);
+    plain.add(diagonal(2), 1);
+    plain.add(diagonal(3), 1);
+    EXPECT_EQ(patterns.size(), 2);
+    EXPECT_TRUE(patterns.contains(diagonal(2).toString()));
+
+    std::unordered_map<std::string, uint64_t> orbitSizes;
+    patternMapSink withOrbits(patterns, &orbitSizes);
+    withOrbits.add(diagonal(1), 720);
+    EXPECT_EQ(patterns.size(), 3);
+    EXPECT_EQ(orbitSizes.size(), 1);
+    EXPECT_EQ(orbitSizes[diagonal(1).toString()], 720);
+}
+
+TEST(PatternSinkTest, CountStreamCallback) {
+    patternCountSink count;
+    count.add(diagonal(2), 1);
+    count.add(diagonal(3), 4);
+    EXPECT_EQ(count.patterns, 2);
+    EXPECT_EQ(count.orbitPatterns, 5);
+
+    std::ostringstream os;
+    patternStreamSink stream(os);
+    stream.add(diagonal(2), 1);
+    stream.add(diagonal(3), 4);
+    EXPECT_EQ(os.str(), diagonal(2).toString() + "\n" + diagonal(3).toString() + " 4\n");
+
+    std::vector<packedMatrix> seen;
+    patternCallbackSink callback([&](const packedMatrix &pattern, uint64_t) { seen.push_back(pattern); });
+    callback.add(diagonal(1), 1);
+    ASSERT_EQ(seen.size(), 1);
+    EXPECT_EQ(seen[0], diagonal(1));
+}
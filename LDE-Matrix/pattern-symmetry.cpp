@@ -0,0 +1,232 @@
+#include "pattern-symmetry.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+static std::vector<int> sortedValues(const std::vector<int> &values) {
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    return sorted;
+}
+
+static uint64_t factorial(int n) {
+    uint64_t f = 1;
+    for (int i = 2; i <= n; i++) f *= i;
+    return f;
+}
+
+// Splits 0-5 into groups, first[i] is the first index equal to i
+static void buildClasses(const std::array<int, patternSymmetry::SIZE> &first, std::vector<std::vector<int>> &classes, std::array<int, patternSymmetry::SIZE> &previous) {
+    classes.clear();
+    std::array<int, patternSymmetry::SIZE> classOf;
+    for (int i = 0; i < patternSymmetry::SIZE; i++) {
+        if (first[i] == i) {
+            classOf[i] = classes.size();
+            classes.push_back({i});
+            previous[i] = -1;
+        } else {
+            classOf[i] = classOf[first[i]];
+            previous[i] = classes[classOf[i]].back();
+            classes[classOf[i]].push_back(i);
+        }
+    }
+}
+
+patternSymmetry::patternSymmetry() {
+    std::array<int, SIZE> first;
+    for (int i = 0; i < SIZE; i++) first[i] = i;
+    buildClasses(first, rowClasses, rowPrevious);
+    buildClasses(first, colClasses, colPrevious);
+}
+
+patternSymmetry::patternSymmetry(const std::vector<std::vector<std::vector<int>>> &possibleValues) {
+    if (possibleValues.size() != SIZE) throw std::runtime_error("Pattern symmetry needs 6 rows of possible values");
+    std::vector<std::vector<std::vector<int>>> pv(SIZE);
+    for (int r = 0; r < SIZE; r++) {
+        if (possibleValues[r].size() != SIZE) throw std::runtime_error("Pattern symmetry needs 6 columns of possible values");
+        for (int c = 0; c < SIZE; c++) pv[r].push_back(sortedValues(possibleValues[r][c]));
+    }
+    std::array<int, SIZE> firstRow;
+    std::array<int, SIZE> firstCol;
+    for (int i = 0; i < SIZE; i++) {
+        firstRow[i] = i;
+        firstCol[i] = i;
+        for (int j = 0; j < i && firstRow[i] == i; j++) {
+            bool same = true;
+            for (int c = 0; c < SIZE && same; c++) same = pv[i][c] == pv[j][c];
+            if (same) firstRow[i] = j;
+        }
+        for (int j = 0; j < i && firstCol[i] == i; j++) {
+            bool same = true;
+            for (int r = 0; r < SIZE && same; r++) same = pv[r][i] == pv[r][j];
+            if (same) firstCol[i] = j;
+        }
+    }
+    buildClasses(firstRow, rowClasses, rowPrevious);
+    buildClasses(firstCol, colClasses, colPrevious);
+
+    canTranspose = true;
+    bool closed = true;
+    bool anyPairs = false;
+    for (int r = 0; r < SIZE; r++) {
+        for (int c = 0; c < SIZE; c++) {
+            if (pv[r][c] != pv[c][r]) canTranspose = false;
+            bool has2 = std::binary_search(pv[r][c].begin(), pv[r][c].end(), 2);
+            bool has3 = std::binary_search(pv[r][c].begin(), pv[r][c].end(), 3);
+            if (has2 != has3) closed = false;
+            if (has2 && has3) anyPairs = true;
+        }
+    }
+    // Without any 2s or 3s the swap doesn't change anything and would only count every pattern twice
+    canSwap23 = closed && anyPairs;
+}
+
+patternSymmetry::state patternSymmetry::start() const {
+    state s;
+    for (int c = 0; c < SIZE; c++) {
+        if (colPrevious[c] >= 0) s.columnsTied |= 1 << c;
+    }
+    return s;
+}
+
+bool patternSymmetry::add(state &s, int row, int col, const std::vector<std::vector<int>> &z) const {
+    if (col == 0) s.rowTied = rowPrevious[row] >= 0;
+    int value = z[row][col];
+    if (s.rowTied) {
+        int above = z[rowPrevious[row]][col];
+        if (value < above) return false;
+        if (value > above) s.rowTied = false;
+    }
+    if ((s.columnsTied >> col) & 1) {
+        int left = z[row][colPrevious[col]];
+        if (value < left) return false;
+        if (value > left) s.columnsTied &= ~(1 << col);
+    }
+    return true;
+}
+
+bool patternSymmetry::rowInOrder(const packedMatrix &pattern, int row) const {
+    int above = rowPrevious[row];
+    if (above < 0) return true;
+    for (int c = 0; c < SIZE; c++) {
+        int value = pattern.get(row, c);
+        int aboveValue = pattern.get(above, c);
+        if (value != aboveValue) return value > aboveValue;
+    }
+    return true;
+}
+
+uint64_t patternSymmetry::groupSize() const {
+    uint64_t size = 1;
+    for (const auto &rows : rowClasses) size *= factorial(rows.size());
+    for (const auto &cols : colClasses) size *= factorial(cols.size());
+    if (canTranspose) size *= 2;
+    if (canSwap23) size *= 2;
+    return size;
+}
+
+// Each row as a 12-bit value with the first column in the highest bits
+//  Comparing the arrays compares the patterns row by row
+using rowKeys = std::array<uint16_t, patternSymmetry::SIZE>;
+
+static rowKeys toRowKeys(const packedMatrix &pm) {
+    rowKeys keys;
+    for (int r = 0; r < patternSymmetry::SIZE; r++) {
+        keys[r] = 0;
+        for (int c = 0; c < patternSymmetry::SIZE; c++) keys[r] = keys[r] << 2 | pm.get(r, c);
+    }
+    return keys;
+}
+
+// Every group is permuted on its own like the digits of an odometer
+static bool nextClassPermutation(std::vector<std::vector<int>> &assigned) {
+    for (int k = assigned.size() - 1; k >= 0; k--) {
+        if (std::next_permutation(assigned[k].begin(), assigned[k].end())) return true;
+    }
+    return false;
+}
+
+bool patternSymmetry::scan(const packedMatrix &pattern, bool stopBelow, packedMatrix &best, uint64_t &stabilizer) const {
+    std::vector<packedMatrix> variants = {pattern};
+    if (canTranspose) variants.push_back(pattern.transposed());
+    if (canSwap23) {
+        variants.push_back(pattern.swapped23());
+        if (canTranspose) variants.push_back(pattern.swapped23().transposed());
+    }
+    rowKeys bestKeys = toRowKeys(pattern);
+    bool haveBest = stopBelow;
+    stabilizer = 0;
+
+    for (const packedMatrix &variant : variants) {
+        // Every row order that only moves rows inside their groups
+        std::vector<std::vector<int>> assigned = rowClasses;
+        do {
+            std::array<int, SIZE> rowOrder;
+            for (size_t k = 0; k < rowClasses.size(); k++) {
+                for (size_t i = 0; i < rowClasses[k].size(); i++) rowOrder[rowClasses[k][i]] = assigned[k][i];
+            }
+            // Column contents with the first row in the highest bits
+            //  Sorting them inside each group is the smallest column order for this row order
+            std::array<uint16_t, SIZE> colKeys;
+            for (int c = 0; c < SIZE; c++) {
+                colKeys[c] = 0;
+                for (int r = 0; r < SIZE; r++) colKeys[c] = colKeys[c] << 2 | variant.get(rowOrder[r], c);
+            }
+            std::array<uint16_t, SIZE> image;
+            uint64_t ways = 1;
+            for (const auto &cols : colClasses) {
+                std::vector<uint16_t> sorted;
+                for (int c : cols) sorted.push_back(colKeys[c]);
+                std::sort(sorted.begin(), sorted.end());
+                int run = 1;
+                for (size_t i = 0; i < sorted.size(); i++) {
+                    image[cols[i]] = sorted[i];
+                    run = (i > 0 && sorted[i] == sorted[i-1]) ? run + 1 : 1;
+                    ways *= run;
+                }
+            }
+            rowKeys keys;
+            for (int r = 0; r < SIZE; r++) {
+                keys[r] = 0;
+                for (int c = 0; c < SIZE; c++) keys[r] = keys[r] << 2 | ((image[c] >> (2 * (SIZE-1-r))) & 3);
+            }
+            if (!haveBest || keys < bestKeys) {
+                if (stopBelow) return false;
+                bestKeys = keys;
+                haveBest = true;
+                stabilizer = ways;
+            } else if (keys == bestKeys) {
+                stabilizer += ways;
+            }
+        } while (nextClassPermutation(assigned));
+    }
+
+    best = packedMatrix();
+    for (int r = 0; r < SIZE; r++) {
+        for (int c = 0; c < SIZE; c++) best.set(r, c, (bestKeys[r] >> (2 * (SIZE-1-c))) & 3);
+    }
+    return true;
+}
+
+bool patternSymmetry::isLeader(const packedMatrix &pattern, uint64_t &orbitSize) const {
+    packedMatrix best;
+    uint64_t stabilizer;
+    if (!scan(pattern, true, best, stabilizer)) return false;
+    orbitSize = groupSize() / stabilizer;
+    return true;
+}
+
+packedMatrix patternSymmetry::leader(const packedMatrix &pattern) const {
+    packedMatrix best;
+    uint64_t stabilizer;
+    scan(pattern, false, best, stabilizer);
+    return best;
+}
+
+uint64_t patternSymmetry::orbitSize(const packedMatrix &pattern) const {
+    packedMatrix best;
+    uint64_t stabilizer;
+    scan(pattern, false, best, stabilizer);
+    return groupSize() / stabilizer;
+}
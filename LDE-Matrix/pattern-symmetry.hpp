@@ -0,0 +1,64 @@
+#ifndef PATTERN_SYMMETRY_HPP
+#define PATTERN_SYMMETRY_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "packed-matrix.hpp"
+
+// The rearrangements, transpose and 2/3 swap that leave a possible value matrix the same
+//  Any of them maps a pattern from the possible values onto another pattern from the possible values
+//  so a search only has to find one pattern of each orbit
+// The group is built from what the possible values allow on their own:
+//  rows with identical possible values can be rearranged, columns the same
+//  the transpose when possibleValues[i][j] == possibleValues[j][i] everywhere
+//  the 2/3 swap when every set of possible values has both or neither of 2 and 3, and some have both
+// The pattern kept for an orbit is its leader, the smallest pattern read row by row
+//  The leader has every row <= the next row with the same possible values and every column <= the next column the same way
+//  so a search can cut anything that breaks that order as it goes
+class patternSymmetry {
+    public:
+        static constexpr int SIZE = 6;
+
+        struct state {
+            bool rowTied = false;  // The row so far is equal to the row before it with the same possible values
+            uint8_t columnsTied = 0;  // Bit c -> column c so far is equal to the column before it with the same possible values
+        };
+
+        patternSymmetry();  // Only the identity
+        explicit patternSymmetry(const std::vector<std::vector<std::vector<int>>> &possibleValues);
+
+        state start() const;
+        // Sets [row][col] = z[row][col] into the state, false when the pattern can no longer be a leader
+        //  Every entry before [row][col], row by row, has to be set already
+        bool add(state &s, int row, int col, const std::vector<std::vector<int>> &z) const;
+        // Same check for a whole row, false when row is below the row before it with the same possible values
+        //  Every row before it has to be set already
+        bool rowInOrder(const packedMatrix &pattern, int row) const;
+        // True when the pattern is the leader of its orbit, orbitSize is only set then
+        bool isLeader(const packedMatrix &pattern, uint64_t &orbitSize) const;
+        packedMatrix leader(const packedMatrix &pattern) const;
+        uint64_t orbitSize(const packedMatrix &pattern) const;
+
+        uint64_t groupSize() const;
+        bool transposable() const { return canTranspose; }
+        bool swappable() const { return canSwap23; }
+
+    private:
+        // Groups of rows / columns with identical possible values, each group in increasing order
+        std::vector<std::vector<int>> rowClasses;
+        std::vector<std::vector<int>> colClasses;
+        // The row / column before this one in its group, -1 for the first
+        std::array<int, SIZE> rowPrevious;
+        std::array<int, SIZE> colPrevious;
+        bool canTranspose = false;
+        bool canSwap23 = false;
+
+        // Goes over every image of the pattern that has its columns sorted inside their groups
+        //  best ends up as the smallest one and stabilizer as the number of group elements that map the pattern onto it
+        //  With stopBelow set, best starts as the pattern and the scan gives up as soon as something smaller turns up
+        bool scan(const packedMatrix &pattern, bool stopBelow, packedMatrix &best, uint64_t &stabilizer) const;
+};
+
+#endif // PATTERN_SYMMETRY_HPP
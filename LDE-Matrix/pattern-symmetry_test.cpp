@@ -0,0 +1,116 @@
+#include "pattern-symmetry.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+
+using possibleValueGrid = std::vector<std::vector<std::vector<int>>>;
+
+static possibleValueGrid everyEntry(std::vector<int> values) {
+    return possibleValueGrid(6, std::vector<std::vector<int>>(6, values));
+}
+
+// Rows / columns with the same label get the same possible values, labels 0 0 1 2 3 3
+//  The sets only depend on the sum of the labels so the grid is symmetric and they all keep 2 and 3 together
+static possibleValueGrid labeledGrid() {
+    const std::vector<std::vector<int>> SETS = {{0}, {1}, {2, 3}, {0, 1}, {0, 2, 3}, {1, 2, 3}, {0, 1, 2, 3}};
+    const int LABELS[6] = {0, 0, 1, 2, 3, 3};
+    possibleValueGrid pv(6, std::vector<std::vector<int>>(6));
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) pv[r][c] = SETS[LABELS[r] + LABELS[c]];
+    }
+    return pv;
+}
+
+static std::array<int, 36> rowByRow(const packedMatrix &pm) {
+    std::array<int, 36> values;
+    for (int i = 0; i < 36; i++) values[i] = pm.get(i / 6, i % 6);
+    return values;
+}
+
+TEST(PatternSymmetryTest, Group) {
+    EXPECT_EQ(patternSymmetry().groupSize(), 1);
+    patternSymmetry binary(everyEntry({1, 0}));
+    EXPECT_TRUE(binary.transposable());
+    EXPECT_FALSE(binary.swappable());
+    EXPECT_EQ(binary.groupSize(), 720 * 720 * 2);
+    EXPECT_EQ(patternSymmetry(everyEntry({0, 1, 2, 3})).groupSize(), 720 * 720 * 4);
+
+    patternSymmetry labeled(labeledGrid());
+    EXPECT_TRUE(labeled.transposable());
+    EXPECT_TRUE(labeled.swappable());
+    EXPECT_EQ(labeled.groupSize(), 2 * 2 * 2 * 2 * 2 * 2);
+
+    // Changing one entry splits its row and column off and breaks the transpose
+    possibleValueGrid pv = labeledGrid();
+    pv[0][5] = {0};
+    patternSymmetry broken(pv);
+    EXPECT_FALSE(broken.transposable());
+    EXPECT_TRUE(broken.swappable());
+    EXPECT_EQ(broken.groupSize(), 2 * 2 * 2);
+
+    EXPECT_THROW(patternSymmetry(possibleValueGrid(5, std::vector<std::vector<int>>(6, {0}))), std::runtime_error);
+}
+
+TEST(PatternSymmetryTest, Add) {
+    patternSymmetry binary(everyEntry({0, 1}));
+    std::vector<std::vector<int>> z(6, std::vector<int>(6, 0));
+    z[0] = {0, 0, 0, 1, 1, 1};
+    z[1] = {0, 0, 1, 1, 1, 0};
+    patternSymmetry::state s = binary.start();
+    for (int c = 0; c < 6; c++) EXPECT_TRUE(binary.add(s, 0, c, z));
+    // Row 1 is bigger than row 0 but column 5 drops below column 4
+    for (int c = 0; c < 5; c++) EXPECT_TRUE(binary.add(s, 1, c, z));
+    EXPECT_FALSE(binary.add(s, 1, 5, z));
+
+    // A row below the one before it is cut at the first entry that's smaller
+    z[1] = {0, 0, 0, 0, 1, 1};
+    s = binary.start();
+    for (int c = 0; c < 6; c++) EXPECT_TRUE(binary.add(s, 0, c, z));
+    EXPECT_TRUE(binary.add(s, 1, 0, z));
+    EXPECT_TRUE(binary.add(s, 1, 1, z));
+    EXPECT_TRUE(binary.add(s, 1, 2, z));
+    EXPECT_FALSE(binary.add(s, 1, 3, z));
+
+    // Nothing is cut with only the identity
+    patternSymmetry identity;
+    s = identity.start();
+    for (int c = 0; c < 6; c++) EXPECT_TRUE(identity.add(s, 1, c, z));
+}
+
+// Every one of the 64 group elements is applied by hand and the results are compared with the scan
+TEST(PatternSymmetryTest, Orbits) {
+    patternSymmetry labeled(labeledGrid());
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    auto next = [&seed]() {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        return seed;
+    };
+    for (int round = 0; round < 200; round++) {
+        packedMatrix pattern;
+        // Some rounds use only 0s and 1s so the stabilizers aren't always trivial
+        for (int i = 0; i < 36; i++) pattern.set(i / 6, i % 6, next() % ((round % 2 == 0) ? 4 : 2));
+        std::set<std::array<int, 36>> orbit;
+        for (int element = 0; element < 64; element++) {
+            packedMatrix image = pattern;
+            if (element & 1) image = image.transposed();
+            if (element & 2) image = image.swapped23();
+            std::array<int, 6> rowOrder = {0, 1, 2, 3, 4, 5};
+            std::array<int, 6> colOrder = {0, 1, 2, 3, 4, 5};
+            if (element & 4) std::swap(rowOrder[0], rowOrder[1]);
+            if (element & 8) std::swap(rowOrder[4], rowOrder[5]);
+            if (element & 16) std::swap(colOrder[0], colOrder[1]);
+            if (element & 32) std::swap(colOrder[4], colOrder[5]);
+            orbit.insert(rowByRow(image.permuted(rowOrder, colOrder)));
+        }
+        packedMatrix leader = labeled.leader(pattern);
+        EXPECT_EQ(rowByRow(leader), *orbit.begin());
+        EXPECT_EQ(labeled.orbitSize(pattern), orbit.size());
+        uint64_t orbitSize = 0;
+        EXPECT_TRUE(labeled.isLeader(leader, orbitSize));
+        EXPECT_EQ(orbitSize, orbit.size());
+        EXPECT_EQ(labeled.isLeader(pattern, orbitSize), rowByRow(pattern) == *orbit.begin());
+    }
+}
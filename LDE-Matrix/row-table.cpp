@@ -0,0 +1,8 @@
+#include "row-table.hpp"
+
+// Worked out by the compiler, nothing runs at startup
+static constinit const rowTable TABLE = rowTable::build();
+
+const rowTable& rowTable::instance() {
+    return TABLE;
+}
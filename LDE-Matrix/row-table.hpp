@@ -0,0 +1,90 @@
+#ifndef ROW_TABLE_HPP
+#define ROW_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#include "packed-matrix.hpp"
+
+// Every possible pattern row, there are only 4^6 = 4096 of them
+//  Rows are indexed by their 12-bit code, N slice in the low 6 bits and M slice in the high 6 bits like packedMatrix::rowCode
+//  The 512 normalized rows also get a dense index from 0-511 in code order so sets of them fit in 8 words
+// The table is built at compile time and lives in read-only data, so every thread can share it without any locking
+class rowTable {
+    public:
+        static constexpr int ROW_CODES = 1 << (2 * packedMatrix::COLS);
+        static constexpr int NORMALIZED_ROWS = 512;
+        static constexpr int WORDS = NORMALIZED_ROWS / 64;
+        // Bit k of the set -> normalized row k
+        using rowSet = std::array<uint64_t, WORDS>;
+
+        static const rowTable& instance();
+
+        static constexpr int code(uint64_t n, uint64_t m) { return int(n | (m << packedMatrix::COLS)); }
+
+        constexpr bool isNormalized(int rowCode) const { return normalizedIndex[rowCode] >= 0; }
+        // Dense index of a normalized row, -1 for the rest
+        constexpr int index(int rowCode) const { return normalizedIndex[rowCode]; }
+        constexpr int rowCode(int index) const { return normalizedCodes[index]; }
+        // The normalized rows orthogonal to normalized row index
+        //  Every normalized row is orthogonal to itself, so its own bit is always set
+        constexpr const rowSet& orthogonalTo(int index) const { return orthogonal[index]; }
+        // Any two rows, the table answers for normalized rows and the packedMatrix kernel for the rest
+        constexpr bool areOrthogonal(int rowCode1, int rowCode2) const {
+            int i = normalizedIndex[rowCode1];
+            int j = normalizedIndex[rowCode2];
+            if (i >= 0 && j >= 0) return (orthogonal[i][j / 64] >> (j % 64)) & 1;
+            return packedMatrix::areRowsOrthogonal(rowCode1 & packedMatrix::ROW_MASK, rowCode1 >> packedMatrix::COLS,
+                                                   rowCode2 & packedMatrix::ROW_MASK, rowCode2 >> packedMatrix::COLS);
+        }
+
+        static constexpr rowTable build();
+
+    private:
+        std::array<int16_t, ROW_CODES> normalizedIndex{};
+        std::array<int16_t, NORMALIZED_ROWS> normalizedCodes{};
+        std::array<rowSet, NORMALIZED_ROWS> orthogonal{};
+};
+
+constexpr rowTable rowTable::build() {
+    rowTable table;
+    int count = 0;
+    for (int c = 0; c < ROW_CODES; c++) {
+        table.normalizedIndex[c] = -1;
+        if (!packedMatrix::isRowNormalized(c & packedMatrix::ROW_MASK, c >> packedMatrix::COLS)) continue;
+        if (count == NORMALIZED_ROWS) throw std::runtime_error("More normalized rows than NORMALIZED_ROWS");
+        table.normalizedIndex[c] = int16_t(count);
+        table.normalizedCodes[count] = int16_t(c);
+        count++;
+    }
+    if (count != NORMALIZED_ROWS) throw std::runtime_error("Fewer normalized rows than NORMALIZED_ROWS");
+    // Rule iii is the parity of N1 & N2
+    //  Rule iv counts the entries that are nonzero in both rows minus the ones that hold the same nonzero value,
+    //  so its parity is the parity of key1 & key2 where the key has a 6-bit slice for "nonzero" and one each for 1, 2 and 3
+    // Both parities are linear in the other row's bits, so row i's odd set is the XOR of one bit plane
+    //  (the rows with that key bit set) for every key bit row i has, no pair is ever checked on its own
+    constexpr int KEY_BITS = 5 * packedMatrix::COLS;
+    std::array<uint64_t, NORMALIZED_ROWS> keys{};
+    std::array<rowSet, KEY_BITS> planes{};
+    for (int i = 0; i < NORMALIZED_ROWS; i++) {
+        packedMatrix row(table.normalizedCodes[i] & packedMatrix::ROW_MASK, table.normalizedCodes[i] >> packedMatrix::COLS);
+        keys[i] = row.nBits | ((row.nBits | row.mBits) << 6) | (row.valueMask(1) << 12) | (row.valueMask(2) << 18) | (row.valueMask(3) << 24);
+        for (int bit = 0; bit < KEY_BITS; bit++) {
+            if ((keys[i] >> bit) & 1) planes[bit][i / 64] |= uint64_t(1) << (i % 64);
+        }
+    }
+    for (int i = 0; i < NORMALIZED_ROWS; i++) {
+        rowSet oddDot{};
+        rowSet oddPairs{};
+        for (int bit = 0; bit < KEY_BITS; bit++) {
+            if (((keys[i] >> bit) & 1) == 0) continue;
+            rowSet &odd = (bit < packedMatrix::COLS) ? oddDot : oddPairs;
+            for (int w = 0; w < WORDS; w++) odd[w] ^= planes[bit][w];
+        }
+        for (int w = 0; w < WORDS; w++) table.orthogonal[i][w] = ~(oddDot[w] | oddPairs[w]);
+    }
+    return table;
+}
+
+#endif // ROW_TABLE_HPP
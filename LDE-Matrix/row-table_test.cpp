@@ -0,0 +1,48 @@
+#include "row-table.hpp"
+
+#include <gtest/gtest.h>
+
+// The table has to agree with the packedMatrix kernels for every row and every pair of normalized rows
+TEST(RowTableTest, MatchesKernels) {
+    const rowTable &table = rowTable::instance();
+    int normalized = 0;
+    for (int c = 0; c < rowTable::ROW_CODES; c++) {
+        uint64_t n = c & packedMatrix::ROW_MASK;
+        uint64_t m = c >> packedMatrix::COLS;
+        ASSERT_EQ(table.isNormalized(c), packedMatrix::isRowNormalized(n, m)) << "Row " << c;
+        if (!table.isNormalized(c)) {
+            EXPECT_EQ(table.index(c), -1);
+            continue;
+        }
+        EXPECT_EQ(table.index(c), normalized);
+        EXPECT_EQ(table.rowCode(normalized), c);
+        normalized++;
+    }
+    EXPECT_EQ(normalized, rowTable::NORMALIZED_ROWS);
+
+    for (int i = 0; i < rowTable::NORMALIZED_ROWS; i++) {
+        int c1 = table.rowCode(i);
+        for (int j = 0; j < rowTable::NORMALIZED_ROWS; j++) {
+            int c2 = table.rowCode(j);
+            bool orthogonal = packedMatrix::areRowsOrthogonal(c1 & packedMatrix::ROW_MASK, c1 >> packedMatrix::COLS, c2 & packedMatrix::ROW_MASK, c2 >> packedMatrix::COLS);
+            ASSERT_EQ((table.orthogonalTo(i)[j / 64] >> (j % 64)) & 1, orthogonal) << "Rows " << c1 << " and " << c2;
+            ASSERT_EQ(table.areOrthogonal(c1, c2), orthogonal);
+        }
+    }
+}
+
+TEST(RowTableTest, Rows) {
+    const rowTable &table = rowTable::instance();
+    // [0,0,0,0,1,1] and [0,0,0,1,2,2] from the packedMatrix orthonormality test
+    int row3 = rowTable::code(0b000000, 0b110000);
+    int row4 = rowTable::code(0b110000, 0b001000);
+    EXPECT_TRUE(table.isNormalized(row3));
+    EXPECT_TRUE(table.isNormalized(row4));
+    EXPECT_TRUE(table.areOrthogonal(row3, row4));
+    // A lone 3 isn't normalized but the kernel still answers for it
+    int three = rowTable::code(0b110000, 0b011000);
+    EXPECT_FALSE(table.isNormalized(three));
+    EXPECT_FALSE(table.areOrthogonal(three, row4));
+    // Every normalized row is orthogonal to itself
+    for (int i = 0; i < rowTable::NORMALIZED_ROWS; i++) EXPECT_TRUE((table.orthogonalTo(i)[i / 64] >> (i % 64)) & 1);
+}
@@ -12,10 +12,12 @@
 #include <regex>
 #include <future>
 
+#include "LDE-Matrix/pattern-catalog.hpp"
+#include "LDE-Matrix/pattern-core.hpp"
 #include "LDE-Matrix/pattern-matrix.hpp"
 #include "LDE-Matrix/zmatrix.hpp"
-#include "LDE-Matrix/data/patterns928.hpp"
 #include "LDE-Matrix/pattern-deduper.hpp"
+#include "LDE-Matrix/run-utils.hpp"
 
 std::string USER_OUT_DIR = "user-output";
 std::regex R_T_GATE_REGEX("(xT[1-6][1-6])");
@@ -46,7 +48,57 @@ bool validTGateOps(std::vector<std::string> tGateOps) {
     return true;
 }
 
-void runWithOptions(int pNum, std::vector<std::string> tGateOps, bool printDebug, bool patternDebug, bool fullReduction, bool optimizedGenerate, bool o2Generate) {
+namespace {
+    // Dedupes every pattern the generator sends as it comes in
+    //  The first one starts the "Deduping:" section so the per pattern lines come before the generation summary
+    //  A leader stands in for its whole orbit, every pattern in it is a duplicate of the same one so the counts go up by orbitSize
+    class dedupSink : public patternSink {
+        public:
+            dedupSink(int lastPatternID, bool printDebug, std::ofstream &logOutput, std::ofstream &humanOutput)
+                : newPatternID(lastPatternID), printDebug(printDebug), logOutput(logOutput), humanOutput(humanOutput) {}
+
+            void add(const packedMatrix &pattern, uint64_t orbitSize) override {
+                auto start = std::chrono::high_resolution_clock::now();
+                if (patterns == 0) {
+                    if (printDebug) {
+                        std::cout << "Deduping:" << std::endl;
+                    }
+                    logOutput << "Deduping:" << std::endl;
+                }
+                patterns += orbitSize;
+                int duplicateID = -1;
+                // By default, these are in the old encoding but this could change :(
+                patternCore pmCopy = patternCore(++newPatternID, pattern);
+                if (pd.isDuplicate(pmCopy, duplicateID, true)) {
+                    if (printDebug) {
+                        std::cout << pmCopy.id << " is a duplicate of " << duplicateID << std::endl;
+                    }
+                    logOutput << pmCopy.id << " is a duplicate of " << duplicateID << std::endl;
+                    dupCount[duplicateID] += orbitSize;
+                } else {
+                    if (printDebug) {
+                        std::cout << pmCopy.id << " is unique" << std::endl;
+                    }
+                    logOutput << pmCopy.id << " is unique" << std::endl;
+                    humanOutput << pmCopy << " is unique" << std::endl;
+                }
+                dedupTime += std::chrono::high_resolution_clock::now() - start;
+            }
+
+            uint64_t patterns = 0;
+            std::map<int, uint64_t> dupCount;
+            std::chrono::high_resolution_clock::duration dedupTime{};
+
+        private:
+            patternDeduper pd;
+            int newPatternID;
+            bool printDebug;
+            std::ofstream &logOutput;
+            std::ofstream &humanOutput;
+    };
+}
+
+void runWithOptions(int pNum, std::vector<std::string> tGateOps, bool printDebug, bool patternDebug, bool fullReduction, bool optimizedGenerate, bool o2Generate, const searchBudget &budget, int threads) {
     // Limit this to 3 T Gate Ops per side (3x left and 3x right but not more)
     /*
     if (tGateOps.size() < 0 || tGateOps.size() > 4) {
@@ -186,38 +238,51 @@ void runWithOptions(int pNum, std::vector<std::string> tGateOps, bool printDebug
     if (printDebug) {
         std::cout << "Starting to generate all possible patterns" << std::endl;
     }
-    auto start_time = std::chrono::high_resolution_clock::now();
-    // This generates all possible value patterns and stores them in the old encoding scheme
-    
-    // These need to STOP if it attempts to generate ALL patterns
-    // Also, find a way to check a possible pattern signature to see if it's already been done, like the case 2 groupings
+    // This generates all possible value patterns in the old encoding scheme and dedupes each one as it's found
+    //  Nothing holds on to the patterns so the memory stays the same however many there are
+    // The budget stops a generation that would take too long, what it found so far is still deduped
+    // TODO: find a way to check a possible pattern signature to see if it's already been done, like the case 2 groupings
     
+    test.generatorBudget = budget;
+    test.generatorThreads = threads;
+    dedupSink dedup(1000000 * pNum, printDebug, logOutput, humanOutput);
+    auto start_time = std::chrono::high_resolution_clock::now();
     if (o2Generate) {
-        test.opt2GenerateAllPossibleValuePatterns();
+        test.opt2GenerateAllPossibleValuePatterns(dedup);
     } else if (optimizedGenerate) {
-        test.optimizedGenerateAllPossibleValuePatterns();
+        test.optimizedGenerateAllPossibleValuePatterns(dedup);
     } else {
-        test.generateAllPossibleValuePatterns();
+        test.generateAllPossibleValuePatterns(dedup);
     }
-    auto end_time = std::chrono::high_resolution_clock::now();
+    // The time spent deduping is taken back out so these are still only the generation times
+    auto end_time = std::chrono::high_resolution_clock::now() - dedup.dedupTime;
     auto allPatternsTime = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count();
     auto onePatternTime = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
-    if (test.allPossibleValuePatterns.size() > 0) {
-        onePatternTime = onePatternTime / test.allPossibleValuePatterns.size();
+    if (dedup.patterns > 0) {
+        onePatternTime = onePatternTime / dedup.patterns;
     }
     if (printDebug) {
         std::cout << "Time to generate all possible patterns: " << allPatternsTime  << " milliseconds" << std::endl;
         std::cout << "Time to generate 1 valid pattern: " << onePatternTime  << " microseconds" << std::endl;
-        std::cout << "Number of possible value patterns: " << test.allPossibleValuePatterns.size() << std::endl;
-        std::cout << "Deduping:" << std::endl;
+        std::cout << "Number of possible value patterns: " << dedup.patterns << std::endl;
     }
     logOutput << "Time to generate all possible patterns: " << allPatternsTime << " milliseconds" << std::endl;
     logOutput << "Time to generate 1 valid pattern: " << onePatternTime << " microseconds" << std::endl;
-    logOutput << "Number of valid patterns: " << test.allPossibleValuePatterns.size() << std::endl;
+    logOutput << "Number of valid patterns: " << dedup.patterns << std::endl;
     humanOutput << "Time to generate all possible patterns: " << allPatternsTime << " milliseconds" << std::endl;
     humanOutput << "Time to generate 1 valid pattern: " << onePatternTime << " microseconds" << std::endl;
-    humanOutput << "Number of valid patterns: " << test.allPossibleValuePatterns.size() << std::endl;
-    if (test.allPossibleValuePatterns.size() == 0) {
+    humanOutput << "Number of valid patterns: " << dedup.patterns << std::endl;
+    const generatorStats &stats = test.generationStats;
+    if (stats.stop != searchStop::NONE) {
+        std::ostringstream stopped;
+        stopped << "Stopped early by the " << toString(stats.stop) << " after " << stats.nodes << " nodes and " << stats.leaves << " leaves, covered " << 100 * stats.covered << "% of the search";
+        if (printDebug) {
+            std::cout << stopped.str() << std::endl;
+        }
+        logOutput << stopped.str() << std::endl;
+        humanOutput << stopped.str() << std::endl;
+    }
+    if (dedup.patterns == 0) {
         if (printDebug) {
             std::cout << "No valid patterns to dedupe" << std::endl;
         }
@@ -228,28 +293,7 @@ void runWithOptions(int pNum, std::vector<std::string> tGateOps, bool printDebug
         humanOutput.close();
         return;
     }
-    logOutput << "Deduping:" << std::endl;
-    patternDeduper pd = patternDeduper();
-    int newPatternID = 1000000 * pNum;
-    std::map<int, int> dupCount;
-    for (auto pm : test.allPossibleValuePatterns) {
-        int duplicateID = -1;
-        // By default, these are in the old encoding but this could change :(
-        patternMatrix pmCopy = patternMatrix(++newPatternID, pm.first);
-        if (pd.isDuplicate(pmCopy, duplicateID, true)) {
-            if (printDebug) {
-                std::cout << pmCopy.id << " is a duplicate of " << duplicateID << std::endl;
-            }
-            logOutput << pmCopy.id << " is a duplicate of " << duplicateID << std::endl;
-            dupCount[duplicateID]++;
-        } else {
-            if (printDebug) {
-                std::cout << pmCopy.id << " is unique" << std::endl;
-            }
-            logOutput << pmCopy.id << " is unique" << std::endl;
-            humanOutput << pmCopy << " is unique" << std::endl;
-        }
-    }
+    std::map<int, uint64_t> &dupCount = dedup.dupCount;
     if (printDebug) {
         std::cout << "Duplicate Counts:" << std::endl;
     }
@@ -260,9 +304,8 @@ void runWithOptions(int pNum, std::vector<std::string> tGateOps, bool printDebug
         std::cout << "Duplicate ID: " << id << " Count: " << count << std::endl;
         logOutput << "Duplicate ID: " << id << " Count: " << count << std::endl;
         humanOutput << "Duplicate ID: " << id << " Count: " << count << std::endl;
-        patternMatrix temp = patternMatrix(id);
-        temp.determineSubCase();
-        dupCaseSubcase[temp.caseMatch][temp.subCaseMatch].push_back(id);
+        const catalogPattern &known = patternCatalog::instance()[id];
+        dupCaseSubcase[known.caseMatch][known.subCaseMatch].push_back(id);
     }
     
     for (auto const& [caseNum, subCaseMatch] : dupCaseSubcase) {
@@ -285,18 +328,18 @@ void runWithOptions(int pNum, std::vector<std::string> tGateOps, bool printDebug
 }
 
 void silentRun(int pNum, std::vector<std::string> tGateOps) {
-    runWithOptions(pNum, tGateOps, false, false, true, true, true);
+    runWithOptions(pNum, tGateOps, false, false, true, true, true, searchBudget(), 0);
 }
 
 void standardRun(int pNum, std::vector<std::string> tGateOps) {
-    runWithOptions(pNum, tGateOps, true, false, true, true, true);
+    runWithOptions(pNum, tGateOps, true, false, true, true, true, searchBudget(), 0);
 }
 
 void fullDebugRun(int pNum, std::vector<std::string> tGateOps) {
-    runWithOptions(pNum, tGateOps, true, true, true, true, true);
+    runWithOptions(pNum, tGateOps, true, true, true, true, true, searchBudget(), 0);
 }
 
-void allGateRunWithOptions(int pNum, bool printDebug, bool patternDebug, bool fullReduction, bool optimizedGenerate, bool o2Generate) {
+void allGateRunWithOptions(int pNum, bool printDebug, bool patternDebug, bool fullReduction, bool optimizedGenerate, bool o2Generate, const searchBudget &budget) {
     patternMatrix test = patternMatrix(pNum);
     std::cout << std::endl << "=============================================" << std::endl;
     if (test.findAllTGateOptions()) {
@@ -307,7 +350,7 @@ void allGateRunWithOptions(int pNum, bool printDebug, bool patternDebug, bool fu
                 std::cout << tGateOp << " ";
             }
             std::cout << std::endl << std::endl;
-            runWithOptions(pNum, tGateOps, printDebug, patternDebug, fullReduction, optimizedGenerate, o2Generate);
+            runWithOptions(pNum, tGateOps, printDebug, patternDebug, fullReduction, optimizedGenerate, o2Generate, budget);
         }
     } else {
         std::string fileNameBase = "/p" + std::to_string(pNum) + "-" + "no-t-gate-options-";
@@ -1,13 +1,18 @@
 #ifndef LDE_MATRIX_RUN_UTILS_HPP
 #define LDE_MATRIX_RUN_UTILS_HPP
 
+#include <string>
 #include <vector>
 
+#include "LDE-Matrix/search-budget.hpp"
+
 bool validTGateOps(std::vector<std::string> tGateOps);
-void runWithOptions(int pNum, std::vector<std::string> tGateOps, bool printDebug, bool patternDebug, bool fullReduction, bool optimizedGenerate, bool o2Generate);
+// A generation that runs out of budget still dedupes what it found and says how much of the search it covered
+//  threads goes to patternMatrix::generatorThreads, the single pattern runs below use every core
+void runWithOptions(int pNum, std::vector<std::string> tGateOps, bool printDebug, bool patternDebug, bool fullReduction, bool optimizedGenerate, bool o2Generate, const searchBudget &budget = searchBudget(), int threads = 1);
 void standardRun(int pNum, std::vector<std::string> tGateOps);
 void fullDebugRun(int pNum, std::vector<std::string> tGateOps);
-void allGateRunWithOptions(int pNum, bool printDebug, bool patternDebug, bool fullReduction, bool optimizedGenerate, bool o2Generate);
+void allGateRunWithOptions(int pNum, bool printDebug, bool patternDebug, bool fullReduction, bool optimizedGenerate, bool o2Generate, const searchBudget &budget = searchBudget());
 void standardAllGateRun(int pNum);
 void allGateRunWithDebug(int pNum);
 
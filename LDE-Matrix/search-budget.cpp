@@ -0,0 +1,44 @@
+#include "search-budget.hpp"
+
+#include <algorithm>
+
+const char* toString(searchStop reason) {
+    switch (reason) {
+        case searchStop::NONE: return "none";
+        case searchStop::NODES: return "node budget";
+        case searchStop::LEAVES: return "leaf budget";
+        case searchStop::TIME: return "time budget";
+    }
+    return "unknown";
+}
+
+// Small node and leaf limits get a smaller batch so the workers can't go through the whole tree between them without charging it
+budgetTracker::budgetTracker(const searchBudget &budget, int workers)
+    : budget(budget), batch((workers <= 1) ? 1 : maxBatch), start(std::chrono::steady_clock::now()) {
+    if (workers <= 1) return;
+    for (uint64_t limit : {budget.maxNodes, budget.maxLeaves}) {
+        if (limit != 0) batch = std::clamp<uint64_t>(limit / (4 * uint64_t(workers)), 1, batch);
+    }
+}
+
+bool budgetTracker::charge(generatorStats &stats) {
+    uint64_t newNodes = stats.nodes - stats.chargedNodes;
+    uint64_t newLeaves = stats.leaves - stats.chargedLeaves;
+    stats.chargedNodes = stats.nodes;
+    stats.chargedLeaves = stats.leaves;
+    uint64_t before = nodes.fetch_add(newNodes, std::memory_order_relaxed);
+    uint64_t after = before + newNodes;
+    uint64_t allLeaves = leaves.fetch_add(newLeaves, std::memory_order_relaxed) + newLeaves;
+
+    searchStop exceeded = searchStop::NONE;
+    if (budget.maxNodes != 0 && after >= budget.maxNodes) exceeded = searchStop::NODES;
+    else if (budget.maxLeaves != 0 && allLeaves >= budget.maxLeaves) exceeded = searchStop::LEAVES;
+    else if (budget.maxTime.count() != 0 && before / clockNodes != after / clockNodes
+             && std::chrono::steady_clock::now() - start >= budget.maxTime) exceeded = searchStop::TIME;
+    if (exceeded != searchStop::NONE) {
+        // The first worker to run out decides the reason
+        searchStop none = searchStop::NONE;
+        reason.compare_exchange_strong(none, exceeded);
+    }
+    return stopped();
+}
@@ -0,0 +1,81 @@
+#ifndef SEARCH_BUDGET_HPP
+#define SEARCH_BUDGET_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Limits on how far a *GenerateAllPossibleValuePatterns search may go, 0 means no limit
+//  A search that runs out stops cleanly and keeps whatever it already sent to its sink
+struct searchBudget {
+    uint64_t maxNodes = 0;  // Entries (or opt2 rows) tried
+    uint64_t maxLeaves = 0;  // Complete patterns checked
+    std::chrono::milliseconds maxTime{0};  // Wall clock time from the start of the search
+
+    bool unlimited() const { return maxNodes == 0 && maxLeaves == 0 && maxTime.count() == 0; }
+};
+
+// Why a search stopped before it went through the whole tree
+enum class searchStop { NONE, NODES, LEAVES, TIME };
+const char* toString(searchStop reason);
+
+// How much of the search tree a generator run went through
+struct generatorStats {
+    uint64_t nodes = 0;  // Entries (or opt2 rows) tried
+    uint64_t leaves = 0;  // Complete patterns that were checked
+    uint64_t patterns = 0;  // Valid patterns sent to the sink
+    uint64_t columnPrunedBranches = 0;  // Branches cut because a column or column pair couldn't be fixed by the rows below
+    uint64_t columnPrunedLeaves = 0;  // Complete patterns those branches would have had, saturates at UINT64_MAX
+    uint64_t symmetryPrunedBranches = 0;  // Branches cut because they can't hold the leader of an orbit, only with symmetryBreaking
+    uint64_t symmetryPrunedLeaves = 0;  // Same as columnPrunedLeaves for those branches
+    // Part of the tree that's been dealt with, either checked or cut, from 0 to 1
+    //  Every node splits its part evenly between its children so this is exact for the standard search and a guide for the others
+    double covered = 0;
+    searchStop stop = searchStop::NONE;  // Set when the searchBudget ran out, covered is then below 1
+    // What's already been handed to the budgetTracker, only used while searching
+    uint64_t chargedNodes = 0;
+    uint64_t chargedLeaves = 0;
+
+    static uint64_t saturatingAdd(uint64_t a, uint64_t b) { return (a > UINT64_MAX - b) ? UINT64_MAX : a + b; }
+    void add(const generatorStats &other) {
+        nodes += other.nodes;
+        leaves += other.leaves;
+        patterns += other.patterns;
+        columnPrunedBranches += other.columnPrunedBranches;
+        columnPrunedLeaves = saturatingAdd(columnPrunedLeaves, other.columnPrunedLeaves);
+        symmetryPrunedBranches += other.symmetryPrunedBranches;
+        symmetryPrunedLeaves = saturatingAdd(symmetryPrunedLeaves, other.symmetryPrunedLeaves);
+        covered += other.covered;
+    }
+};
+
+// Keeps every worker of one search inside a searchBudget
+//  Each worker counts in its own generatorStats and hands over what's new every batch nodes
+//  With one worker the batch is a single node so the node and leaf limits are exact,
+//  with more they can be overshot by up to a batch a worker, a quarter of the limit split between the workers at most
+class budgetTracker {
+    public:
+        budgetTracker(const searchBudget &budget, int workers);
+
+        // Call before trying a node, true once the search has to stop
+        bool spend(generatorStats &stats) {
+            if (stats.nodes - stats.chargedNodes < batch) return stopped();
+            return charge(stats);
+        }
+        bool charge(generatorStats &stats);
+        bool stopped() const { return reason.load(std::memory_order_relaxed) != searchStop::NONE; }
+        searchStop stopReason() const { return reason.load(); }
+
+    private:
+        // The clock is only read every clockNodes nodes
+        static constexpr uint64_t clockNodes = 256;
+        static constexpr uint64_t maxBatch = 256;
+        searchBudget budget;
+        uint64_t batch;
+        std::chrono::steady_clock::time_point start;
+        std::atomic<uint64_t> nodes = 0;
+        std::atomic<uint64_t> leaves = 0;
+        std::atomic<searchStop> reason = searchStop::NONE;
+};
+
+#endif // SEARCH_BUDGET_HPP
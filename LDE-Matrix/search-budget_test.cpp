@@ -0,0 +1,71 @@
+#include "search-budget.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+
+TEST(SearchBudgetTest, Unlimited) {
+    searchBudget budget;
+    EXPECT_TRUE(budget.unlimited());
+    budget.maxLeaves = 1;
+    EXPECT_FALSE(budget.unlimited());
+    EXPECT_STREQ(toString(searchStop::NONE), "none");
+    EXPECT_STREQ(toString(searchStop::TIME), "time budget");
+}
+
+TEST(SearchBudgetTest, OneWorkerStopsExactly) {
+    searchBudget budget;
+    budget.maxNodes = 10;
+    budgetTracker tracker(budget, 1);
+    generatorStats stats;
+    while (!tracker.spend(stats)) stats.nodes++;
+    EXPECT_EQ(stats.nodes, 10);
+    EXPECT_EQ(tracker.stopReason(), searchStop::NODES);
+
+    budget = searchBudget();
+    budget.maxLeaves = 3;
+    budgetTracker leafTracker(budget, 1);
+    stats = generatorStats();
+    while (!leafTracker.spend(stats)) {
+        stats.nodes++;
+        if (stats.nodes % 4 == 0) stats.leaves++;
+    }
+    EXPECT_EQ(stats.leaves, 3);
+    EXPECT_EQ(stats.nodes, 12);
+    EXPECT_EQ(leafTracker.stopReason(), searchStop::LEAVES);
+}
+
+TEST(SearchBudgetTest, WorkersShareTheBudget) {
+    searchBudget budget;
+    budget.maxNodes = 10000;
+    budgetTracker tracker(budget, 2);
+    generatorStats stats[2];
+    std::thread other([&] { while (!tracker.spend(stats[1])) stats[1].nodes++; });
+    while (!tracker.spend(stats[0])) stats[0].nodes++;
+    other.join();
+    // Each worker can go up to a batch over
+    EXPECT_GE(stats[0].nodes + stats[1].nodes, 10000);
+    EXPECT_LE(stats[0].nodes + stats[1].nodes, 10000 + 2 * 256);
+    EXPECT_EQ(tracker.stopReason(), searchStop::NODES);
+
+    // A small limit gets a small batch
+    budget.maxNodes = 100;
+    budgetTracker smallTracker(budget, 2);
+    generatorStats small[2];
+    std::thread smallOther([&] { while (!smallTracker.spend(small[1])) small[1].nodes++; });
+    while (!smallTracker.spend(small[0])) small[0].nodes++;
+    smallOther.join();
+    EXPECT_LE(small[0].nodes + small[1].nodes, 100 + 2 * (100 / 8));
+    EXPECT_EQ(smallTracker.stopReason(), searchStop::NODES);
+}
+
+TEST(SearchBudgetTest, ClockStopsTheSearch) {
+    searchBudget budget;
+    budget.maxTime = std::chrono::milliseconds(20);
+    budgetTracker tracker(budget, 1);
+    generatorStats stats;
+    auto start = std::chrono::steady_clock::now();
+    while (!tracker.spend(stats)) stats.nodes++;
+    EXPECT_GE(std::chrono::steady_clock::now() - start, budget.maxTime);
+    EXPECT_EQ(tracker.stopReason(), searchStop::TIME);
+}
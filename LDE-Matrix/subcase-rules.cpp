@@ -0,0 +1,122 @@
+#include "subcase-rules.hpp"
+
+#include <format>
+#include <stdexcept>
+
+const std::vector<subCaseRule> SUBCASE_RULES = {
+    // Case 1 doesn't have any subcases
+    {1, subCaseTable::NO_SUBCASE, {{}}},
+    // Case 2 doesn't have any subcases
+    {2, subCaseTable::NO_SUBCASE, {{}}},
+    // 3a: The four columns/rows with odd entries are fully paired
+    {3, 'a', {
+        {rowPairs(0, 1, 6), rowPairs(2, 3, 6)}, {rowPairs(0, 2, 6), rowPairs(1, 3, 6)}, {rowPairs(0, 3, 6), rowPairs(1, 2, 6)},
+        {colPairs(0, 1, 6), colPairs(2, 3, 6)}, {colPairs(0, 2, 6), colPairs(1, 3, 6)}, {colPairs(0, 3, 6), colPairs(1, 2, 6)}}},
+    // 3b: In the first four rows/columns, four entries of every row/column are paired.
+    //  TODO - 3b might also need the upper right [4x2] and lower left [2x4] to be the same value, see the history of case3SubCaseMatch
+    {3, 'b', {
+        {rowPairs(0, 1, 4), rowPairs(2, 3, 4)}, {rowPairs(0, 2, 4), rowPairs(1, 3, 4)}, {rowPairs(0, 3, 4), rowPairs(1, 2, 4)},
+        {colPairs(0, 1, 4), colPairs(2, 3, 4)}, {colPairs(0, 2, 4), colPairs(1, 3, 4)}, {colPairs(0, 3, 4), colPairs(1, 2, 4)}}},
+    // 3c: there are only two paired numbers per row/column.
+    {3, 'c', {
+        {rowPairs(0, 1, 2), rowPairs(2, 3, 2)}, {rowPairs(0, 2, 2), rowPairs(1, 3, 2)}, {rowPairs(0, 3, 2), rowPairs(1, 2, 2)},
+        {colPairs(0, 1, 2), colPairs(2, 3, 2)}, {colPairs(0, 2, 2), colPairs(1, 3, 2)}, {colPairs(0, 3, 2), colPairs(1, 2, 2)}}},
+    // 4a: has two fully paired columns if m11 = m12.
+    {4, 'a', {{colPairs(0, 1, 6), colPairs(2, 3, 6)}, {colPairs(0, 2, 6), colPairs(1, 3, 6)}}},
+    // 4b: where m11 ̸ = m12
+    {4, 'b', {{}}},
+    // 5a: Either columns (1,2) and (3,4) are fully paired if m11 = m12 and
+    //     m13 = m14, where xT12xT34 is correct T sequence, or rows (1,2) and (3,4) are
+    //     fully paired if m11 = m21 and m31 = m41, where T12xT34x reduce k to k-1.
+    {5, 'a', {
+        {rowPairs(0, 1, 6), rowPairs(2, 3, 6)}, {rowPairs(0, 2, 6), rowPairs(1, 3, 6)},
+        {colPairs(0, 1, 6), colPairs(2, 3, 6)}, {colPairs(0, 2, 6), colPairs(1, 3, 6)}}},
+    // 5b: m11 = m12 and m13 ̸ = m14
+    //     The case where m33 = m34 and m31 != m32 is included as this block can be moved into place
+    {5, 'b', {{entriesEqual(0, 0, 0, 1), entriesDiffer(0, 2, 0, 3)}, {entriesEqual(2, 2, 2, 3), entriesDiffer(2, 0, 2, 1)}}},
+    // 6a: Rows (1,2) and (3,4) are paired
+    {6, 'a', {{rowPairs(0, 1, 6), rowPairs(2, 3, 6)}}},
+    // 6b: columns (1,2), (3,4), and (5,6) are fully paired
+    {6, 'b', {{colPairs(0, 1, 6), colPairs(2, 3, 6), colPairs(4, 5, 6)}}},
+    // 6c: In the first four rows, only two paired entries between sets of 2 rows ([1,2 and 3,4] or [1,3 and 2,4] or [1,4 and 2,3])
+    {6, 'c', {{rowPairs(0, 1, 2), rowPairs(2, 3, 2)}, {rowPairs(0, 2, 2), rowPairs(1, 3, 2)}, {rowPairs(0, 3, 2), rowPairs(1, 2, 2)}}},
+    // Maybe N/A??  The single pattern corresponds to I ⊗ H?
+    {7, subCaseTable::NO_SUBCASE, {{}}},
+    // 8b: V11, V12 have different parity and V11, V21 have different parity
+    {8, 'b', {{paritiesDiffer(0, 0, 0, 1), paritiesDiffer(0, 0, 1, 0)}}},
+    // 8a: V11, V12 have the same parity or V11, V21 have the same parity
+    {8, 'a', {{}}},
+};
+
+bool subCaseAtom::test(const packedMatrix &p, const packedMatrix::pairTable &rowPairs, const packedMatrix::pairTable &colPairs) const {
+    switch (type) {
+        case ROW_PAIRS:
+            return rowPairs[a][b] == c;
+        case COL_PAIRS:
+            return colPairs[a][b] == c;
+        case ENTRIES_EQUAL:
+            return p.get(a, b) == p.get(c, d);
+        case ENTRIES_DIFFER:
+            return p.get(a, b) != p.get(c, d);
+        case PARITIES_DIFFER:
+            return p.get(a, b) % 2 != p.get(c, d) % 2;
+    }
+    return false;
+}
+
+int subCaseTable::atomIndex(const subCaseAtom &atom) {
+    for (int i = 0; i < int(atoms.size()); i++) {
+        if (atoms[i] == atom) return i;
+    }
+    if (atoms.size() == 64) throw std::runtime_error("Too many distinct subcase atoms for the table");
+    atoms.push_back(atom);
+    return int(atoms.size()) - 1;
+}
+
+subCaseTable::subCaseTable(const std::vector<subCaseRule> &rules) {
+    for (const subCaseRule &rule : rules) {
+        if (rule.caseId < 0 || rule.caseId >= MAX_CASES) throw std::runtime_error(std::format("Invalid case in subcase rules: {}", rule.caseId));
+        compiledRule compiled;
+        compiled.subCase = rule.subCase;
+        for (const std::vector<subCaseAtom> &alternative : rule.alternatives) {
+            uint64_t mask = 0;
+            for (const subCaseAtom &atom : alternative) {
+                mask |= uint64_t(1) << atomIndex(atom);
+                if (atom.type == subCaseAtom::ROW_PAIRS || atom.type == subCaseAtom::COL_PAIRS) needsPairs[rule.caseId] = true;
+            }
+            compiled.alternatives.push_back(mask);
+            atomsByCase[rule.caseId] |= mask;
+        }
+        rulesByCase[rule.caseId].push_back(compiled);
+    }
+}
+
+const subCaseTable& subCaseTable::instance() {
+    static const subCaseTable table(SUBCASE_RULES);
+    return table;
+}
+
+bool subCaseTable::match(int caseId, const packedMatrix &p, char &subCase) const {
+    if (caseId < 0 || caseId >= MAX_CASES) return false;
+    packedMatrix::pairTable rowPairs{};
+    packedMatrix::pairTable colPairs{};
+    if (needsPairs[caseId]) {
+        p.rowPairCounts(rowPairs);
+        p.transposed().rowPairCounts(colPairs);
+    }
+    // Only the atoms this case uses are tested
+    uint64_t facts = 0;
+    for (uint64_t remaining = atomsByCase[caseId]; remaining != 0; remaining &= remaining - 1) {
+        int i = std::countr_zero(remaining);
+        if (atoms[i].test(p, rowPairs, colPairs)) facts |= uint64_t(1) << i;
+    }
+    for (const compiledRule &rule : rulesByCase[caseId]) {
+        for (uint64_t alternative : rule.alternatives) {
+            if ((facts & alternative) == alternative) {
+                subCase = rule.subCase;
+                return true;
+            }
+        }
+    }
+    return false;
+}
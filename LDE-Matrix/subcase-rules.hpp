@@ -0,0 +1,77 @@
+#ifndef SUBCASE_RULES_HPP
+#define SUBCASE_RULES_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "packed-matrix.hpp"
+
+// A single test on a pattern that is lined up with its case
+//  Indexes start at 0 like the rest of the code, not at 1 like the papers
+struct subCaseAtom {
+    enum atomType : uint8_t {
+        ROW_PAIRS,        // rows a and b hold the same value in exactly c places
+        COL_PAIRS,        // columns a and b hold the same value in exactly c places
+        ENTRIES_EQUAL,    // z[a][b] == z[c][d]
+        ENTRIES_DIFFER,   // z[a][b] != z[c][d]
+        PARITIES_DIFFER   // z[a][b] % 2 != z[c][d] % 2
+    };
+    atomType type;
+    int a;
+    int b;
+    int c;
+    int d = 0;
+
+    bool test(const packedMatrix &p, const packedMatrix::pairTable &rowPairs, const packedMatrix::pairTable &colPairs) const;
+    constexpr bool operator==(const subCaseAtom &other) const = default;
+};
+
+constexpr subCaseAtom rowPairs(int i, int j, int count) { return {subCaseAtom::ROW_PAIRS, i, j, count}; }
+constexpr subCaseAtom colPairs(int i, int j, int count) { return {subCaseAtom::COL_PAIRS, i, j, count}; }
+constexpr subCaseAtom entriesEqual(int r1, int c1, int r2, int c2) { return {subCaseAtom::ENTRIES_EQUAL, r1, c1, r2, c2}; }
+constexpr subCaseAtom entriesDiffer(int r1, int c1, int r2, int c2) { return {subCaseAtom::ENTRIES_DIFFER, r1, c1, r2, c2}; }
+constexpr subCaseAtom paritiesDiffer(int r1, int c1, int r2, int c2) { return {subCaseAtom::PARITIES_DIFFER, r1, c1, r2, c2}; }
+
+// A subcase is picked when every atom of any one of its alternatives holds
+//  An empty alternative always holds
+//  The rules of a case are tried in order and the first one that holds wins
+struct subCaseRule {
+    int caseId;
+    char subCase;  // NO_SUBCASE for cases that match without a subcase
+    std::vector<std::vector<subCaseAtom>> alternatives;
+};
+
+// The subcase rules from the papers, in the order patternMatrix has always checked them
+extern const std::vector<subCaseRule> SUBCASE_RULES;
+
+// The rules compiled into a table
+//  Every distinct atom gets a bit and every alternative becomes the mask of the atoms it needs,
+//  so a pattern is matched by testing each atom of its case once and then comparing masks
+class subCaseTable {
+    public:
+        static constexpr char NO_SUBCASE = '-';
+        static constexpr int MAX_CASES = 9;
+
+        explicit subCaseTable(const std::vector<subCaseRule> &rules);
+        // The table for SUBCASE_RULES, built once
+        static const subCaseTable& instance();
+
+        // False when none of the rules for caseId hold
+        //  Otherwise subCase is set to the subcase that matched
+        bool match(int caseId, const packedMatrix &p, char &subCase) const;
+        size_t atomCount() const { return atoms.size(); }
+
+    private:
+        struct compiledRule {
+            char subCase;
+            std::vector<uint64_t> alternatives;
+        };
+        std::vector<subCaseAtom> atoms;
+        std::array<std::vector<compiledRule>, MAX_CASES> rulesByCase;
+        std::array<uint64_t, MAX_CASES> atomsByCase{};
+        std::array<bool, MAX_CASES> needsPairs{};
+        int atomIndex(const subCaseAtom &atom);
+};
+
+#endif // SUBCASE_RULES_HPP
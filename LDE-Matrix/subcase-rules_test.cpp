@@ -0,0 +1,89 @@
+#include "subcase-rules.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+packedMatrix fromRows(std::vector<std::vector<int>> values) {
+    packedMatrix pm;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) pm.set(i, j, values[i][j]);
+    }
+    return pm;
+}
+
+TEST(SubCaseRulesTest, CustomRules) {
+    subCaseTable table({
+        {3, 'x', {{rowPairs(0, 1, 6)}, {colPairs(0, 1, 6), entriesEqual(0, 0, 5, 5)}}},
+        {3, 'y', {{entriesDiffer(0, 0, 5, 5)}}},
+        {4, subCaseTable::NO_SUBCASE, {{}}},
+    });
+    // rowPairs(0, 1, 6) is shared by rule x so there are only 4 distinct atoms
+    EXPECT_EQ(table.atomCount(), 4);
+
+    packedMatrix zeros;
+    char subCase = '?';
+    EXPECT_TRUE(table.match(3, zeros, subCase));
+    EXPECT_EQ(subCase, 'x');
+
+    // Rows 0 and 1 no longer match but columns 0 and 1 still do and z[0][0] == z[5][5]
+    packedMatrix p = zeros;
+    p.set(0, 2, 1);
+    EXPECT_TRUE(table.match(3, p, subCase));
+    EXPECT_EQ(subCase, 'x');
+    // Now z[0][0] != z[5][5] so it falls through to y
+    p.set(5, 5, 3);
+    EXPECT_TRUE(table.match(3, p, subCase));
+    EXPECT_EQ(subCase, 'y');
+
+    EXPECT_TRUE(table.match(4, p, subCase));
+    EXPECT_EQ(subCase, subCaseTable::NO_SUBCASE);
+    // No rules means no match and subCase is left alone
+    subCase = '?';
+    EXPECT_FALSE(table.match(5, p, subCase));
+    EXPECT_FALSE(table.match(-1, p, subCase));
+    EXPECT_FALSE(table.match(100, p, subCase));
+    EXPECT_EQ(subCase, '?');
+
+    EXPECT_THROW(subCaseTable({{9, 'a', {{}}}}), std::runtime_error);
+}
+
+TEST(SubCaseRulesTest, PaperRules) {
+    const subCaseTable &table = subCaseTable::instance();
+    EXPECT_EQ(&table, &subCaseTable::instance());
+    char subCase = '?';
+    // Case 0 doesn't have any rules at all
+    EXPECT_FALSE(table.match(0, packedMatrix(), subCase));
+    // Cases 1, 2 and 7 don't have subcases
+    EXPECT_TRUE(table.match(7, packedMatrix(), subCase));
+    EXPECT_EQ(subCase, '-');
+
+    // 8a / 8b come down to the parity of V11, V12 and V21
+    packedMatrix case8 = fromRows({
+        {3, 2, 1, 1, 0, 0},
+        {2, 2, 1, 1, 0, 0},
+        {1, 1, 0, 0, 1, 1},
+        {1, 1, 0, 0, 1, 1},
+        {0, 0, 1, 1, 1, 1},
+        {0, 0, 1, 1, 1, 1}
+    });
+    EXPECT_TRUE(table.match(8, case8, subCase));
+    EXPECT_EQ(subCase, 'b');
+    case8.set(0, 1, 3);
+    EXPECT_TRUE(table.match(8, case8, subCase));
+    EXPECT_EQ(subCase, 'a');
+
+    // 6b needs all three column pairs to be fully paired
+    packedMatrix case6 = fromRows({
+        {2, 2, 3, 3, 0, 0},
+        {3, 3, 2, 2, 0, 0},
+        {2, 2, 0, 0, 3, 3},
+        {3, 3, 0, 0, 2, 2},
+        {0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0}
+    });
+    EXPECT_TRUE(table.match(6, case6, subCase));
+    EXPECT_EQ(subCase, 'b');
+    case6.set(3, 5, 3);
+    EXPECT_TRUE(table.match(6, case6, subCase));
+    EXPECT_EQ(subCase, 'c');
+}
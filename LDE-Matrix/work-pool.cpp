@@ -0,0 +1,75 @@
+#include "work-pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+workPool::workPool(int threads) : threads(threads) {
+    if (this->threads <= 0) this->threads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+namespace {
+    struct taskQueue {
+        std::mutex lock;
+        std::deque<int> tasks;
+    };
+}
+
+void workPool::run(int taskCount, const std::function<void(int, int)> &task) {
+    int workers = std::min(threads, taskCount);
+    if (workers <= 1) {
+        for (int i = 0; i < taskCount; i++) task(i, 0);
+        return;
+    }
+
+    // Contiguous blocks keep neighbouring subtrees on one worker until someone has to steal
+    std::vector<std::unique_ptr<taskQueue>> queues;
+    for (int w = 0; w < workers; w++) {
+        queues.push_back(std::make_unique<taskQueue>());
+        for (int i = taskCount * w / workers; i < taskCount * (w + 1) / workers; i++) queues[w]->tasks.push_back(i);
+    }
+
+    std::atomic<bool> failed = false;
+    std::exception_ptr error;
+    std::mutex errorLock;
+    auto worker = [&](int w) {
+        while (!failed) {
+            int next = -1;
+            {
+                std::lock_guard<std::mutex> guard(queues[w]->lock);
+                if (!queues[w]->tasks.empty()) {
+                    next = queues[w]->tasks.back();
+                    queues[w]->tasks.pop_back();
+                }
+            }
+            for (int offset = 1; next < 0 && offset < workers; offset++) {
+                taskQueue &victim = *queues[(w + offset) % workers];
+                std::lock_guard<std::mutex> guard(victim.lock);
+                if (!victim.tasks.empty()) {
+                    next = victim.tasks.front();
+                    victim.tasks.pop_front();
+                }
+            }
+            // Tasks never add more tasks so empty everywhere means done
+            if (next < 0) return;
+            try {
+                task(next, w);
+            } catch (...) {
+                std::lock_guard<std::mutex> guard(errorLock);
+                if (!error) error = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int w = 1; w < workers; w++) pool.emplace_back(worker, w);
+    worker(0);
+    for (std::thread &t : pool) t.join();
+    if (error) std::rethrow_exception(error);
+}
@@ -0,0 +1,26 @@
+#ifndef WORK_POOL_HPP
+#define WORK_POOL_HPP
+
+#include <functional>
+
+// A small work stealing pool for searches that split into independent tasks
+//  Every worker starts with its own block of tasks, takes them from the back of its deque
+//  and steals from the front of the other deques once its own runs dry
+//  so a worker that drew a few huge subtrees doesn't leave the rest idle
+// With a single thread everything runs in order on the calling thread, the generators rely on that for their debug output
+class workPool {
+    public:
+        // 0 uses every core
+        explicit workPool(int threads = 0);
+
+        int size() const { return threads; }
+        // Calls task(index, worker) for every index in [0, taskCount) and returns once they're all done
+        //  worker is in [0, size()) so the caller can keep results per worker and merge them at the end without locking
+        //  The first exception a task throws stops the other workers and is rethrown here
+        void run(int taskCount, const std::function<void(int, int)> &task);
+
+    private:
+        int threads;
+};
+
+#endif // WORK_POOL_HPP
@@ -0,0 +1,65 @@
+#include "work-pool.hpp"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(WorkPoolTest, RunsEveryTaskOnce) {
+    workPool pool(4);
+    EXPECT_EQ(pool.size(), 4);
+    std::vector<std::atomic<int>> runs(1000);
+    std::vector<long> sums(pool.size());
+    pool.run(runs.size(), [&](int task, int worker) {
+        runs[task]++;
+        sums[worker] += task;
+    });
+    for (auto &r : runs) EXPECT_EQ(r, 1);
+    long total = 0;
+    for (long s : sums) total += s;
+    EXPECT_EQ(total, 999 * 1000 / 2);
+
+    // Nothing to do is fine too
+    pool.run(0, [&](int, int) { FAIL(); });
+}
+
+TEST(WorkPoolTest, SingleThreadRunsInOrder) {
+    workPool pool(1);
+    std::vector<int> order;
+    std::thread::id caller = std::this_thread::get_id();
+    pool.run(10, [&](int task, int worker) {
+        EXPECT_EQ(worker, 0);
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        order.push_back(task);
+    });
+    ASSERT_EQ(order.size(), 10);
+    for (int i = 0; i < 10; i++) EXPECT_EQ(order[i], i);
+    EXPECT_GE(workPool().size(), 1);
+}
+
+TEST(WorkPoolTest, Stealing) {
+    // The first block of tasks is slow, the other workers have to take some of it
+    workPool pool(4);
+    std::vector<int> ranBy(40, -1);
+    pool.run(ranBy.size(), [&](int task, int worker) {
+        if (task < 10) std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        ranBy[task] = worker;
+    });
+    int stolen = 0;
+    for (int task = 0; task < 10; task++) {
+        if (ranBy[task] != 0) stolen++;
+    }
+    EXPECT_GT(stolen, 0);
+}
+
+TEST(WorkPoolTest, Exceptions) {
+    workPool pool(3);
+    std::atomic<int> ran = 0;
+    EXPECT_THROW(pool.run(100, [&](int task, int) {
+        ran++;
+        if (task == 5) throw std::runtime_error("Task failed");
+    }), std::runtime_error);
+    EXPECT_LE(ran, 100);
+}
@@ -4,10 +4,14 @@
 #include <vector>
 #include <sstream>
 #include <map>
+#include <algorithm>
 
 #include "zmatrix.hpp"
 
 zmatrix::zmatrix() {
+    rows = 0;
+    cols = 0;
+    maxValue = 0;
     zSum = 0;
 }
 
@@ -37,36 +41,110 @@ zmatrix::zmatrix(int rows, int cols, int maxValue) {
     }
 }
 
+// Unpack a 6x6 packed matrix
+//  maxValue should be 1 for case matrices and 3 for patterns
+zmatrix::zmatrix(const packedMatrix &packed, int maxValue) : zmatrix(packedMatrix::ROWS, packedMatrix::COLS, maxValue) {
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            z[i][j] = packed.get(i, j);
+        }
+    }
+    updateMetadata();
+}
+
+bool zmatrix::isPackable() const {
+    if (rows != packedMatrix::ROWS || cols != packedMatrix::COLS) return false;
+    return maxValue <= packedMatrix::MAX_VALUE;
+}
+
+packedMatrix zmatrix::toPacked() const {
+    if (!isPackable()) throw std::runtime_error(std::format("Can't pack a {}x{} matrix with max value {}", rows, cols, maxValue));
+    return packAs<packedMatrix>();
+}
+
+int zmatrix::bitPlaneSize() const {
+    if (rows != cols || maxValue > packedMatrix::MAX_VALUE) return 0;
+    return (rows == packedMatrix4::ROWS || rows == packedMatrix::ROWS || rows == packedMatrix8::ROWS) ? rows : 0;
+}
+
+template <typename Packed>
+Packed zmatrix::packAs() const {
+    Packed packed;
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            if (z[i][j] < 0 || z[i][j] > Packed::MAX_VALUE) throw std::runtime_error(std::format("Value {} can't be packed", z[i][j]));
+            packed.set(i, j, z[i][j]);
+        }
+    }
+    return packed;
+}
+
+packedMatrix zmatrix::canonicalForm() const {
+    return toPacked().canonical();
+}
+
+uint64_t zmatrix::canonicalHash() const {
+    return canonicalForm().hash();
+}
+
 // TODO - Add row / column sum sorting -> highest to the top left
 // Update the metadata for the matrix
 // This includes the sum, number counts, row counts, column counts, and counts of counts
+//  along with the pair counts and the fingerprint
+// Everything is recounted right away and values are checked, use invalidateMetadata() to defer this
 void zmatrix::updateMetadata() {
+    computeCounts();
+    computePairCounts();
+    computeValuePairCounts();
+    computeFingerprint();
+}
+
+void zmatrix::updatePairCounts() {
+    computePairCounts();
+    computeValuePairCounts();
+    fingerprintValid = false;
+}
+
+// Mark every metadata tier as stale after z has been changed directly
+//  Each tier is recounted the next time something asks for it
+void zmatrix::invalidateMetadata() {
+    countsValid = false;
+    pairCountsValid = false;
+    valuePairCountsValid = false;
+    fingerprintValid = false;
+}
+
+// These only recount a tier if it is stale
+void zmatrix::ensureCounts() const {
+    if (!countsValid) computeCounts();
+}
+
+void zmatrix::ensurePairCounts() const {
+    if (!pairCountsValid) computePairCounts();
+}
+
+void zmatrix::ensureValuePairCounts() const {
+    if (!valuePairCountsValid) computeValuePairCounts();
+}
+
+void zmatrix::ensureFingerprint() const {
+    if (!fingerprintValid) computeFingerprint();
+}
+
+// Resize a 2-D count table and zero it without giving up the memory it already has
+static void resetCounts(std::vector<std::vector<int>> &counts, int outer, int inner) {
+    counts.resize(outer);
+    for (auto &row : counts) row.assign(inner, 0);
+}
+
+void zmatrix::computeCounts() const {
     // Reset all the counts to 0
     zSum = 0;
-    // TODO - Make new vectors here to speed this up
-    for (int i = 0; i < zNumCounts.size(); i++) {
-        zNumCounts[i] = 0;
-    }
-    for (int i = 0; i < zRowCounts.size(); i++) {
-        for (int j = 0; j < zRowCounts[i].size(); j++) {
-            zRowCounts[i][j] = 0;
-        }
-    }
-    for (int i = 0; i < zColCounts.size(); i++) {
-        for (int j = 0; j < zColCounts[i].size(); j++) {
-            zColCounts[i][j] = 0;
-        }
-    }
-    for (int i = 0; i < zCountRows.size(); i++) {
-        for (int j = 0; j < zCountRows[i].size(); j++) {
-            zCountRows[i][j] = 0;
-        }
-    }
-    for (int i = 0; i < zCountCols.size(); i++) {
-        for (int j = 0; j < zCountCols[i].size(); j++) {
-            zCountCols[i][j] = 0;
-        }
-    }
+    zNumCounts.assign(maxValue+1, 0);
+    resetCounts(zRowCounts, rows, maxValue+1);
+    resetCounts(zColCounts, cols, maxValue+1);
+    resetCounts(zCountRows, maxValue+1, rows+1);
+    resetCounts(zCountCols, maxValue+1, cols+1);
     // Update the counts
     for (int i = 0; i < z.size(); i++) {
         for (int j = 0; j < z[i].size(); j++) {
@@ -90,89 +168,139 @@ void zmatrix::updateMetadata() {
             zCountCols[j][zColCounts[i][j]]++;
         }
     }
-    updatePairCounts();
+    countsValid = true;
 }
 
-void zmatrix::updatePairCounts(){
-    rowPairCountsTotals.clear();
-    rowPairCountsTotals.resize(rows+1);
-    colPairCountsTotals.clear();
-    colPairCountsTotals.resize(cols+1);
-    // Reset the pair counts
-    rowPairCounts.clear();
-    rowPairCounts.resize(rows);
-    for (int i = 0; i < rows; i++) {
-        rowPairCounts[i].resize(rows);
-    }
-    colPairCounts.clear();
-    colPairCounts.resize(cols);
-    for (int i = 0; i < cols; i++) {
-        colPairCounts[i].resize(cols);
-    }
-    // Reset the value pair counts
-    rowValuePairCountsTotals.clear();
-    rowValuePairCountsTotals.resize(rows+1);
-    for (int i = 0; i < rowValuePairCountsTotals.size(); i++) {
-        rowValuePairCountsTotals[i].resize(maxValue+1);
-    }
-    colValuePairCountsTotals.clear();
-    colValuePairCountsTotals.resize(cols+1);
-    for (int i = 0; i < colValuePairCountsTotals.size(); i++) {
-        colValuePairCountsTotals[i].resize(maxValue+1);
+void zmatrix::computePairCounts() const {
+    resetCounts(rowPairCounts, rows, rows);
+    resetCounts(colPairCounts, cols, cols);
+    // Totals are indexed by pair count -> a row pair can match in up to cols places, a column pair in up to rows
+    rowPairCountsTotals.assign(cols+1, 0);
+    colPairCountsTotals.assign(rows+1, 0);
+    // Matrices with a bitPlaneMatrix instance get their pair counts from the bit planes
+    int size = bitPlaneSize();
+    if (size == packedMatrix4::ROWS) {
+        computeBitPlanePairCounts<packedMatrix4>();
+    } else if (size == packedMatrix::ROWS) {
+        computeBitPlanePairCounts<packedMatrix>();
+    } else if (size == packedMatrix8::ROWS) {
+        computeBitPlanePairCounts<packedMatrix8>();
+    } else {
+        // Now to update the pair counts
+        //  A row compared with itself matches in every column and a column with itself in every row
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < rows; j++) {
+                if (i == j) {
+                    rowPairCounts[i][j] = cols;
+                    continue;
+                }
+                for (int k = 0; k < cols; k++) {
+                    if (z[i][k] == z[j][k]) rowPairCounts[i][j]++;
+                }
+            }
+        }
+        for (int i = 0; i < cols; i++) {
+            for (int j = 0; j < cols; j++) {
+                if (i == j) {
+                    colPairCounts[i][j] = rows;
+                    continue;
+                }
+                for (int k = 0; k < rows; k++) {
+                    if (z[k][i] == z[k][j]) colPairCounts[i][j]++;
+                }
+            }
+        }
     }
-    rowValuePairCounts.clear();
-    rowValuePairCounts.resize(rows);
-    colValuePairCounts.clear();
-    colValuePairCounts.resize(cols);
     for (int i = 0; i < rows; i++) {
-        rowValuePairCounts[i].resize(rows);
         for (int j = 0; j < rows; j++) {
-            rowValuePairCounts[i][j].resize(maxValue+1);
+            rowPairCountsTotals[rowPairCounts[i][j]]++;
         }
     }
     for (int i = 0; i < cols; i++) {
-        colValuePairCounts[i].resize(cols);
         for (int j = 0; j < cols; j++) {
-            colValuePairCounts[i][j].resize(maxValue+1);
+            colPairCountsTotals[colPairCounts[i][j]]++;
         }
     }
-    
-    // Now to update the pair counts
+    pairCountsValid = true;
+}
+
+template <typename Packed>
+void zmatrix::computeBitPlanePairCounts() const {
+    Packed packed = packAs<Packed>();
+    typename Packed::pairTable pairs;
+    packed.rowPairCounts(pairs);
     for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < rows; j++) {
-            // Initialize the pair counts to 0
-            rowPairCounts[i][j] = 0;
-            colPairCounts[i][j] = 0;
+        std::copy(pairs[i].begin(), pairs[i].end(), rowPairCounts[i].begin());
+    }
+    packed.transposed().rowPairCounts(pairs);
+    for (int i = 0; i < cols; i++) {
+        std::copy(pairs[i].begin(), pairs[i].end(), colPairCounts[i].begin());
+    }
+}
+
+// Copy the packed value pair counts over for the values this matrix can hold
+//  A row / column compared with itself is always set to its full length for every value
+template <typename Table>
+static void copyValuePairCounts(const Table &valuePairs, int length, int maxValue, std::vector<std::vector<std::vector<int>>> &counts) {
+    for (int i = 0; i < counts.size(); i++) {
+        for (int j = 0; j < counts[i].size(); j++) {
             for (int k = 0; k < maxValue+1; k++) {
-                    rowValuePairCounts[i][j][k] = 0;
-                    colValuePairCounts[i][j][k] = 0;
+                counts[i][j][k] = (i == j) ? length : valuePairs[i][j][k];
             }
-            // If i == j, then we are comparing the same row or column so we can skip this and preset values
-            if (i == j) {
-                rowPairCounts[i][j] = 6;
-                colPairCounts[i][j] = 6;
-                for (int k = 0; k < maxValue+1; k++) {
-                    rowValuePairCounts[i][j][k] = 6;
-                    colValuePairCounts[i][j][k] = 6;
+        }
+    }
+}
+
+template <typename Packed>
+void zmatrix::computeBitPlaneValuePairCounts() const {
+    Packed packed = packAs<Packed>();
+    typename Packed::valuePairTable valuePairs;
+    packed.rowValuePairCounts(valuePairs);
+    copyValuePairCounts(valuePairs, cols, maxValue, rowValuePairCounts);
+    packed.transposed().rowValuePairCounts(valuePairs);
+    copyValuePairCounts(valuePairs, rows, maxValue, colValuePairCounts);
+}
+
+void zmatrix::computeValuePairCounts() const {
+    rowValuePairCounts.resize(rows);
+    for (auto &row : rowValuePairCounts) resetCounts(row, rows, maxValue+1);
+    colValuePairCounts.resize(cols);
+    for (auto &col : colValuePairCounts) resetCounts(col, cols, maxValue+1);
+    resetCounts(rowValuePairCountsTotals, cols+1, maxValue+1);
+    resetCounts(colValuePairCountsTotals, rows+1, maxValue+1);
+    int size = bitPlaneSize();
+    if (size == packedMatrix4::ROWS) {
+        computeBitPlaneValuePairCounts<packedMatrix4>();
+    } else if (size == packedMatrix::ROWS) {
+        computeBitPlaneValuePairCounts<packedMatrix>();
+    } else if (size == packedMatrix8::ROWS) {
+        computeBitPlaneValuePairCounts<packedMatrix8>();
+    } else {
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < rows; j++) {
+                if (i == j) {
+                    rowValuePairCounts[i][j].assign(maxValue+1, cols);
+                    continue;
+                }
+                for (int k = 0; k < cols; k++) {
+                    if (z[i][k] == z[j][k]) rowValuePairCounts[i][j][z[i][k]]++;
                 }
-                continue;
             }
-            // Now do the pair counts
-            for (int k = 0; k < cols; k++) {
-                if (z[i][k] == z[j][k]) {
-                    rowPairCounts[i][j]++;
-                    rowValuePairCounts[i][j][z[i][k]]++;
+        }
+        for (int i = 0; i < cols; i++) {
+            for (int j = 0; j < cols; j++) {
+                if (i == j) {
+                    colValuePairCounts[i][j].assign(maxValue+1, rows);
+                    continue;
                 }
-                if (z[k][i] == z[k][j]) {
-                    colPairCounts[i][j]++;
-                    colValuePairCounts[i][j][z[k][i]]++;
+                for (int k = 0; k < rows; k++) {
+                    if (z[k][i] == z[k][j]) colValuePairCounts[i][j][z[k][i]]++;
                 }
             }
         }
     }
     for (int i = 0; i < rows; i++) {
         for (int j = 0; j < rows; j++) {
-            rowPairCountsTotals[rowPairCounts[i][j]]++;
             for (int k = 0; k < maxValue+1; k++) {
                 rowValuePairCountsTotals[rowValuePairCounts[i][j][k]][k]++;
             }
@@ -180,34 +308,77 @@ void zmatrix::updatePairCounts(){
     }
     for (int i = 0; i < cols; i++) {
         for (int j = 0; j < cols; j++) {
-            colPairCountsTotals[colPairCounts[i][j]]++;
             for (int k = 0; k < maxValue+1; k++) {
                 colValuePairCountsTotals[colValuePairCounts[i][j][k]][k]++;
             }
         }
     }
+    valuePairCountsValid = true;
+}
+
+// Fold the counts that don't change under rearrangement into a single 64-bit value
+//  zRowCounts / zColCounts and the pair count tables themselves are left out since they move with the rows and columns
+void zmatrix::computeFingerprint() const {
+    ensureCounts();
+    ensurePairCounts();
+    uint64_t h = 0xcbf29ce484222325ULL;
+    auto add = [&h](uint64_t value) {
+        h ^= value;
+        h *= 0x100000001b3ULL;
+    };
+    add(rows);
+    add(cols);
+    add(maxValue);
+    add(zSum);
+    for (int count : zNumCounts) add(count);
+    for (const auto &counts : zCountRows) for (int count : counts) add(count);
+    for (const auto &counts : zCountCols) for (int count : counts) add(count);
+    for (int count : rowPairCountsTotals) add(count);
+    for (int count : colPairCountsTotals) add(count);
+    // Case matrices only ever compared the counts above so keep them to that
+    if (maxValue != 1) {
+        ensureValuePairCounts();
+        for (const auto &counts : rowValuePairCountsTotals) for (int count : counts) add(count);
+        for (const auto &counts : colValuePairCountsTotals) for (int count : counts) add(count);
+    }
+    fingerprint = h;
+    fingerprintValid = true;
 }
 
+// Swapping rows only moves metadata around, nothing has to be recounted
+//  Row counts and the row (value) pair counts are permuted in place if they have been counted
+//  Everything else is a multiset over rows or columns so it doesn't change
 void zmatrix::swapRows(int i, int j) {
-    std::vector<int> temp;
-    temp = z[i];
-    z[i] = z[j];
-    z[j] = temp;
-    // TODO - This is not the most efficient way to update the metadata, so it should be improved
-    updateMetadata();    
+    if (i == j) return;
+    std::swap(z[i], z[j]);
+    if (countsValid) std::swap(zRowCounts[i], zRowCounts[j]);
+    if (pairCountsValid) swapPairCounts(rowPairCounts, i, j);
+    if (valuePairCountsValid) swapPairCounts(rowValuePairCounts, i, j);
 }
 
+// Same as swapRows but for the columns
 void zmatrix::swapColumns(int i, int j) {
-    for (int k = 0; k < cols; k++) {
-        int temp = z[k][i];
-        z[k][i] = z[k][j];
-        z[k][j] = temp;
+    if (i == j) return;
+    for (int k = 0; k < rows; k++) {
+        std::swap(z[k][i], z[k][j]);
     }
-    // TODO - This is not the most efficient way to update the metadata, so it should be improved
-    updateMetadata();
+    if (countsValid) std::swap(zColCounts[i], zColCounts[j]);
+    if (pairCountsValid) swapPairCounts(colPairCounts, i, j);
+    if (valuePairCountsValid) swapPairCounts(colValuePairCounts, i, j);
 }
 
-int zmatrix::getRowPairValuesCount(int i, int j, std::vector<int> values) {
+// Swap entries i and j on both axes of a symmetric pair count table
+//  The diagonal stays in place so the totals don't change either
+template <typename T>
+void zmatrix::swapPairCounts(std::vector<std::vector<T>> &pairCounts, int i, int j) {
+    std::swap(pairCounts[i], pairCounts[j]);
+    for (int k = 0; k < pairCounts.size(); k++) {
+        std::swap(pairCounts[k][i], pairCounts[k][j]);
+    }
+}
+
+int zmatrix::getRowPairValuesCount(int i, int j, std::vector<int> values) const {
+    ensureValuePairCounts();
     int count = 0;
     for (int k = 0; k < values.size(); k++) {
         count += rowValuePairCounts[i][j][values[k]];
@@ -215,17 +386,18 @@ int zmatrix::getRowPairValuesCount(int i, int j, std::vector<int> values) {
     return count;
 } 
 
-int zmatrix::getColPairValuesCount(int i, int j, std::vector<int> values) {
+int zmatrix::getColPairValuesCount(int i, int j, std::vector<int> values) const {
+    ensureValuePairCounts();
     int count = 0;
     for (int k = 0; k < values.size(); k++) {
-        count += rowValuePairCounts[i][j][values[k]];
+        count += colValuePairCounts[i][j][values[k]];
     }
     return count;
 } 
 
 // Print a debug of the matrix
-void zmatrix::printDebug(std::ostream& os) {
-    
+void zmatrix::printDebug(std::ostream& os) const {
+    ensureCounts();
     // Print the matrix
     os << "Matrix: " << std::endl;
     for (int i = 0; i < z.size(); i++) {
@@ -292,12 +464,14 @@ void zmatrix::printDebug(std::ostream& os) {
     printPairCounts(os);
 }
 
-void zmatrix::printPairCounts(std::ostream& os) {
+void zmatrix::printPairCounts(std::ostream& os) const {
     printRowPairCounts(os);
     printColPairCounts(os);
 }
 
-void zmatrix::printRowPairCounts(std::ostream& os) {
+void zmatrix::printRowPairCounts(std::ostream& os) const {
+    ensurePairCounts();
+    ensureValuePairCounts();
     os << "Row Pair Counts: " << std::endl;
     for (int i = 0; i < rowPairCounts.size(); i++) {
         os << "Row " << i+1 << " = [";
@@ -336,7 +510,9 @@ void zmatrix::printRowPairCounts(std::ostream& os) {
     }
 }
 
-void zmatrix::printColPairCounts(std::ostream& os) {
+void zmatrix::printColPairCounts(std::ostream& os) const {
+    ensurePairCounts();
+    ensureValuePairCounts();
     os << "Column Pair Counts: " << std::endl;
     for (int i = 0; i < colPairCounts.size(); i++) {
         os << "Column " << i+1 << " = [";
@@ -366,14 +542,15 @@ void zmatrix::printColPairCounts(std::ostream& os) {
     }
 }
 
-void zmatrix::printCounts(std::ostream& os) {
+void zmatrix::printCounts(std::ostream& os) const {
     printRowCounts(os);
     printColCounts(os);
     printCountRows(os);
     printCountCols(os);
 }
 
-void zmatrix::printRowCounts(std::ostream& os) {
+void zmatrix::printRowCounts(std::ostream& os) const {
+    ensureCounts();
     os << "Row Counts: " << std::endl;
     for (int i = 0; i < zRowCounts.size(); i++) {
         os << "Row " << i+1 << " = [";
@@ -385,7 +562,8 @@ void zmatrix::printRowCounts(std::ostream& os) {
     }
 }
 
-void zmatrix::printColCounts(std::ostream& os) {
+void zmatrix::printColCounts(std::ostream& os) const {
+    ensureCounts();
     os << "Column Counts: " << std::endl;
     for (int i = 0; i < zColCounts.size(); i++) {
         os << "Column " << i+1 << " = [";
@@ -397,7 +575,8 @@ void zmatrix::printColCounts(std::ostream& os) {
     }
 }
 
-void zmatrix::printCountRows(std::ostream& os) {
+void zmatrix::printCountRows(std::ostream& os) const {
+    ensureCounts();
     os << "Count of Rows with: " << std::endl;
     for (int i = 0; i < zCountRows.size(); i++) {
         os << "Value " << i << " = [";
@@ -409,7 +588,8 @@ void zmatrix::printCountRows(std::ostream& os) {
     }
 }
 
-void zmatrix::printCountCols(std::ostream& os) {
+void zmatrix::printCountCols(std::ostream& os) const {
+    ensureCounts();
     os << "Count of Columns with: " << std::endl;
     for (int i = 0; i < zCountCols.size(); i++) {
         os << "Value " << i << " = [";
@@ -442,6 +622,22 @@ bool zmatrix::operator==(const zmatrix &other) const {
     if (rows != other.rows) return false;
     if (cols != other.cols) return false;
     if (maxValue != other.maxValue) return false;
+    // Anything with different invariant counts is rejected here with a single compare
+    ensureFingerprint();
+    other.ensureFingerprint();
+    if (fingerprint != other.fingerprint) return false;
+    // maxValue == 1 means that this a case pattern and not an actual pattern so we do not need to check for a rearrange match
+    // This should probably be a flag or something else
+    // TODO - Refactor this to make the maxValue == 1 => Case Matrix more explicit
+    //  The fingerprint could collide so the counts have to be checked one by one here
+    if (maxValue == 1) return invariantsMatch(other);
+    // 6x6 patterns can compare canonical forms instead of searching all the row / column mappings
+    if (isPackable()) return canonicalForm() == other.canonicalForm();
+    return rearrangeMatch(other);
+}
+
+// The full set of count checks that the fingerprint stands in for
+bool zmatrix::invariantsMatch(const zmatrix &other) const {
     if (zSum != other.zSum) return false;
     if (zNumCounts != other.zNumCounts) return false;
     if (zRowCounts.size() != other.zRowCounts.size()) return false;
@@ -475,16 +671,14 @@ bool zmatrix::operator==(const zmatrix &other) const {
             return false;
         }
     }
-    // maxValue == 1 means that this a case pattern and not an actual pattern so we do not need to check for a rearrange match
-    // This should probably be a flag or something else
-    // TODO - Refactor this to make the maxValue == 1 => Case Matrix more explicit
-    if (maxValue == 1) return true;
-    return rearrangeMatch(other);
+    return true;
 }
 
 bool zmatrix::rearrangeMatch(const zmatrix &other) const {
     // attempt a strict match first before attempting to rearrange to match
     if (strictMatch(other)) return true;
+    ensureCounts();
+    other.ensureCounts();
     zmatrix newZ(rows, cols, maxValue);
     // if the row counts and column counts match, then we can map the rows and columns
     // i is the row index of z, j is the row index of other
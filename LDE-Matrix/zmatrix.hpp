@@ -8,63 +8,133 @@
 #include <vector>
 #include <sstream>
 
+#include "packed-matrix.hpp"
+
 // Attempting to generalize the pattern and case matrices into a single class
 class zmatrix {
     public:
         zmatrix();
         zmatrix(int rows, int cols, int maxValue);
+        zmatrix(const packedMatrix &packed, int maxValue = packedMatrix::MAX_VALUE);
 
         // These are the flags for the zmatrix
         bool multilineOutput = false;
 
         std::vector<std::vector<int>> z;
-        int zSum;
-        std::vector<int> zNumCounts; // Count of the number of 0s, 1s, 2s, 3s, ..., n's in the matrix
-        std::vector<std::vector<int>> zRowCounts;  // Count of the number of 0s, 1s, 2s, 3s, ..., n's in each row
-        std::vector<std::vector<int>> zColCounts;  // Count of the number of 0s, 1s, 2s, 3s, ..., n's in each column
-        std::vector<std::vector<int>> zCountRows;  // Number of rows with a count of  0, 1, 2, 3, 4, 5, 6, ..n (based on columns) of 0s, 1s, 2s, 3s, ..., n's
-        std::vector<std::vector<int>> zCountCols;  // Number of columns with a count of 0, 1, 2, 3, 4, 5, 6, ..n (based on rows) of 0s, 1s, 2s, 3s, ..., n's
-        // These are the pair counts for the matrix when comparing row[i] to row[j] and col[i] to col[j]
-        std::vector<std::vector<int>> rowPairCounts;  // This is the row pair counts for the pattern
-        std::vector<std::vector<int>> colPairCounts;  // This is the col pair counts for the pattern
-        // The following totals are counts of the pair counts
-        //  i=0 -> number of rows/cols with no pairs, i=2 -> number of rows/cols with 2 pairs, i=4 -> number of rows/cols with 4 pairs, i=6 -> number of rows/cols with 6 pairs
-        std::vector<int> rowPairCountsTotals;  // This contains the totals of the row pair counts for the pattern 
-        std::vector<int> colPairCountsTotals;  // This contains the totals of the col pair counts for the pattern
-        // These are the pair counts for the matrix when comparing row[i] to row[j] and col[i] to col[j] but split out by value
-        std::vector<std::vector<std::vector<int>>> rowValuePairCounts;  // This contains the pair counts for each value in the row vs another row
-        std::vector<std::vector<std::vector<int>>> colValuePairCounts;  // This contains the pair counts for each value in the col vs another col
-        // The following totals are counts of the pair value counts
-        //  i=0 -> number of rows/cols with no pairs for each value, i=2 -> number of rows/cols with 2 pairs for each value, i=4 -> number of rows/cols with 4 pairs for each value, i=6 -> number of rows/cols with 6 pairs for each value
-        std::vector<std::vector<int>> rowValuePairCountsTotals;  // This contains the counts for each value in the row
-        std::vector<std::vector<int>> colValuePairCountsTotals;  // This contains the counts for each value in the col
+        // The metadata is counted lazily in tiers, every accessor below recounts its tier first if it is stale
+        //  counts -> getSum, getNumCounts, getRowCounts, getColCounts, getCountRows, getCountCols
+        //  pair counts -> getRowPairCounts, getColPairCounts and their totals
+        //  value pair counts -> getRowValuePairCounts, getColValuePairCounts and their totals
+        //  fingerprint
+        // Anything that writes z directly has to call invalidateMetadata() (or updateMetadata()) afterwards
+        int getSum() const { ensureCounts(); return zSum; }
+        const std::vector<int>& getNumCounts() const { ensureCounts(); return zNumCounts; }
+        const std::vector<std::vector<int>>& getRowCounts() const { ensureCounts(); return zRowCounts; }
+        const std::vector<std::vector<int>>& getColCounts() const { ensureCounts(); return zColCounts; }
+        const std::vector<std::vector<int>>& getCountRows() const { ensureCounts(); return zCountRows; }
+        const std::vector<std::vector<int>>& getCountCols() const { ensureCounts(); return zCountCols; }
+        const std::vector<std::vector<int>>& getRowPairCounts() const { ensurePairCounts(); return rowPairCounts; }
+        const std::vector<std::vector<int>>& getColPairCounts() const { ensurePairCounts(); return colPairCounts; }
+        const std::vector<int>& getRowPairCountsTotals() const { ensurePairCounts(); return rowPairCountsTotals; }
+        const std::vector<int>& getColPairCountsTotals() const { ensurePairCounts(); return colPairCountsTotals; }
+        const std::vector<std::vector<std::vector<int>>>& getRowValuePairCounts() const { ensureValuePairCounts(); return rowValuePairCounts; }
+        const std::vector<std::vector<std::vector<int>>>& getColValuePairCounts() const { ensureValuePairCounts(); return colValuePairCounts; }
+        const std::vector<std::vector<int>>& getRowValuePairCountsTotals() const { ensureValuePairCounts(); return rowValuePairCountsTotals; }
+        const std::vector<std::vector<int>>& getColValuePairCountsTotals() const { ensureValuePairCounts(); return colValuePairCountsTotals; }
+        uint64_t getFingerprint() const { ensureFingerprint(); return fingerprint; }
+        // True once the pair count / value pair count tier has been counted for the current z
+        bool hasPairCounts() const { return pairCountsValid; }
+        bool hasValuePairCounts() const { return valuePairCountsValid; }
 
         void updateMetadata();
         void updatePairCounts();
+        void invalidateMetadata();
         void swapRows(int i, int j);
         void swapColumns(int i, int j);
 
+        int getRows() const { return rows; }
+        int getCols() const { return cols; }
+        int getMaxValue() const { return maxValue; }
+
+        // Only 6x6 matrices with values in 0-3 can be packed
+        bool isPackable() const;
+        packedMatrix toPacked() const;
+        // Canonical form / hash -> equal for any two matrices that are rearrangements of each other
+        packedMatrix canonicalForm() const;
+        uint64_t canonicalHash() const;
+
         // These are used to find pair counts
-        int getRowPairValuesCount(int i, int j, std::vector<int> values); //m.count(key) == 1
-        int getColPairValuesCount(int i, int j, std::vector<int> values); //m.count(key) == 1
+        int getRowPairValuesCount(int i, int j, std::vector<int> values) const; //m.count(key) == 1
+        int getColPairValuesCount(int i, int j, std::vector<int> values) const; //m.count(key) == 1
 
         bool operator==(const zmatrix &) const;  // Read the comments in zmatrix.cpp for more information on what equality means
         bool operator!=(const zmatrix &) const;
         bool rearrangeMatch(const zmatrix &other) const;
         bool strictMatch(const zmatrix &other) const;
 
-        void printDebug(std::ostream&);
-        void printPairCounts(std::ostream&);
-        void printRowPairCounts(std::ostream&);
-        void printColPairCounts(std::ostream&);
-        void printCounts(std::ostream&);
-        void printRowCounts(std::ostream&);
-        void printColCounts(std::ostream&);
-        void printCountRows(std::ostream&);
-        void printCountCols(std::ostream&);
+        void printDebug(std::ostream&) const;
+        void printPairCounts(std::ostream&) const;
+        void printRowPairCounts(std::ostream&) const;
+        void printColPairCounts(std::ostream&) const;
+        void printCounts(std::ostream&) const;
+        void printRowCounts(std::ostream&) const;
+        void printColCounts(std::ostream&) const;
+        void printCountRows(std::ostream&) const;
+        void printCountCols(std::ostream&) const;
         friend std::ostream& operator<<(std::ostream&,const zmatrix &);
     
     private:
+        // Metadata tiers, read them through the accessors so a stale tier is never seen
+        //  updateMetadata() counts every tier right away
+        mutable int zSum;
+        mutable std::vector<int> zNumCounts; // Count of the number of 0s, 1s, 2s, 3s, ..., n's in the matrix
+        mutable std::vector<std::vector<int>> zRowCounts;  // Count of the number of 0s, 1s, 2s, 3s, ..., n's in each row
+        mutable std::vector<std::vector<int>> zColCounts;  // Count of the number of 0s, 1s, 2s, 3s, ..., n's in each column
+        mutable std::vector<std::vector<int>> zCountRows;  // Number of rows with a count of  0, 1, 2, 3, 4, 5, 6, ..n (based on columns) of 0s, 1s, 2s, 3s, ..., n's
+        mutable std::vector<std::vector<int>> zCountCols;  // Number of columns with a count of 0, 1, 2, 3, 4, 5, 6, ..n (based on rows) of 0s, 1s, 2s, 3s, ..., n's
+        // These are the pair counts for the matrix when comparing row[i] to row[j] and col[i] to col[j]
+        mutable std::vector<std::vector<int>> rowPairCounts;  // This is the row pair counts for the pattern
+        mutable std::vector<std::vector<int>> colPairCounts;  // This is the col pair counts for the pattern
+        // The following totals are counts of the pair counts
+        //  i=0 -> number of rows/cols with no pairs, i=2 -> number of rows/cols with 2 pairs, i=4 -> number of rows/cols with 4 pairs, i=6 -> number of rows/cols with 6 pairs
+        mutable std::vector<int> rowPairCountsTotals;  // This contains the totals of the row pair counts for the pattern 
+        mutable std::vector<int> colPairCountsTotals;  // This contains the totals of the col pair counts for the pattern
+        // These are the pair counts for the matrix when comparing row[i] to row[j] and col[i] to col[j] but split out by value
+        mutable std::vector<std::vector<std::vector<int>>> rowValuePairCounts;  // This contains the pair counts for each value in the row vs another row
+        mutable std::vector<std::vector<std::vector<int>>> colValuePairCounts;  // This contains the pair counts for each value in the col vs another col
+        // The following totals are counts of the pair value counts
+        //  i=0 -> number of rows/cols with no pairs for each value, i=2 -> number of rows/cols with 2 pairs for each value, i=4 -> number of rows/cols with 4 pairs for each value, i=6 -> number of rows/cols with 6 pairs for each value
+        mutable std::vector<std::vector<int>> rowValuePairCountsTotals;  // This contains the counts for each value in the row
+        mutable std::vector<std::vector<int>> colValuePairCountsTotals;  // This contains the counts for each value in the col
+        // All of the rearrangement invariant counts above folded into one value
+        //  Matrices with different fingerprints can never be equal
+        mutable uint64_t fingerprint = 0;
+
+        void ensureCounts() const;
+        void ensurePairCounts() const;
+        void ensureValuePairCounts() const;
+        void ensureFingerprint() const;
+        void computeCounts() const;
+        void computePairCounts() const;
+        void computeValuePairCounts() const;
+        void computeFingerprint() const;
+        // Square 4x4, 6x6 and 8x8 matrices with values in 0-3 have a bitPlaneMatrix to count their pairs on, 0 for any other shape
+        int bitPlaneSize() const;
+        template <typename Packed>
+        Packed packAs() const;
+        template <typename Packed>
+        void computeBitPlanePairCounts() const;
+        template <typename Packed>
+        void computeBitPlaneValuePairCounts() const;
+        bool invariantsMatch(const zmatrix &other) const;
+        template <typename T>
+        static void swapPairCounts(std::vector<std::vector<T>> &pairCounts, int i, int j);
+
+        mutable bool countsValid = false;
+        mutable bool pairCountsValid = false;
+        mutable bool valuePairCountsValid = false;
+        mutable bool fingerprintValid = false;
+
         int rows;
         int cols;
         int maxValue;
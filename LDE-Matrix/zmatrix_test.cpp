@@ -91,29 +91,29 @@ std::vector<std::vector<int>> REARRANGE_A_2 = {
 
 TEST(ZMatrixTest, DefaultZMatrixConstructor) {
     zmatrix z = zmatrix();
-    EXPECT_EQ(z.zSum, 0);
+    EXPECT_EQ(z.getSum(), 0);
 }
 
 TEST(ZMatrixTest, ZMatrixConstructor) {
     zmatrix zCase = zmatrix(ROWS, COLS, CASE_MAX_VALUE);
     EXPECT_EQ(zCase.z.size(), ROWS);
     EXPECT_EQ(zCase.z[0].size(), COLS);
-    EXPECT_EQ(zCase.zSum, 0);
-    EXPECT_EQ(zCase.zNumCounts.size(), CASE_MAX_VALUE+1);
-    EXPECT_EQ(zCase.zRowCounts.size(), ROWS);
-    EXPECT_EQ(zCase.zColCounts.size(), COLS);
-    EXPECT_EQ(zCase.zCountRows.size(), CASE_MAX_VALUE+1);
-    EXPECT_EQ(zCase.zCountCols.size(), CASE_MAX_VALUE+1);
+    EXPECT_EQ(zCase.getSum(), 0);
+    EXPECT_EQ(zCase.getNumCounts().size(), CASE_MAX_VALUE+1);
+    EXPECT_EQ(zCase.getRowCounts().size(), ROWS);
+    EXPECT_EQ(zCase.getColCounts().size(), COLS);
+    EXPECT_EQ(zCase.getCountRows().size(), CASE_MAX_VALUE+1);
+    EXPECT_EQ(zCase.getCountCols().size(), CASE_MAX_VALUE+1);
 
     zmatrix zPattern = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
     EXPECT_EQ(zPattern.z.size(), ROWS);
     EXPECT_EQ(zPattern.z[0].size(), COLS);
-    EXPECT_EQ(zPattern.zSum, 0);
-    EXPECT_EQ(zPattern.zNumCounts.size(), PATTERN_MAX_VALUE+1);
-    EXPECT_EQ(zPattern.zRowCounts.size(), ROWS);
-    EXPECT_EQ(zPattern.zColCounts.size(), COLS);
-    EXPECT_EQ(zPattern.zCountRows.size(), PATTERN_MAX_VALUE+1);
-    EXPECT_EQ(zPattern.zCountCols.size(), PATTERN_MAX_VALUE+1);
+    EXPECT_EQ(zPattern.getSum(), 0);
+    EXPECT_EQ(zPattern.getNumCounts().size(), PATTERN_MAX_VALUE+1);
+    EXPECT_EQ(zPattern.getRowCounts().size(), ROWS);
+    EXPECT_EQ(zPattern.getColCounts().size(), COLS);
+    EXPECT_EQ(zPattern.getCountRows().size(), PATTERN_MAX_VALUE+1);
+    EXPECT_EQ(zPattern.getCountCols().size(), PATTERN_MAX_VALUE+1);
 }
 
 TEST(ZMatrixTest, ZMatrixCasesUpdateMetadata) {
@@ -122,94 +122,94 @@ TEST(ZMatrixTest, ZMatrixCasesUpdateMetadata) {
     // Case 1
     zCase.z = CASE1;
     zCase.updateMetadata();
-    EXPECT_EQ(zCase.zSum, 4);
-    EXPECT_EQ(zCase.zNumCounts[0], 32);
-    EXPECT_EQ(zCase.zNumCounts[1], 4);
+    EXPECT_EQ(zCase.getSum(), 4);
+    EXPECT_EQ(zCase.getNumCounts()[0], 32);
+    EXPECT_EQ(zCase.getNumCounts()[1], 4);
     for (int i = 0; i < ROWS; i++) {
         if (i==0 || i==1) {
-            EXPECT_EQ(zCase.zRowCounts[i][0], 4);
-            EXPECT_EQ(zCase.zRowCounts[i][1], 2);
+            EXPECT_EQ(zCase.getRowCounts()[i][0], 4);
+            EXPECT_EQ(zCase.getRowCounts()[i][1], 2);
         } else {
-            EXPECT_EQ(zCase.zRowCounts[i][0], 6);
-            EXPECT_EQ(zCase.zRowCounts[i][1], 0);
+            EXPECT_EQ(zCase.getRowCounts()[i][0], 6);
+            EXPECT_EQ(zCase.getRowCounts()[i][1], 0);
         }
     }
     for (int i = 0; i < COLS; i++) {
         if (i==0 || i==1) {
-            EXPECT_EQ(zCase.zColCounts[i][0], 4);
-            EXPECT_EQ(zCase.zColCounts[i][1], 2);
+            EXPECT_EQ(zCase.getColCounts()[i][0], 4);
+            EXPECT_EQ(zCase.getColCounts()[i][1], 2);
         } else {
-            EXPECT_EQ(zCase.zColCounts[i][0], 6);
-            EXPECT_EQ(zCase.zColCounts[i][1], 0);
+            EXPECT_EQ(zCase.getColCounts()[i][0], 6);
+            EXPECT_EQ(zCase.getColCounts()[i][1], 0);
         }
     }
     // i is the value we are counting, j count of the value, zCountRows[i][j] = count of rows with j count of i
-    for (int i = 0; i < zCase.zCountRows.size(); i++) {
-        for (int j = 0; j < zCase.zCountRows[i].size(); j++) {
+    for (int i = 0; i < zCase.getCountRows().size(); i++) {
+        for (int j = 0; j < zCase.getCountRows()[i].size(); j++) {
             if (i == 0 && j ==4) {
-                EXPECT_EQ(zCase.zCountRows[i][j], 2);
+                EXPECT_EQ(zCase.getCountRows()[i][j], 2);
             } else if (i == 0 && j ==6) {
-                EXPECT_EQ(zCase.zCountRows[i][j], 4);
+                EXPECT_EQ(zCase.getCountRows()[i][j], 4);
             } else if (i == 1 && j ==0) {
-                EXPECT_EQ(zCase.zCountRows[i][j], 4);
+                EXPECT_EQ(zCase.getCountRows()[i][j], 4);
             } else if (i == 1 && j ==2) {
-                EXPECT_EQ(zCase.zCountRows[i][j], 2);
+                EXPECT_EQ(zCase.getCountRows()[i][j], 2);
             } else {
-                EXPECT_EQ(zCase.zCountRows[i][j], 0);
+                EXPECT_EQ(zCase.getCountRows()[i][j], 0);
             }
         }
     }
     // i is the value we are counting, j count of the value, zCountCols[i][j] = count of cols with j count of i
-    for (int i = 0; i < zCase.zCountCols.size(); i++) {
-        for (int j = 0; j < zCase.zCountCols[i].size(); j++) {
+    for (int i = 0; i < zCase.getCountCols().size(); i++) {
+        for (int j = 0; j < zCase.getCountCols()[i].size(); j++) {
             if (i == 0 && j ==4) {
-                EXPECT_EQ(zCase.zCountCols[i][j], 2);
+                EXPECT_EQ(zCase.getCountCols()[i][j], 2);
             } else if (i == 0 && j ==6) {
-                EXPECT_EQ(zCase.zCountCols[i][j], 4);
+                EXPECT_EQ(zCase.getCountCols()[i][j], 4);
             } else if (i == 1 && j ==0) {
-                EXPECT_EQ(zCase.zCountCols[i][j], 4);
+                EXPECT_EQ(zCase.getCountCols()[i][j], 4);
             } else if (i == 1 && j ==2) {
-                EXPECT_EQ(zCase.zCountCols[i][j], 2);
+                EXPECT_EQ(zCase.getCountCols()[i][j], 2);
             } else {
-                EXPECT_EQ(zCase.zCountCols[i][j], 0);
+                EXPECT_EQ(zCase.getCountCols()[i][j], 0);
             }
         }
     }
     // Case 7
     zCase.z = CASE7;
     zCase.updateMetadata();
-    EXPECT_EQ(zCase.zSum, 12);
-    EXPECT_EQ(zCase.zNumCounts[0], 24);
-    EXPECT_EQ(zCase.zNumCounts[1], 12);
+    EXPECT_EQ(zCase.getSum(), 12);
+    EXPECT_EQ(zCase.getNumCounts()[0], 24);
+    EXPECT_EQ(zCase.getNumCounts()[1], 12);
     for (int i = 0; i < ROWS; i++) {
-            EXPECT_EQ(zCase.zRowCounts[i][0], 4);
-            EXPECT_EQ(zCase.zRowCounts[i][1], 2);
+            EXPECT_EQ(zCase.getRowCounts()[i][0], 4);
+            EXPECT_EQ(zCase.getRowCounts()[i][1], 2);
     }
     for (int i = 0; i < COLS; i++) {
-            EXPECT_EQ(zCase.zColCounts[i][0], 4);
-            EXPECT_EQ(zCase.zColCounts[i][1], 2);
+            EXPECT_EQ(zCase.getColCounts()[i][0], 4);
+            EXPECT_EQ(zCase.getColCounts()[i][1], 2);
     }
     // i is the value we are counting, j count of the value, zCountRows[i][j] = count of rows with j count of i
-    for (int i = 0; i < zCase.zCountRows.size(); i++) {
-        for (int j = 0; j < zCase.zCountRows[i].size(); j++) {
+    for (int i = 0; i < zCase.getCountRows().size(); i++) {
+        for (int j = 0; j < zCase.getCountRows()[i].size(); j++) {
             if (i == 0 && j ==4) {
-                EXPECT_EQ(zCase.zCountRows[i][j], 6);
+                EXPECT_EQ(zCase.getCountRows()[i][j], 6);
             } else if (i == 1 && j ==2) {
-                EXPECT_EQ(zCase.zCountRows[i][j], 6);
+                EXPECT_EQ(zCase.getCountRows()[i][j], 6);
             } else {
-                EXPECT_EQ(zCase.zCountRows[i][j], 0);
+                EXPECT_EQ(zCase.getCountRows()[i][j], 0);
             }
         }
     }
     // i is the value we are counting, j count of the value, zCountCols[i][j] = count of cols with j count of i
-    for (int i = 0; i < zCase.zCountCols.size(); i++) {
-        for (int j = 0; j < zCase.zCountCols[i].size(); j++) {
+    for (int i = 0; i < zCase.getCountCols().size(); i++) {
+        for (int j = 0; j < zCase.getCountCols()[i].size(); j++) {
             if (i == 0 && j ==4) {
-                EXPECT_EQ(zCase.zCountCols[i][j], 6);
+                EXPECT_EQ(zCase.getCountCols()[i][j], 6);
             } else if (i == 1 && j ==2) {
-                EXPECT_EQ(zCase.zCountCols[i][j], 6);
+                EXPECT_EQ(zCase.getCountCols()[i][j], 6);
             } else {
-                EXPECT_EQ(zCase.zCountCols[i][j], 0);
+                EXPECT_EQ(zCase.getCountCols()[i][j], 0);
             }
         }
     }
@@ -221,32 +221,32 @@ TEST(ZMatrixTest, ZMatrixPatternsUpdateMetadata) {
     // Pattern A
     zPattern.z = PATTERN_A;
     zPattern.updateMetadata();
-    EXPECT_EQ(zPattern.zSum, 30);
-    EXPECT_EQ(zPattern.zNumCounts[0], 24);
-    EXPECT_EQ(zPattern.zNumCounts[1], 0);
-    EXPECT_EQ(zPattern.zNumCounts[2], 6);
-    EXPECT_EQ(zPattern.zNumCounts[3], 6);
+    EXPECT_EQ(zPattern.getSum(), 30);
+    EXPECT_EQ(zPattern.getNumCounts()[0], 24);
+    EXPECT_EQ(zPattern.getNumCounts()[1], 0);
+    EXPECT_EQ(zPattern.getNumCounts()[2], 6);
+    EXPECT_EQ(zPattern.getNumCounts()[3], 6);
     for (int i = 0; i < ROWS; i++) {
         switch (i) {
             case 0: case 1: {
-                EXPECT_EQ(zPattern.zRowCounts[i][0], 4);
-                EXPECT_EQ(zPattern.zRowCounts[i][1], 0);
-                EXPECT_EQ(zPattern.zRowCounts[i][2], 1);
-                EXPECT_EQ(zPattern.zRowCounts[i][3], 1);
+                EXPECT_EQ(zPattern.getRowCounts()[i][0], 4);
+                EXPECT_EQ(zPattern.getRowCounts()[i][1], 0);
+                EXPECT_EQ(zPattern.getRowCounts()[i][2], 1);
+                EXPECT_EQ(zPattern.getRowCounts()[i][3], 1);
                 break;
             }
             case 2: case 3: {
-                EXPECT_EQ(zPattern.zRowCounts[i][0], 4);
-                EXPECT_EQ(zPattern.zRowCounts[i][1], 0);
-                EXPECT_EQ(zPattern.zRowCounts[i][2], 0);
-                EXPECT_EQ(zPattern.zRowCounts[i][3], 2);
+                EXPECT_EQ(zPattern.getRowCounts()[i][0], 4);
+                EXPECT_EQ(zPattern.getRowCounts()[i][1], 0);
+                EXPECT_EQ(zPattern.getRowCounts()[i][2], 0);
+                EXPECT_EQ(zPattern.getRowCounts()[i][3], 2);
                 break;
             }
             case 4: case 5: {
-                EXPECT_EQ(zPattern.zRowCounts[i][0], 4);
-                EXPECT_EQ(zPattern.zRowCounts[i][1], 0);
-                EXPECT_EQ(zPattern.zRowCounts[i][2], 2);
-                EXPECT_EQ(zPattern.zRowCounts[i][3], 0);
+                EXPECT_EQ(zPattern.getRowCounts()[i][0], 4);
+                EXPECT_EQ(zPattern.getRowCounts()[i][1], 0);
+                EXPECT_EQ(zPattern.getRowCounts()[i][2], 2);
+                EXPECT_EQ(zPattern.getRowCounts()[i][3], 0);
                 break;
             }
             default: {
@@ -257,24 +257,24 @@ TEST(ZMatrixTest, ZMatrixPatternsUpdateMetadata) {
     for (int i = 0; i < COLS; i++) {
         switch (i) {
             case 0: case 1: {
-                EXPECT_EQ(zPattern.zColCounts[i][0], 4);
-                EXPECT_EQ(zPattern.zColCounts[i][1], 0);
-                EXPECT_EQ(zPattern.zColCounts[i][2], 1);
-                EXPECT_EQ(zPattern.zColCounts[i][3], 1);
+                EXPECT_EQ(zPattern.getColCounts()[i][0], 4);
+                EXPECT_EQ(zPattern.getColCounts()[i][1], 0);
+                EXPECT_EQ(zPattern.getColCounts()[i][2], 1);
+                EXPECT_EQ(zPattern.getColCounts()[i][3], 1);
                 break;
             }
             case 2: case 3: {
-                EXPECT_EQ(zPattern.zColCounts[i][0], 4);
-                EXPECT_EQ(zPattern.zColCounts[i][1], 0);
-                EXPECT_EQ(zPattern.zColCounts[i][2], 0);
-                EXPECT_EQ(zPattern.zColCounts[i][3], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][0], 4);
+                EXPECT_EQ(zPattern.getColCounts()[i][1], 0);
+                EXPECT_EQ(zPattern.getColCounts()[i][2], 0);
+                EXPECT_EQ(zPattern.getColCounts()[i][3], 2);
                 break;
             }
             case 4: case 5: {
-                EXPECT_EQ(zPattern.zColCounts[i][0], 4);
-                EXPECT_EQ(zPattern.zColCounts[i][1], 0);
-                EXPECT_EQ(zPattern.zColCounts[i][2], 2);
-                EXPECT_EQ(zPattern.zColCounts[i][3], 0);
+                EXPECT_EQ(zPattern.getColCounts()[i][0], 4);
+                EXPECT_EQ(zPattern.getColCounts()[i][1], 0);
+                EXPECT_EQ(zPattern.getColCounts()[i][2], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][3], 0);
                 break;
             }
             default: {
@@ -283,62 +283,62 @@ TEST(ZMatrixTest, ZMatrixPatternsUpdateMetadata) {
         }
     }
     // i is the value we are counting, j count of the value, zCountRows[i][j] = count of rows with j count of i
-    for (int i = 0; i < zPattern.zCountRows.size(); i++) {
-        for (int j = 0; j < zPattern.zCountRows[i].size(); j++) {
+    for (int i = 0; i < zPattern.getCountRows().size(); i++) {
+        for (int j = 0; j < zPattern.getCountRows()[i].size(); j++) {
             if (i == 0 && j == 4) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 6);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 6);
             } else if (i == 1 && j == 0) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 6);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 6);
             } else if ((i == 2 || i == 3) && j < 3) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 2);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 2);
             } else {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 0);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 0);
             }
         }
     }
     // i is the value we are counting, j count of the value, zCountCols[i][j] = count of cols with j count of i
-    for (int i = 0; i < zPattern.zCountCols.size(); i++) {
-        for (int j = 0; j < zPattern.zCountCols[i].size(); j++) {
+    for (int i = 0; i < zPattern.getCountCols().size(); i++) {
+        for (int j = 0; j < zPattern.getCountCols()[i].size(); j++) {
             if (i == 0 && j == 4) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 6);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 6);
             } else if (i == 1 && j == 0) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 6);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 6);
             } else if ((i == 2 || i == 3) && j < 3) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 2);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 2);
             } else {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 0);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 0);
             }
         }
     }
     // Pattern B
     zPattern.z = PATTERN_B;
     zPattern.updateMetadata();
-    EXPECT_EQ(zPattern.zSum, 40);
-    EXPECT_EQ(zPattern.zNumCounts[0], 16);
-    EXPECT_EQ(zPattern.zNumCounts[1], 8);
-    EXPECT_EQ(zPattern.zNumCounts[2], 4);
-    EXPECT_EQ(zPattern.zNumCounts[3], 8);
+    EXPECT_EQ(zPattern.getSum(), 40);
+    EXPECT_EQ(zPattern.getNumCounts()[0], 16);
+    EXPECT_EQ(zPattern.getNumCounts()[1], 8);
+    EXPECT_EQ(zPattern.getNumCounts()[2], 4);
+    EXPECT_EQ(zPattern.getNumCounts()[3], 8);
     for (int i = 0; i < ROWS; i++) {
         switch (i) {
             case 0: case 1: {
-                EXPECT_EQ(zPattern.zRowCounts[i][0], 4);
-                EXPECT_EQ(zPattern.zRowCounts[i][1], 0);
-                EXPECT_EQ(zPattern.zRowCounts[i][2], 1);
-                EXPECT_EQ(zPattern.zRowCounts[i][3], 1);
+                EXPECT_EQ(zPattern.getRowCounts()[i][0], 4);
+                EXPECT_EQ(zPattern.getRowCounts()[i][1], 0);
+                EXPECT_EQ(zPattern.getRowCounts()[i][2], 1);
+                EXPECT_EQ(zPattern.getRowCounts()[i][3], 1);
                 break;
             }
             case 2: case 3: {
-                EXPECT_EQ(zPattern.zRowCounts[i][0], 0);
-                EXPECT_EQ(zPattern.zRowCounts[i][1], 4);
-                EXPECT_EQ(zPattern.zRowCounts[i][2], 0);
-                EXPECT_EQ(zPattern.zRowCounts[i][3], 2);
+                EXPECT_EQ(zPattern.getRowCounts()[i][0], 0);
+                EXPECT_EQ(zPattern.getRowCounts()[i][1], 4);
+                EXPECT_EQ(zPattern.getRowCounts()[i][2], 0);
+                EXPECT_EQ(zPattern.getRowCounts()[i][3], 2);
                 break;
             }
             case 4: case 5: {
-                EXPECT_EQ(zPattern.zRowCounts[i][0], 4);
-                EXPECT_EQ(zPattern.zRowCounts[i][1], 0);
-                EXPECT_EQ(zPattern.zRowCounts[i][2], 1);
-                EXPECT_EQ(zPattern.zRowCounts[i][3], 1);
+                EXPECT_EQ(zPattern.getRowCounts()[i][0], 4);
+                EXPECT_EQ(zPattern.getRowCounts()[i][1], 0);
+                EXPECT_EQ(zPattern.getRowCounts()[i][2], 1);
+                EXPECT_EQ(zPattern.getRowCounts()[i][3], 1);
                 break;
             }
             default: {
@@ -349,31 +349,31 @@ TEST(ZMatrixTest, ZMatrixPatternsUpdateMetadata) {
     for (int i = 0; i < COLS; i++) {
         switch (i) {
             case 0: {
-                EXPECT_EQ(zPattern.zColCounts[i][0], 2);
-                EXPECT_EQ(zPattern.zColCounts[i][1], 2);
-                EXPECT_EQ(zPattern.zColCounts[i][2], 0);
-                EXPECT_EQ(zPattern.zColCounts[i][3], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][0], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][1], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][2], 0);
+                EXPECT_EQ(zPattern.getColCounts()[i][3], 2);
                 break;
             }
             case 1: {
-                EXPECT_EQ(zPattern.zColCounts[i][0], 2);
-                EXPECT_EQ(zPattern.zColCounts[i][1], 2);
-                EXPECT_EQ(zPattern.zColCounts[i][2], 2);
-                EXPECT_EQ(zPattern.zColCounts[i][3], 0);
+                EXPECT_EQ(zPattern.getColCounts()[i][0], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][1], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][2], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][3], 0);
                 break;
             }
             case 2: case 3: {
-                EXPECT_EQ(zPattern.zColCounts[i][0], 4);
-                EXPECT_EQ(zPattern.zColCounts[i][1], 0);
-                EXPECT_EQ(zPattern.zColCounts[i][2], 0);
-                EXPECT_EQ(zPattern.zColCounts[i][3], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][0], 4);
+                EXPECT_EQ(zPattern.getColCounts()[i][1], 0);
+                EXPECT_EQ(zPattern.getColCounts()[i][2], 0);
+                EXPECT_EQ(zPattern.getColCounts()[i][3], 2);
                 break;
             }
             case 4: case 5: {
-                EXPECT_EQ(zPattern.zColCounts[i][0], 2);
-                EXPECT_EQ(zPattern.zColCounts[i][1], 2);
-                EXPECT_EQ(zPattern.zColCounts[i][2], 1);
-                EXPECT_EQ(zPattern.zColCounts[i][3], 1);
+                EXPECT_EQ(zPattern.getColCounts()[i][0], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][1], 2);
+                EXPECT_EQ(zPattern.getColCounts()[i][2], 1);
+                EXPECT_EQ(zPattern.getColCounts()[i][3], 1);
                 break;
             }
             default: {
@@ -382,54 +382,54 @@ TEST(ZMatrixTest, ZMatrixPatternsUpdateMetadata) {
         }
     }
     // i is the value we are counting, j count of the value, zCountRows[i][j] = count of rows with j count of i
-    for (int i = 0; i < zPattern.zCountRows.size(); i++) {
-        for (int j = 0; j < zPattern.zCountRows[i].size(); j++) {
+    for (int i = 0; i < zPattern.getCountRows().size(); i++) {
+        for (int j = 0; j < zPattern.getCountRows()[i].size(); j++) {
             if (i == 0 && j == 0) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 2);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 2);
             } else if (i == 0 && j == 4) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 4);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 4);
             } else if (i == 1 && j == 0) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 4);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 4);
             } else if (i == 1 && j == 4) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 2);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 2);
             } else if (i == 2 && j == 0) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 2);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 2);
             } else if (i == 2 && j == 1) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 4);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 4);
             } else if (i == 3 && j == 1) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 4);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 4);
             } else if (i == 3 && j == 2) {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 2);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 2);
             } else {
-                EXPECT_EQ(zPattern.zCountRows[i][j], 0);
+                EXPECT_EQ(zPattern.getCountRows()[i][j], 0);
             }
         }
     }
     // i is the value we are counting, j count of the value, zCountCols[i][j] = count of cols with j count of i
-    for (int i = 0; i < zPattern.zCountCols.size(); i++) {
-        for (int j = 0; j < zPattern.zCountCols[i].size(); j++) {
+    for (int i = 0; i < zPattern.getCountCols().size(); i++) {
+        for (int j = 0; j < zPattern.getCountCols()[i].size(); j++) {
             if (i == 0 && j == 2) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 4);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 4);
             } else if (i == 0 && j == 4) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 2);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 2);
             } else if (i == 1 && j == 0) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 2);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 2);
             } else if (i == 1 && j == 2) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 4);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 4);
             } else if (i == 2 && j == 0) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 3);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 3);
             } else if (i == 2 && j == 1) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 2);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 2);
             } else if (i == 2 && j == 2) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 1);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 1);
             } else if (i == 3 && j == 0) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 1);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 1);
             } else if (i == 3 && j == 1) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 2);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 2);
             } else if (i == 3 && j == 2) {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 3);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 3);
             } else {
-                EXPECT_EQ(zPattern.zCountCols[i][j], 0);
+                EXPECT_EQ(zPattern.getCountCols()[i][j], 0);
             }
         }
     }
@@ -448,7 +448,7 @@ TEST(ZMatrixTest, ZMatrixPatternsUpdateMetadata) {
 TEST(ZMatrixTest, ZMatrixGroupingsUpdateMetadata) {
     zmatrix groupings = initGroupings();
     groupings.updateMetadata();
-    EXPECT_EQ(groupings.zSum, 666);
+    EXPECT_EQ(groupings.getSum(), 666);
 }
 
 TEST(ZMatrixTest, ZMatrixEqualityOperator) {
@@ -514,13 +514,66 @@ TEST(ZMatrixTest, ZMatrixNotEqualOperator) {
     EXPECT_TRUE(z1 != z2);
 }
 
-// TODO: Implement the following tests
+// Swaps update the metadata in place so it should match a full recount
+void expectSameMetadata(const zmatrix &swapped, zmatrix recounted) {
+    recounted.updateMetadata();
+    EXPECT_EQ(swapped.z, recounted.z);
+    EXPECT_EQ(swapped.getSum(), recounted.getSum());
+    EXPECT_EQ(swapped.getNumCounts(), recounted.getNumCounts());
+    EXPECT_EQ(swapped.getRowCounts(), recounted.getRowCounts());
+    EXPECT_EQ(swapped.getColCounts(), recounted.getColCounts());
+    EXPECT_EQ(swapped.getCountRows(), recounted.getCountRows());
+    EXPECT_EQ(swapped.getCountCols(), recounted.getCountCols());
+    EXPECT_EQ(swapped.getRowPairCounts(), recounted.getRowPairCounts());
+    EXPECT_EQ(swapped.getColPairCounts(), recounted.getColPairCounts());
+    EXPECT_EQ(swapped.getRowPairCountsTotals(), recounted.getRowPairCountsTotals());
+    EXPECT_EQ(swapped.getColPairCountsTotals(), recounted.getColPairCountsTotals());
+    EXPECT_EQ(swapped.getRowValuePairCounts(), recounted.getRowValuePairCounts());
+    EXPECT_EQ(swapped.getColValuePairCounts(), recounted.getColValuePairCounts());
+    EXPECT_EQ(swapped.getRowValuePairCountsTotals(), recounted.getRowValuePairCountsTotals());
+    EXPECT_EQ(swapped.getColValuePairCountsTotals(), recounted.getColValuePairCountsTotals());
+}
+
 TEST(ZMatrixTest, ZMatrixSwapCols) {
-    GTEST_SKIP() << "Not implemented yet";
+    zmatrix zm = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zm.z = PATTERN_B;
+    zm.updateMetadata();
+    zm.swapColumns(0, 4);
+    EXPECT_EQ(zm.z[0][0], 0);
+    EXPECT_EQ(zm.z[0][4], 3);
+    expectSameMetadata(zm, zm);
+    zm.swapColumns(5, 2);
+    zm.swapColumns(1, 1);
+    expectSameMetadata(zm, zm);
+
+    // Swapping before the metadata has been counted still leaves it correct
+    zmatrix fresh = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    fresh.z = PATTERN_B;
+    fresh.swapColumns(2, 3);
+    expectSameMetadata(fresh, fresh);
 }
 
 TEST(ZMatrixTest, ZMatrixSwapRows) {
-    GTEST_SKIP() << "Not implemented yet";
+    zmatrix zm = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zm.z = PATTERN_A;
+    zm.updateMetadata();
+    // Walk PATTERN_A into PATTERN_A_ROW_SWAPS -> rows 1, 3, 5, 2, 4, 0
+    zm.swapRows(0, 1);
+    zm.swapRows(1, 3);
+    zm.swapRows(2, 5);
+    zm.swapRows(3, 5);
+    EXPECT_EQ(zm.z, PATTERN_A_ROW_SWAPS);
+    expectSameMetadata(zm, zm);
+
+    zmatrix zCase = zmatrix(ROWS, COLS, CASE_MAX_VALUE);
+    zCase.z = CASE1;
+    zCase.updateMetadata();
+    zCase.swapRows(0, 2);
+    zCase.swapRows(1, 3);
+    zCase.swapColumns(0, 2);
+    zCase.swapColumns(1, 3);
+    EXPECT_EQ(zCase.z, CASE1_REARRANGED);
+    expectSameMetadata(zCase, zCase);
 }
 
 TEST(ZMatrixTest, ZMatrixRearrangeMatch) {
@@ -547,4 +600,135 @@ TEST(ZMatrixTest, ZMatrixRearrangeMatch) {
     z3.z = PATTERN_A_ROW_SWAPS;
     z3.updateMetadata();
     EXPECT_TRUE(z1.rearrangeMatch(z3)) << "Pattern A should match Pattern A with row swaps";
-}
\ No newline at end of file
+}
+TEST(ZMatrixTest, ZMatrixCanonicalForm) {
+    zmatrix zA = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zmatrix zASwaps = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zmatrix zB = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zA.z = PATTERN_A;
+    zASwaps.z = PATTERN_A_ROW_SWAPS;
+    zB.z = PATTERN_B;
+    zA.updateMetadata();
+    zASwaps.updateMetadata();
+    zB.updateMetadata();
+    EXPECT_EQ(zA.canonicalForm(), zASwaps.canonicalForm());
+    EXPECT_EQ(zA.canonicalHash(), zASwaps.canonicalHash());
+    EXPECT_NE(zA.canonicalForm(), zB.canonicalForm());
+    EXPECT_TRUE(zA == zASwaps);
+    EXPECT_FALSE(zA == zB);
+
+    // Canonical form is itself a rearrangement of the matrix
+    zmatrix zCanonical = zmatrix(zA.canonicalForm());
+    EXPECT_TRUE(zA.rearrangeMatch(zCanonical));
+
+    zmatrix zRA1 = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zmatrix zRA2 = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zRA1.z = REARRANGE_A_1;
+    zRA2.z = REARRANGE_A_2;
+    zRA1.updateMetadata();
+    zRA2.updateMetadata();
+    EXPECT_EQ(zRA1.canonicalForm(), zRA2.canonicalForm());
+    EXPECT_TRUE(zRA1 == zRA2);
+
+    // Transposes are not rearrangements
+    zmatrix zRA1T = zmatrix(zRA1.toPacked().transposed());
+    EXPECT_NE(zRA1.canonicalForm(), zRA1T.canonicalForm());
+    EXPECT_FALSE(zRA1.rearrangeMatch(zRA1T));
+}
+
+TEST(ZMatrixTest, ZMatrixFingerprint) {
+    zmatrix zA = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zmatrix zASwaps = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zmatrix zB = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zA.z = PATTERN_A;
+    zASwaps.z = PATTERN_A_ROW_SWAPS;
+    zB.z = PATTERN_B;
+    zA.updateMetadata();
+    zASwaps.updateMetadata();
+    zB.updateMetadata();
+    EXPECT_EQ(zA.getFingerprint(), zASwaps.getFingerprint());
+    EXPECT_NE(zA.getFingerprint(), zB.getFingerprint());
+
+    // Swaps don't change the fingerprint
+    uint64_t before = zB.getFingerprint();
+    zB.swapRows(0, 5);
+    zB.swapColumns(1, 3);
+    EXPECT_EQ(zB.getFingerprint(), before);
+
+    // Same values as a case matrix is a different fingerprint
+    zmatrix zCase = zmatrix(ROWS, COLS, CASE_MAX_VALUE);
+    zmatrix zCaseAsPattern = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zCase.z = CASE7;
+    zCaseAsPattern.z = CASE7;
+    zCase.updateMetadata();
+    zCaseAsPattern.updateMetadata();
+    EXPECT_NE(zCase.getFingerprint(), zCaseAsPattern.getFingerprint());
+}
+
+TEST(ZMatrixTest, ZMatrixLazyMetadata) {
+    zmatrix zm = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zm.z = PATTERN_B;
+    zm.invalidateMetadata();
+    // Only the counts tier gets counted here
+    EXPECT_EQ(zm.getSum(), 40);
+    EXPECT_EQ(zm.getNumCounts()[3], 8);
+    EXPECT_FALSE(zm.hasPairCounts());
+    EXPECT_FALSE(zm.hasValuePairCounts());
+    EXPECT_EQ(zm.getRowPairCounts()[0][1], 6);
+    EXPECT_EQ(zm.getColPairCounts()[2][3], 6);
+    EXPECT_TRUE(zm.hasPairCounts());
+    EXPECT_FALSE(zm.hasValuePairCounts());
+    EXPECT_EQ(zm.getRowPairValuesCount(2, 3, {1, 3}), 6);
+
+    // Changing z and invalidating gets picked up on the next access
+    zm.z[0][0] = 0;
+    zm.invalidateMetadata();
+    EXPECT_FALSE(zm.hasPairCounts());
+    EXPECT_EQ(zm.getSum(), 37);
+    EXPECT_EQ(zm.getRowPairCounts()[0][1], 5);
+
+    // Out of range values are still caught when the counts are made
+    zm.z[0][0] = 4;
+    zm.invalidateMetadata();
+    EXPECT_THROW(zm.getSum(), std::runtime_error);
+
+    // Equality only needs the matrices to be invalidated
+    zmatrix zA = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zmatrix zASwaps = zmatrix(ROWS, COLS, PATTERN_MAX_VALUE);
+    zA.z = PATTERN_A;
+    zASwaps.z = PATTERN_A_ROW_SWAPS;
+    zA.invalidateMetadata();
+    zASwaps.invalidateMetadata();
+    EXPECT_TRUE(zA == zASwaps);
+}
+
+// Matrices that aren't 6x6 can't be packed so they take the plain loops
+TEST(ZMatrixTest, ZMatrixOtherSizes) {
+    zmatrix zm = zmatrix(4, 3, 2);
+    zm.z = {
+        {0, 1, 2},
+        {0, 1, 1},
+        {2, 1, 2},
+        {0, 0, 0}
+    };
+    EXPECT_FALSE(zm.isPackable());
+    zm.updateMetadata();
+    EXPECT_EQ(zm.getSum(), 10);
+    // A row is as long as the number of columns and a column as long as the number of rows
+    EXPECT_EQ(zm.getRowPairCounts()[1][1], 3);
+    EXPECT_EQ(zm.getColPairCounts()[1][1], 4);
+    EXPECT_EQ(zm.getRowPairCounts()[0][1], 2);
+    EXPECT_EQ(zm.getRowPairCounts()[0][2], 2);
+    EXPECT_EQ(zm.getColPairCounts()[0][2], 2);
+    EXPECT_EQ(zm.getRowPairCountsTotals().size(), 4);
+    EXPECT_EQ(zm.getColPairCountsTotals().size(), 5);
+    EXPECT_EQ(zm.getRowPairCountsTotals()[3], 4);
+    EXPECT_EQ(zm.getColPairCountsTotals()[4], 3);
+    EXPECT_EQ(zm.getRowPairValuesCount(0, 2, {1, 2}), 2);
+    EXPECT_EQ(zm.getColPairValuesCount(0, 2, {0}), 1);
+
+    zmatrix swapped = zm;
+    swapped.swapRows(0, 3);
+    swapped.swapColumns(0, 2);
+    EXPECT_TRUE(zm == swapped);
+}
@@ -68,12 +68,11 @@ int main(int argc, char **argv) {
                 // std::cout << "Pattern " << pm.id << " matches: " << pm.caseMatch << std::endl << std::endl;
                 // Toggle printing the first case match
                 bool print = true;
-                for (auto const& pair : pm.caseRearrangements) {
+                for (const packedMatrix &rearranged : pm.caseRearrangements) {
                     if (!print) {
                         break;
                     }
-                    auto key = pair.first;
-                    patternMatrix pmCopy = patternMatrix(pm.id,key);
+                    patternMatrix pmCopy = patternMatrix(pm.id, rearranged.toString());
                     pmCopy.printID = true;
                     matchedCasesFiles[pm.caseMatch] << pmCopy << std::endl;
                     pmCopy.multilineOutput = true;
@@ -84,7 +83,7 @@ int main(int argc, char **argv) {
                         std::cout << "Pattern " << pm.id << " is NOT orthonormal." << std::endl;
                         std::cout << "Case match: " << pm.caseMatch << std::endl;
                         std::cout << "Original Pattern: " << pm << std::endl;
-                        std::cout << "Rearranged Version: " << key << std::endl;
+                        std::cout << "Rearranged Version: " << rearranged << std::endl;
                         pm.printDebugInfo = true;
                         pm.isOrthogonal();
                         pm.isNormalized();
@@ -11,9 +11,9 @@
 #include <regex>
 #include <future>
 
+#include "LDE-Matrix/pattern-catalog.hpp"
 #include "LDE-Matrix/pattern-matrix.hpp"
 #include "LDE-Matrix/zmatrix.hpp"
-#include "LDE-Matrix/data/patterns928.hpp"
 #include "LDE-Matrix/pattern-deduper.hpp"
 
 
@@ -101,9 +101,7 @@ int main(int argc, char **argv) {
         std::cout << "Duplicate ID: " << id << " Count: " << count << std::endl;
         mingout << "Duplicate ID: " << id << " Count: " << count << std::endl;
         mingUniques << "Duplicate ID: " << id << " Count: " << count << std::endl;
-        patternMatrix temp = patternMatrix(id);
-        temp.determineSubCase();
-        dupSubCase[temp.subCaseMatch].push_back(id);
+        dupSubCase[patternCatalog::instance()[id].subCaseMatch].push_back(id);
     }
     // Print out the subcases of 3x
     for (auto const& [subCase, ids] : dupSubCase) {
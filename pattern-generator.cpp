@@ -6,6 +6,7 @@
 #include <sstream>
 #include <future>
 
+#include "LDE-Matrix/pattern-core.hpp"
 #include "LDE-Matrix/pattern-matrix.hpp"
 #include "LDE-Matrix/zmatrix.hpp"
 
@@ -28,11 +29,10 @@ void recursiveSet(int position, zmatrix z, std::vector<patternMatrix> &results)
                 std::cout << "The time per iteration is " << std::chrono::duration_cast<std::chrono::microseconds>(current_time - start_time).count() / patternIterations << " microseconds" << std::endl;
             }
             */
-            std::ostringstream os;
-            os << z;
-            patternMatrix pm = patternMatrix(1, os.str());
-            pm.matchOnCases();
-            if (pm.caseMatch > 0 && pm.isOrthogonal() && pm.isNormalized()) {
+            // Only the valid patterns get turned into a full patternMatrix
+            patternCore pc(1, z.toPacked());
+            if (pc.isOrthonormal() && pc.matchOnCases() > 0) {
+                patternMatrix pm = patternMatrix(pc);
                 std::cout << "Case: " << pm.caseMatch << " Valid Pattern:" << pm << std::endl;
                 results.push_back(pm);
             }
@@ -5,7 +5,10 @@
 #include <sstream>
 #include <filesystem>
 #include <map>
+#include <algorithm>
+#include <stdexcept>
 
+#include "LDE-Matrix/pattern-batch.hpp"
 #include "LDE-Matrix/pattern-matrix.hpp"
 
 std::map<int, std::vector<char>> caseSubcases = {
@@ -22,30 +25,6 @@ std::map<int, std::vector<char>> caseSubcases = {
 std::string matchedCasesDirectory = "matched-cases";
 std::string matchedSubcasesDirectory = "matched-subcases";
 
-std::vector<patternMatrix> loadPatterns(std::string filename)
-{
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Error opening file:" << filename << std::endl;
-        return {}; // Indicate error
-    }
-    std::vector<patternMatrix> patterns;
-    std::string line;
-
-    while (std::getline(file, line)) {
-        // ignore comments
-        if (line[0] == '#') {
-            std::cout << "Ignoring comment: " << line << std::endl;
-            continue;
-        }
-        int id = std::stoi(line.substr(0, line.find(' ')));
-        std::string p = line.substr(line.find(' ')+1);
-        patterns.push_back(patternMatrix(id, p, true));
-    }
-    file.close();
-    return patterns;
-}
-
 int main(int argc, char **argv) {
     std::filesystem::create_directory("matched-subcases");
     std::map<int, std::string> patternFiles = {
@@ -61,7 +40,16 @@ int main(int argc, char **argv) {
     for (auto const& pair : patternFiles) {
         int caseNumber = pair.first;
         std::string patternFile = pair.second;
-        std::vector<patternMatrix> patterns = loadPatterns(patternFile);
+        // The patterns are kept packed and only turned into a patternMatrix for printing
+        patternBatch patterns;
+        try {
+            patterns.loadFromFile(patternFile, true);
+        } catch (const std::runtime_error &e) {
+            std::cerr << e.what() << std::endl;
+        }
+        // The files are already split by case so every pattern is lined up with caseNumber and the subcases are found in one pass
+        std::fill(patterns.caseMatches.begin(), patterns.caseMatches.end(), caseNumber);
+        patterns.classifySubCases();
         std::vector<std::ofstream> matchedCasesFiles;
         std::vector<std::ofstream> matchedCasesFilesHumanReadable;
         matchedCasesFiles.push_back(std::ofstream(matchedSubcasesDirectory+ "/case" + std::to_string(caseNumber) + "-no-subcase-match.txt"));
@@ -82,17 +70,18 @@ int main(int argc, char **argv) {
             matchedCasesFilesHumanReadable[matchedCasesFilesHumanReadable.size()-1] << "# Using the new encoding: 2y + x" << std::endl;
         }
 
-        for (patternMatrix pm : patterns) {
+        for (size_t i = 0; i < patterns.size(); i++) {
+            patternMatrix pm = patterns.toPatternMatrix(i);
             std::cout << "Pattern " << pm.id << std::endl;
             if(!pm.matchesCase(caseNumber)) {
                 std::cout << "Pattern " << pm.id << " does not match case " << caseNumber << " and is in the wrong file" << std::endl;
                 std::cout << pm << std::endl;
                 continue;
             }
-            pm.caseMatch = caseNumber;
             pm.printID = true;
             
-            if(pm.determineSubCase()) {
+            // Every case in this file has lettered subcases so '-' means none of them matched
+            if(pm.subCaseMatch != '-') {
                 int index = pm.subCaseMatch - 'a' + 1;
                 matchedCasesFiles[index] << pm << std::endl;
                 pm.multilineOutput = true;
@@ -10,10 +10,11 @@
 #include <map>
 #include <regex>
 #include <future>
+#include <cmath>
 
 #include "LDE-Matrix/pattern-matrix.hpp"
 #include "LDE-Matrix/zmatrix.hpp"
-#include "LDE-Matrix/data/patterns928.hpp"
+#include "LDE-Matrix/data/embedded-patterns.hpp"
 #include "LDE-Matrix/pattern-deduper.hpp"
 #include "LDE-Matrix/run-utils.hpp"
 
@@ -78,24 +79,6 @@ std::string matchedCasesDirectory = "tfc-output";
 std::string matchedSubcasesDirectory = "tfc-output";
 bool useNewEncoding = false;
 
-std::string replace_all(
-    const std::string & str ,   // where to work
-    const std::string & find ,  // substitute 'find'
-    const std::string & replace //      by 'replace'
-) {
-    using namespace std;
-    string result;
-    size_t find_len = find.size();
-    size_t pos,from=0;
-    while ( string::npos != ( pos=str.find(find,from) ) ) {
-        result.append( str, from, pos-from );
-        result.append( replace );
-        from = pos + find_len;
-    }
-    result.append( str, from , string::npos );
-    return result;
-}
-
 std::vector<patternMatrix> loadPatterns(std::string filename)
 {
     std::ifstream file(filename);
@@ -135,12 +118,7 @@ std::vector<patternMatrix> loadPatternsExtraBrackets(std::string filename) {
             std::cout << "Ignoring comment: " << line << std::endl;
             continue;
         }
-        // Remove the leading and trailing brackets
-        line = line.substr(1, line.size() - 2);
-        // Replace spaces with commas
-        std::replace(line.begin(), line.end(), ' ', ',');
-        // Replace all instances of "],[" with "]["
-        line = replace_all(line, "],[", "][");
+        // The parser reads the [[a b ...] [...]] layout as is
         patterns.push_back(patternMatrix(++lineNumber, line, false));
         if (lineNumber % 1000 == 0) {
             std::cout << "Loaded " << lineNumber << " patterns" << std::endl;
@@ -286,7 +264,6 @@ void case352SubCaseMatching() {
             pm.singleCaseRearrangement = true;
             pm.rearrangeMatrix();
             patternMatrix pm2 = patternMatrix(pm.id, pm.getFirstCaseRearrangement());
-            pm2.updatePairCounts();
             if(!pm2.matchesCase(caseNumber)) {
                 std::cout << "Pattern " << pm2.id << " does not match case " << caseNumber << " and is in the wrong file" << std::endl;
                 std::cout << pm2 << std::endl;
@@ -346,46 +323,41 @@ void test352Possible() {
     std::cout << "Max of possible values: " << test.getMaxOfPossibleValues() << std::endl;
 }
 
-void generateCaseSumMaps() {
-    // int1 = case number, int2 = sum, int3 = id, string = pattern
-    std::map <int, std::map <int, std::map <int, std::string>>> caseSumMap;
-    for (int i = 1; i <=928; i++) {
-        patternMatrix pm = patternMatrix(i);
-        std::cout << pm.id << " " << pm << std::endl;
-        pm.matchOnCases();
-        caseSumMap[pm.caseMatch][pm.p.zSum][pm.id] = pm.toString();
-    }
-    
+// Rebuilds patterns928-aligned.txt from patterns928.txt, copy it into patterns/ if the case rearrangements change
+void generateAlignedPatterns() {
     std::filesystem::create_directory(TFC_OUT_DIR);
-    std::ofstream tfcout = std::ofstream(TFC_OUT_DIR + "/case-sum-map.txt");
+    std::ofstream tfcout = std::ofstream(TFC_OUT_DIR + "/patterns928-aligned.txt");
     if (!tfcout.is_open()) {
-        std::cerr << "Error opening file:" << TFC_OUT_DIR + "/case-sum-map.txt" << std::endl;
+        std::cerr << "Error opening file:" << TFC_OUT_DIR + "/patterns928-aligned.txt" << std::endl;
         return;
     }
-    for (auto const& [caseNumber, sumMap] : caseSumMap) {
-        tfcout << "    {" << caseNumber << ", {" << std::endl;
-        std::cout << "Case: " << caseNumber << std::endl;
-        for (auto const& [sum, idMap] : sumMap) {
-            tfcout << "        {" << sum << ", {" << std::endl;
-            std::cout << "Sum: " << sum << std::endl;
-            for (auto const& [id, pattern] : idMap) {
-                tfcout << "            {" << id << ", \"" << pattern << "\"}," << std::endl;
-            }
-            tfcout << "        }}," << std::endl;
-        }
-        tfcout << "    }}," << std::endl;
+    tfcout << "# Old encoding - 2x+y" << std::endl;
+    tfcout << "# id case pattern -> each patterns928.txt pattern rearranged to line up with its case" << std::endl;
+    for (const embedded928Pattern &embedded : EMBEDDED_928) {
+        patternMatrix pm = patternMatrix(embedded.id, embedded.pattern.toString());
+        pm.singleCaseRearrangement = true;
+        pm.rearrangeMatrix();
+        pm.loadFromString(pm.getFirstCaseRearrangement());
+        std::cout << pm.id << " " << pm << std::endl;
+        tfcout << pm.id << " " << pm.caseMatch << " " << pm.toString() << std::endl;
     }
 }
 
 void outputCaseSumMap() {
-    for (auto const& [caseNumber, sumMap] : CASE_SUM_MAP_PATTERNS_928) {
-        std::cout << "Case: " << caseNumber << std::endl;
-        for (auto const& [sum, idMap] : sumMap) {
+    int caseNumber = 0;
+    int sum = -1;
+    for (int id : EMBEDDED_928_BY_CASE_SUM) {
+        const embedded928Pattern &embedded = pattern928(id);
+        if (embedded.caseMatch != caseNumber) {
+            caseNumber = embedded.caseMatch;
+            sum = -1;
+            std::cout << "Case: " << caseNumber << std::endl;
+        }
+        if (embedded.sum != sum) {
+            sum = embedded.sum;
             std::cout << "Sum: " << sum << std::endl;
-            for (auto const& [id, pattern] : idMap) {
-                std::cout << "ID: " << id << " Pattern: " << pattern << std::endl;
-            }
         }
+        std::cout << "ID: " << id << " Pattern: " << embedded.aligned.toString() << std::endl;
     }
 }
 
@@ -496,18 +468,8 @@ bool dedupTest(int caseNumber) {
             continue;
         }
         //std::cout << caseString << " - Line " << lineNumber << " size: " << line.size() << std::endl;
-        // Silly me for putting in the LDE1only after the pattern as this was causing the pattern loads to fail :(
+        // The parser skips the LDE1only tag after the pattern
         // [[3 3 2 2 0 0] [3 3 2 2 0 0] [2 2 1 1 0 1] [2 2 1 1 0 1] [1 1 1 1 0 0] [1 1 0 0 0 0]] LDE1only
-        if (line.size() > 85) {
-            std::cout << caseString << " - Line " << lineNumber << " is too long: " << line.size() << std::endl;
-            line = line.substr(0, 85);
-        }
-        // Remove the leading and trailing brackets
-        line = line.substr(1, line.size() - 2);
-        // Replace spaces with commas
-        std::replace(line.begin(), line.end(), ' ', ',');
-        // Replace all instances of "],[" with "]["
-        line = replace_all(line, "],[", "][");
         patternMatrix pm = patternMatrix(++lineNumber, line, false);
         //std::cout << pm.id << " " << pm << std::endl;
         pm.matchOnCases();
@@ -657,30 +619,34 @@ void subcaseMatchFiles() {
     }
 }
 
+// The bulk runs give each generation 10 minutes so one pathological pattern can't hold up the rest
+//  The log for a run that hits it says how much of the search was covered
+const searchBudget BULK_RUN_BUDGET = {.maxTime = std::chrono::minutes(10)};
+
 void bulkAllGateRun(int startPattern, int step) {
     for (int i = startPattern; i <= 928; i+=step) {
         //allGateRunWithDebug(i);
-        standardAllGateRun(i);
+        allGateRunWithOptions(i, true, false, true, true, true, BULK_RUN_BUDGET);
     }
 }
 
 void bulkRunOnList(std::vector<int> patternList) {
     for (int i : patternList) {
-        standardAllGateRun(i);
+        allGateRunWithOptions(i, true, false, true, true, true, BULK_RUN_BUDGET);
         //allGateRunWithDebug(i);
     }
 }
 
 void case2Run(int position, int step) {
     for (int i = position; i < case2Groups.size(); i+=step) {
-        standardAllGateRun(case2Groups[i][0]);
+        allGateRunWithOptions(case2Groups[i][0], true, false, true, true, true, BULK_RUN_BUDGET);
     }
 }
 
 void case2RunFull(int position, int step) {
     for (int i = position; i < case2Groups.size(); i+=step) {
         for (int j = 0; j < case2Groups[i].size(); j++) {
-            standardAllGateRun(case2Groups[i][j]);
+            allGateRunWithOptions(case2Groups[i][j], true, false, true, true, true, BULK_RUN_BUDGET);
         }
     }
 }
@@ -22,12 +22,12 @@ int main(int argc, char **argv) {
     patternMatrix p64b = patternMatrix(64, "[1,1,1,1,0,0][1,1,3,3,0,0][1,3,1,3,2,2][1,3,3,1,2,2][0,0,0,0,0,0][0,0,0,0,0,0]", true);
 
     //p352.printOldEncoding = true;
-    p352.pGroupings.multilineOutput = true;
+    p352.pGroupings().multilineOutput = true;
     p352.multilineOutput = true;
     p352.printOldEncoding = printOldEncoding;
 
     //p879.printOldEncoding = true;
-    p879.pGroupings.multilineOutput = true;
+    p879.pGroupings().multilineOutput = true;
     p879.multilineOutput = true;
     p879.printOldEncoding = printOldEncoding;
 
@@ -38,7 +38,7 @@ int main(int argc, char **argv) {
     p352.ldeReductionOnPattern(1);
 
     std::cout << "After T-Gate multiplication (xT14xT23):\n" << p352 << std::endl;
-    std::cout << "Groupings:\n" << p352.pGroupings << std::endl;
+    std::cout << "Groupings:\n" << p352.pGroupings() << std::endl;
     std::cout << "LDEs:" << std::endl;
     p352.printLDEs(std::cout);
     std::cout << "Possible values:" << std::endl;
@@ -56,7 +56,7 @@ int main(int argc, char **argv) {
     p879.rightTGateMultiply(3,4);
     p879.ldeReductionOnPattern(1);
     std::cout << "After T-Gate multiplication (xT12xT34):\n" << p879 << std::endl;
-    std::cout << "Groupings:\n" << p879.pGroupings << std::endl;
+    std::cout << "Groupings:\n" << p879.pGroupings() << std::endl;
     std::cout << "LDEs:" << std::endl;
     p879.printLDEs(std::cout);
     std::cout << "Possible values:" << std::endl;
@@ -67,7 +67,7 @@ int main(int argc, char **argv) {
     std::cout << "Case Match of p879 post: " << p879Post.caseMatch << std::endl;
 
     std::cout << "\n----------------------------------------\n" << std::endl;
-    p64a.pGroupings.multilineOutput = true;
+    p64a.pGroupings().multilineOutput = true;
     p64a.multilineOutput = true;
     p64a.printOldEncoding = printOldEncoding;
     
@@ -78,7 +78,7 @@ int main(int argc, char **argv) {
     
     std::cout << "After T-Gate multiplication " << p64a.printTGateOperations() << ":" << std::endl;
     std::cout << p64a << std::endl;
-    std::cout << "Groupings:\n" << p64a.pGroupings << std::endl;
+    std::cout << "Groupings:\n" << p64a.pGroupings() << std::endl;
     std::cout << "LDEs:" << std::endl;
     p64a.printLDEs(std::cout);
     std::cout << "Possible values:" << std::endl;
@@ -90,14 +90,14 @@ int main(int argc, char **argv) {
     p64aPost.rearrangeMatrix();
     patternMatrix p64aPostRearranged = patternMatrix(64, p64aPost.getFirstCaseRearrangement(), false);
     p64aPostRearranged.multilineOutput = true;
-    p64aPostRearranged.pGroupings.multilineOutput = true;
+    p64aPostRearranged.pGroupings().multilineOutput = true;
     p64aPostRearranged.printOldEncoding = printOldEncoding;
     std::cout << "After rearrangement:\n" << p64aPost.getFirstCaseRearrangement() << std::endl;
     p64aPostRearranged.rightTGateMultiply(1,2);
     //p64aPostRearranged.leftTGateMultiply(5,6);
     p64aPostRearranged.ldeReductionOnPattern(1);
     std::cout << "After T-Gate multiplication:\n" <<  p64aPostRearranged << std::endl;
-    std::cout << "Groupings:\n" << p64aPostRearranged.pGroupings << std::endl;
+    std::cout << "Groupings:\n" << p64aPostRearranged.pGroupings() << std::endl;
     std::cout << "LDEs:" << std::endl;
     p64aPostRearranged.printLDEs(std::cout);
     std::cout << "Possible values:" << std::endl;
@@ -108,7 +108,7 @@ int main(int argc, char **argv) {
     std::cout << "\n----------------------------------------\n" << std::endl;
 
     /*
-    p64b.pGroupings.multilineOutput = true;
+    p64b.pGroupings().multilineOutput = true;
     p64b.multilineOutput = true;
 
     std::cout << "Case 3b: pattern 64 path B:\n" << p64b << std::endl;
@@ -116,7 +116,7 @@ int main(int argc, char **argv) {
     p64b.leftTGateMultiply(3,4);
     p64b.ldeReductionOnPattern(1);
     std::cout << "After T-Gate multiplication:\n" << p64b << std::endl;
-    std::cout << "Groupings:\n" << p64b.pGroupings << std::endl;
+    std::cout << "Groupings:\n" << p64b.pGroupings() << std::endl;
     std::cout << "LDEs:" << std::endl;
     p64b.printLDEs(std::cout);
     std::cout << "Possible values:" << std::endl;